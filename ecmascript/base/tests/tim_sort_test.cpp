@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "ecmascript/base/tim_sort.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+using namespace panda::ecmascript::base;
+
+namespace panda::test {
+class TimSortTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    using Item = std::pair<uint32_t, uint32_t>;  // key, original position
+
+    static bool KeyLess(const Item &x, const Item &y)
+    {
+        return x.first < y.first;
+    }
+
+    static void CheckSorted(std::vector<Item> items)
+    {
+        std::vector<Item> expected = items;
+        std::stable_sort(expected.begin(), expected.end(), KeyLess);
+        TimSortContainer(items, KeyLess);
+        EXPECT_TRUE(items == expected);
+    }
+};
+
+/**
+ * @tc.name: SortRandom
+ * @tc.desc: Sort arrays of pseudo-random keys with many duplicates, the result should equal std::stable_sort.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TimSortTest, SortRandom)
+{
+    constexpr uint32_t SEED = 12345;
+    constexpr uint32_t KEY_RANGE = 97;
+    uint32_t state = SEED;
+    for (uint32_t length : {0U, 1U, 2U, 31U, 32U, 33U, 1000U, 10000U}) {
+        std::vector<Item> items;
+        for (uint32_t i = 0; i < length; i++) {
+            state = state * 1103515245U + 12345U;  // LCG constants
+            items.emplace_back(state % KEY_RANGE, i);
+        }
+        CheckSorted(items);
+    }
+}
+
+/**
+ * @tc.name: SortRuns
+ * @tc.desc: Sort presorted, reversed and partially sorted arrays, the natural runs must be merged stably and a
+ *           presorted input must only take length - 1 comparisons.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TimSortTest, SortRuns)
+{
+    constexpr uint32_t LENGTH = 5000;
+    constexpr uint32_t RUN = 300;
+    std::vector<Item> ascending;
+    std::vector<Item> descending;
+    std::vector<Item> sawtooth;
+    for (uint32_t i = 0; i < LENGTH; i++) {
+        ascending.emplace_back(i, i);
+        descending.emplace_back(LENGTH - i, i);
+        sawtooth.emplace_back(i % RUN, i);
+    }
+    CheckSorted(ascending);
+    CheckSorted(descending);
+    CheckSorted(sawtooth);
+
+    uint32_t comparisons = 0;
+    TimSortContainer(ascending, [&comparisons](const Item &x, const Item &y) {
+        comparisons++;
+        return x.first < y.first;
+    });
+    EXPECT_EQ(comparisons, LENGTH - 1);
+}
+}  // namespace panda::test
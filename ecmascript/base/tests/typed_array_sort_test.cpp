@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <limits>
+
+#include "ecmascript/base/typed_array_sort.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+using namespace panda::ecmascript::base;
+
+namespace panda::test {
+class TypedArraySortTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+};
+
+/**
+ * @tc.name: SortIntegers
+ * @tc.desc: Sort signed and unsigned integer elements of every width, negative values must come first for the
+ *           signed kinds and the largest values last for the unsigned kinds.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TypedArraySortTest, SortIntegers)
+{
+    int8_t int8Values[] = {5, -128, 127, 0, -1, 5};
+    TypedArraySorter<JSType::JS_INT8_ARRAY>::Sort(int8Values, 6);
+    int8_t int8Expected[] = {-128, -1, 0, 5, 5, 127};
+    for (int i = 0; i < 6; i++) {
+        EXPECT_EQ(int8Values[i], int8Expected[i]);
+    }
+
+    uint16_t uint16Values[] = {65535, 256, 1, 0, 255};
+    TypedArraySorter<JSType::JS_UINT16_ARRAY>::Sort(uint16Values, 5);
+    uint16_t uint16Expected[] = {0, 1, 255, 256, 65535};
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ(uint16Values[i], uint16Expected[i]);
+    }
+
+    int32_t int32Values[] = {100000, std::numeric_limits<int32_t>::min(), -7, 3, std::numeric_limits<int32_t>::max()};
+    TypedArraySorter<JSType::JS_INT32_ARRAY>::Sort(int32Values, 5);
+    int32_t int32Expected[] = {std::numeric_limits<int32_t>::min(), -7, 3, 100000, std::numeric_limits<int32_t>::max()};
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ(int32Values[i], int32Expected[i]);
+    }
+}
+
+/**
+ * @tc.name: SortFloats
+ * @tc.desc: Sort float elements containing infinities, signed zeros and NaNs. -0 must come before +0 and every
+ *           NaN must be moved to the end.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TypedArraySortTest, SortFloats)
+{
+    constexpr double NAN_VALUE = std::numeric_limits<double>::quiet_NaN();
+    constexpr double INF_VALUE = std::numeric_limits<double>::infinity();
+    double values[] = {NAN_VALUE, 0.0, 1.5, -INF_VALUE, -0.0, -NAN_VALUE, -2.25, INF_VALUE};
+    TypedArraySorter<JSType::JS_FLOAT64_ARRAY>::Sort(values, 8);
+    EXPECT_EQ(values[0], -INF_VALUE);
+    EXPECT_EQ(values[1], -2.25);
+    EXPECT_TRUE(values[2] == 0.0 && std::signbit(values[2]));
+    EXPECT_TRUE(values[3] == 0.0 && !std::signbit(values[3]));
+    EXPECT_EQ(values[4], 1.5);
+    EXPECT_EQ(values[5], INF_VALUE);
+    EXPECT_TRUE(std::isnan(values[6]));
+    EXPECT_TRUE(std::isnan(values[7]));
+
+    float floatValues[] = {3.0F, -0.0F, -3.0F, 0.0F};
+    TypedArraySorter<JSType::JS_FLOAT32_ARRAY>::Sort(floatValues, 4);
+    EXPECT_EQ(floatValues[0], -3.0F);
+    EXPECT_TRUE(std::signbit(floatValues[1]));
+    EXPECT_FALSE(std::signbit(floatValues[2]));
+    EXPECT_EQ(floatValues[3], 3.0F);
+}
+}  // namespace panda::test
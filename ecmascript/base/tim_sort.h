@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_BASE_TIM_SORT_H
+#define ECMASCRIPT_BASE_TIM_SORT_H
+
+#include <array>
+#include <cstdint>
+
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript::base {
+// The storage a sort element lives in. MAIN is the range being sorted, TMP is the scratch buffer used by merges
+// and by binary insertion (slot 0 holds the pivot).
+enum class SortSlot : uint8_t { MAIN, TMP };
+
+// TimSort is a stable, adaptive merge sort. It finds natural runs, extends short runs with binary insertion and
+// merges them under the usual run-length invariants, so presorted and reversed inputs take O(n) comparisons.
+// The engine never holds element values itself, it only talks to the Accessor through slot indexes. That keeps it
+// usable for tagged arrays whose comparator calls back into JS and may move objects during GC.
+//
+// Accessor must provide:
+//     bool Less(SortSlot lhsSlot, uint32_t lhs, SortSlot rhsSlot, uint32_t rhs);
+//     void Move(SortSlot dstSlot, uint32_t dst, SortSlot srcSlot, uint32_t src);
+//     bool IsAbrupt() const;
+// and a TMP storage of at least GetTmpLength(length) elements. Once IsAbrupt() returns true the engine stops
+// comparing, but MAIN is still left holding a permutation of its original elements.
+template<typename Accessor>
+class TimSort {
+public:
+    explicit TimSort(Accessor &accessor) : accessor_(accessor) {}
+    ~TimSort() = default;
+    NO_COPY_SEMANTIC(TimSort);
+    NO_MOVE_SEMANTIC(TimSort);
+
+    static uint32_t GetTmpLength(uint32_t length)
+    {
+        return length / 2 + 1;  // 2: the smaller of two merged runs never exceeds half of the range
+    }
+
+    void Sort(uint32_t length)
+    {
+        if (length < 2) {  // 2: nothing to sort
+            return;
+        }
+        if (length < MIN_MERGE) {
+            uint32_t initRunLength = CountRunAndMakeAscending(0, length);
+            BinaryInsertionSort(0, length, initRunLength);
+            return;
+        }
+
+        uint32_t minRun = MinRunLength(length);
+        uint32_t low = 0;
+        uint32_t remaining = length;
+        while (remaining != 0 && !accessor_.IsAbrupt()) {
+            uint32_t runLength = CountRunAndMakeAscending(low, low + remaining);
+            if (runLength < minRun) {
+                uint32_t force = remaining <= minRun ? remaining : minRun;
+                BinaryInsertionSort(low, low + force, low + runLength);
+                runLength = force;
+            }
+            PushRun(low, runLength);
+            MergeCollapse();
+            low += runLength;
+            remaining -= runLength;
+        }
+        MergeForceCollapse();
+    }
+
+private:
+    static constexpr uint32_t MIN_MERGE = 32;
+    // Run lengths grow at least as fast as the Fibonacci numbers, so 64 entries cover any uint32_t length.
+    static constexpr uint32_t MAX_RUN_STACK = 64;
+
+    struct Run {
+        uint32_t base {0};
+        uint32_t length {0};
+    };
+
+    static uint32_t MinRunLength(uint32_t length)
+    {
+        uint32_t lowBit = 0;
+        while (length >= MIN_MERGE) {
+            lowBit |= (length & 1U);
+            length >>= 1U;
+        }
+        return length + lowBit;
+    }
+
+    bool Less(SortSlot lhsSlot, uint32_t lhs, SortSlot rhsSlot, uint32_t rhs)
+    {
+        return accessor_.Less(lhsSlot, lhs, rhsSlot, rhs);
+    }
+
+    void Move(SortSlot dstSlot, uint32_t dst, SortSlot srcSlot, uint32_t src)
+    {
+        accessor_.Move(dstSlot, dst, srcSlot, src);
+    }
+
+    void Reverse(uint32_t low, uint32_t high)
+    {
+        while (low + 1 < high) {
+            high--;
+            Move(SortSlot::TMP, 0, SortSlot::MAIN, low);
+            Move(SortSlot::MAIN, low, SortSlot::MAIN, high);
+            Move(SortSlot::MAIN, high, SortSlot::TMP, 0);
+            low++;
+        }
+    }
+
+    // Returns the length of the run starting at low. A strictly descending run is reversed in place, which keeps
+    // the sort stable because equal elements never belong to a descending run.
+    uint32_t CountRunAndMakeAscending(uint32_t low, uint32_t high)
+    {
+        uint32_t runHigh = low + 1;
+        if (runHigh == high) {
+            return 1;
+        }
+        if (Less(SortSlot::MAIN, runHigh++, SortSlot::MAIN, low)) {
+            while (runHigh < high && !accessor_.IsAbrupt() &&
+                   Less(SortSlot::MAIN, runHigh, SortSlot::MAIN, runHigh - 1)) {
+                runHigh++;
+            }
+            Reverse(low, runHigh);
+        } else {
+            while (runHigh < high && !accessor_.IsAbrupt() &&
+                   !Less(SortSlot::MAIN, runHigh, SortSlot::MAIN, runHigh - 1)) {
+                runHigh++;
+            }
+        }
+        return runHigh - low;
+    }
+
+    // Sorts [low, high) given that [low, start) is already sorted.
+    void BinaryInsertionSort(uint32_t low, uint32_t high, uint32_t start)
+    {
+        if (start == low) {
+            start++;
+        }
+        for (; start < high && !accessor_.IsAbrupt(); start++) {
+            Move(SortSlot::TMP, 0, SortSlot::MAIN, start);
+            uint32_t left = low;
+            uint32_t right = start;
+            while (left < right) {
+                uint32_t middle = left + (right - left) / 2;  // 2: half
+                if (Less(SortSlot::TMP, 0, SortSlot::MAIN, middle)) {
+                    right = middle;
+                } else {
+                    left = middle + 1;
+                }
+            }
+            for (uint32_t i = start; i > left; i--) {
+                Move(SortSlot::MAIN, i, SortSlot::MAIN, i - 1);
+            }
+            Move(SortSlot::MAIN, left, SortSlot::TMP, 0);
+        }
+    }
+
+    void PushRun(uint32_t base, uint32_t length)
+    {
+        ASSERT(stackSize_ < MAX_RUN_STACK);
+        runs_[stackSize_].base = base;
+        runs_[stackSize_].length = length;
+        stackSize_++;
+    }
+
+    // Keeps run lengths satisfying runs[i - 2] > runs[i - 1] + runs[i] and runs[i - 1] > runs[i].
+    void MergeCollapse()
+    {
+        while (stackSize_ > 1 && !accessor_.IsAbrupt()) {
+            uint32_t n = stackSize_ - 2;  // 2: the second run from the top
+            if ((n > 0 && runs_[n - 1].length <= runs_[n].length + runs_[n + 1].length) ||
+                (n > 1 && runs_[n - 2].length <= runs_[n - 1].length + runs_[n].length)) {  // 2: third from the top
+                if (runs_[n - 1].length < runs_[n + 1].length) {
+                    n--;
+                }
+            } else if (runs_[n].length > runs_[n + 1].length) {
+                break;
+            }
+            MergeAt(n);
+        }
+    }
+
+    void MergeForceCollapse()
+    {
+        while (stackSize_ > 1 && !accessor_.IsAbrupt()) {
+            uint32_t n = stackSize_ - 2;  // 2: the second run from the top
+            if (n > 0 && runs_[n - 1].length < runs_[n + 1].length) {
+                n--;
+            }
+            MergeAt(n);
+        }
+    }
+
+    void MergeAt(uint32_t i)
+    {
+        uint32_t base1 = runs_[i].base;
+        uint32_t length1 = runs_[i].length;
+        uint32_t base2 = runs_[i + 1].base;
+        uint32_t length2 = runs_[i + 1].length;
+        ASSERT(base1 + length1 == base2);
+
+        runs_[i].length = length1 + length2;
+        if (i + 3 == stackSize_) {  // 3: merging the second and third runs, slide the top run down
+            runs_[i + 1] = runs_[i + 2];  // 2: the top run
+        }
+        stackSize_--;
+
+        // Elements of run1 that are not greater than the first element of run2 are already in place.
+        uint32_t left = base1;
+        uint32_t right = base1 + length1;
+        while (left < right) {
+            uint32_t middle = left + (right - left) / 2;  // 2: half
+            if (Less(SortSlot::MAIN, base2, SortSlot::MAIN, middle)) {
+                right = middle;
+            } else {
+                left = middle + 1;
+            }
+        }
+        length1 -= left - base1;
+        base1 = left;
+        if (length1 == 0 || accessor_.IsAbrupt()) {
+            return;
+        }
+
+        // Elements of run2 that are not less than the last element of run1 are already in place.
+        uint32_t last1 = base1 + length1 - 1;
+        left = base2;
+        right = base2 + length2;
+        while (left < right) {
+            uint32_t middle = left + (right - left) / 2;  // 2: half
+            if (Less(SortSlot::MAIN, middle, SortSlot::MAIN, last1)) {
+                left = middle + 1;
+            } else {
+                right = middle;
+            }
+        }
+        length2 = left - base2;
+        if (length2 == 0 || accessor_.IsAbrupt()) {
+            return;
+        }
+
+        if (length1 <= length2) {
+            MergeLow(base1, length1, base2, length2);
+        } else {
+            MergeHigh(base1, length1, base2, length2);
+        }
+    }
+
+    // Merges two adjacent runs by buffering the first (shorter) one and filling from the left.
+    void MergeLow(uint32_t base1, uint32_t length1, uint32_t base2, uint32_t length2)
+    {
+        for (uint32_t i = 0; i < length1; i++) {
+            Move(SortSlot::TMP, i, SortSlot::MAIN, base1 + i);
+        }
+        uint32_t cursor1 = 0;
+        uint32_t cursor2 = base2;
+        uint32_t end2 = base2 + length2;
+        uint32_t dest = base1;
+        while (cursor1 < length1 && cursor2 < end2 && !accessor_.IsAbrupt()) {
+            if (Less(SortSlot::MAIN, cursor2, SortSlot::TMP, cursor1)) {
+                Move(SortSlot::MAIN, dest++, SortSlot::MAIN, cursor2++);
+            } else {
+                Move(SortSlot::MAIN, dest++, SortSlot::TMP, cursor1++);
+            }
+        }
+        // Whatever is left in TMP exactly fills the gap before cursor2.
+        while (cursor1 < length1) {
+            Move(SortSlot::MAIN, dest++, SortSlot::TMP, cursor1++);
+        }
+    }
+
+    // Merges two adjacent runs by buffering the second (shorter) one and filling from the right.
+    void MergeHigh(uint32_t base1, uint32_t length1, uint32_t base2, uint32_t length2)
+    {
+        for (uint32_t i = 0; i < length2; i++) {
+            Move(SortSlot::TMP, i, SortSlot::MAIN, base2 + i);
+        }
+        // Cursors point one past the next element to take.
+        uint32_t cursor1 = base1 + length1;
+        uint32_t cursor2 = length2;
+        uint32_t dest = base2 + length2;
+        while (cursor1 > base1 && cursor2 > 0 && !accessor_.IsAbrupt()) {
+            if (Less(SortSlot::TMP, cursor2 - 1, SortSlot::MAIN, cursor1 - 1)) {
+                Move(SortSlot::MAIN, --dest, SortSlot::MAIN, --cursor1);
+            } else {
+                Move(SortSlot::MAIN, --dest, SortSlot::TMP, --cursor2);
+            }
+        }
+        // Whatever is left in TMP exactly fills the gap after cursor1.
+        while (cursor2 > 0) {
+            Move(SortSlot::MAIN, --dest, SortSlot::TMP, --cursor2);
+        }
+    }
+
+    Accessor &accessor_;
+    std::array<Run, MAX_RUN_STACK> runs_ {};
+    uint32_t stackSize_ {0};
+};
+
+// Accessor over plain C++ containers, used by the kernels that never call back into JS.
+template<typename Container, typename Compare>
+class ContainerSortAccessor {
+public:
+    ContainerSortAccessor(Container &data, Container &tmp, Compare less) : data_(data), tmp_(tmp), less_(less) {}
+    ~ContainerSortAccessor() = default;
+    NO_COPY_SEMANTIC(ContainerSortAccessor);
+    NO_MOVE_SEMANTIC(ContainerSortAccessor);
+
+    bool Less(SortSlot lhsSlot, uint32_t lhs, SortSlot rhsSlot, uint32_t rhs)
+    {
+        return less_(At(lhsSlot, lhs), At(rhsSlot, rhs));
+    }
+
+    void Move(SortSlot dstSlot, uint32_t dst, SortSlot srcSlot, uint32_t src)
+    {
+        At(dstSlot, dst) = At(srcSlot, src);
+    }
+
+    bool IsAbrupt() const
+    {
+        return false;
+    }
+
+private:
+    typename Container::value_type &At(SortSlot slot, uint32_t index)
+    {
+        return slot == SortSlot::MAIN ? data_[index] : tmp_[index];
+    }
+
+    Container &data_;
+    Container &tmp_;
+    Compare less_;
+};
+
+// Stable sort of a whole container with a strict weak ordering.
+template<typename Container, typename Compare>
+void TimSortContainer(Container &data, Compare less)
+{
+    using Accessor = ContainerSortAccessor<Container, Compare>;
+    auto length = static_cast<uint32_t>(data.size());
+    Container tmp(TimSort<Accessor>::GetTmpLength(length));
+    Accessor accessor(data, tmp, less);
+    TimSort<Accessor>(accessor).Sort(length);
+}
+}  // namespace panda::ecmascript::base
+
+#endif  // ECMASCRIPT_BASE_TIM_SORT_H
@@ -18,6 +18,7 @@
 #include "ecmascript/base/error_helper.h"
 #include "ecmascript/base/error_type.h"
 #include "ecmascript/base/typed_array_helper-inl.h"
+#include "ecmascript/base/typed_array_sort.h"
 #include "ecmascript/builtins/builtins_arraybuffer.h"
 #include "ecmascript/ecma_macros.h"
 #include "ecmascript/ecma_vm.h"
@@ -26,6 +27,7 @@
 #include "ecmascript/js_array_iterator.h"
 #include "ecmascript/js_arraybuffer.h"
 #include "ecmascript/js_hclass.h"
+#include "ecmascript/js_native_pointer.h"
 #include "ecmascript/js_object-inl.h"
 #include "ecmascript/js_tagged_value-inl.h"
 #include "ecmascript/js_tagged_value.h"
@@ -597,4 +599,29 @@ int32_t TypedArrayHelper::SortCompare(JSThread *thread, const JSHandle<JSTaggedV
     }
     return +0;
 }
+
+// Sorts the first length elements in place, in the order used when no comparator is given.
+void TypedArrayHelper::SortRawElements(JSThread *thread, const JSHandle<JSObject> &obj, uint32_t length)
+{
+    // an empty buffer has no data block, and fewer than two elements are sorted already
+    if (length < 2) {  // 2: the minimum number of elements to sort
+        return;
+    }
+    DISALLOW_GARBAGE_COLLECTION;
+    JSTypedArray *typedArray = JSTypedArray::Cast(*obj);
+    JSArrayBuffer *buffer = JSArrayBuffer::Cast(typedArray->GetViewedArrayBuffer().GetTaggedObject());
+    void *pointer = JSNativePointer::Cast(buffer->GetArrayBufferData().GetTaggedObject())->GetExternalPointer();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    uint8_t *block = reinterpret_cast<uint8_t *>(pointer) + GetByteOffset(thread, obj);
+    switch (obj->GetJSHClass()->GetObjectType()) {
+#define SORT_RAW_ELEMENTS(name, type)                                                      \
+        case JSType::name:                                                                 \
+            TypedArraySorter<JSType::name>::Sort(reinterpret_cast<type *>(block), length); \
+            break;
+        TYPED_ARRAY_ELEMENT_LIST(SORT_RAW_ELEMENTS)
+#undef SORT_RAW_ELEMENTS
+        default:
+            UNREACHABLE();
+    }
+}
 }  // namespace panda::ecmascript::base
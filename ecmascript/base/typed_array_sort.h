@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_BASE_TYPED_ARRAY_SORT_H
+#define ECMASCRIPT_BASE_TYPED_ARRAY_SORT_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "ecmascript/js_hclass.h"
+#include "ecmascript/mem/c_containers.h"
+#include "libpandabase/utils/bit_utils.h"
+
+namespace panda::ecmascript::base {
+// Element type stored in the backing store of each typed array kind.
+template<JSType type>
+struct TypedArrayElement;
+
+#define TYPED_ARRAY_ELEMENT_LIST(V)             \
+    V(JS_INT8_ARRAY, int8_t)                   \
+    V(JS_UINT8_ARRAY, uint8_t)                 \
+    V(JS_UINT8_CLAMPED_ARRAY, uint8_t)         \
+    V(JS_INT16_ARRAY, int16_t)                 \
+    V(JS_UINT16_ARRAY, uint16_t)               \
+    V(JS_INT32_ARRAY, int32_t)                 \
+    V(JS_UINT32_ARRAY, uint32_t)               \
+    V(JS_FLOAT32_ARRAY, float)                 \
+    V(JS_FLOAT64_ARRAY, double)                \
+    V(JS_BIGINT64_ARRAY, int64_t)              \
+    V(JS_BIGUINT64_ARRAY, uint64_t)
+
+#define TYPED_ARRAY_ELEMENT(name, type) \
+    template<>                          \
+    struct TypedArrayElement<JSType::name> { using Type = type; };
+TYPED_ARRAY_ELEMENT_LIST(TYPED_ARRAY_ELEMENT)
+#undef TYPED_ARRAY_ELEMENT
+
+// Sorts the raw backing store of a typed array in the order %TypedArray%.prototype.sort uses without a comparator.
+// Every element is mapped to an unsigned key whose natural order is the required numeric order (sign bit flipped
+// for signed integers, the usual IEEE-754 trick for floats, which also places -0 before +0), then the keys are
+// LSD radix sorted one byte per pass. NaNs are set aside first and appended at the end.
+template<JSType type>
+class TypedArraySorter {
+public:
+    using ValueType = typename TypedArrayElement<type>::Type;
+    using KeyType = std::conditional_t<sizeof(ValueType) == sizeof(uint8_t), uint8_t,
+                    std::conditional_t<sizeof(ValueType) == sizeof(uint16_t), uint16_t,
+                    std::conditional_t<sizeof(ValueType) == sizeof(uint32_t), uint32_t, uint64_t>>>;
+
+    static void Sort(ValueType *values, uint32_t length)
+    {
+        if (length < 2) {  // 2: nothing to sort
+            return;
+        }
+        if constexpr (sizeof(KeyType) == sizeof(uint8_t)) {
+            CountingSort(values, length);
+        } else {
+            CVector<KeyType> keys;
+            keys.reserve(length);
+            CVector<ValueType> nans;
+            for (uint32_t i = 0; i < length; i++) {
+                ValueType value = values[i];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                if constexpr (std::is_floating_point_v<ValueType>) {
+                    if (std::isnan(value)) {
+                        nans.push_back(value);
+                        continue;
+                    }
+                }
+                keys.push_back(ToKey(value));
+            }
+            RadixSort(keys);
+            uint32_t index = 0;
+            for (KeyType key : keys) {
+                values[index++] = FromKey(key);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+            for (ValueType nan : nans) {
+                values[index++] = nan;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+        }
+    }
+
+private:
+    static constexpr uint32_t RADIX_BITS = 8;
+    static constexpr uint32_t RADIX_SIZE = 1U << RADIX_BITS;
+    static constexpr uint32_t RADIX_MASK = RADIX_SIZE - 1;
+    static constexpr KeyType SIGN_BIT = static_cast<KeyType>(KeyType(1) << (sizeof(KeyType) * 8 - 1));
+
+    static KeyType ToKey(ValueType value)
+    {
+        if constexpr (std::is_floating_point_v<ValueType>) {
+            auto bits = bit_cast<KeyType>(value);
+            return (bits & SIGN_BIT) != 0 ? static_cast<KeyType>(~bits) : static_cast<KeyType>(bits | SIGN_BIT);
+        } else if constexpr (std::is_signed_v<ValueType>) {
+            return static_cast<KeyType>(static_cast<KeyType>(value) ^ SIGN_BIT);
+        } else {
+            return value;
+        }
+    }
+
+    static ValueType FromKey(KeyType key)
+    {
+        if constexpr (std::is_floating_point_v<ValueType>) {
+            KeyType bits = (key & SIGN_BIT) != 0 ? static_cast<KeyType>(key ^ SIGN_BIT) : static_cast<KeyType>(~key);
+            return bit_cast<ValueType>(bits);
+        } else if constexpr (std::is_signed_v<ValueType>) {
+            return static_cast<ValueType>(static_cast<KeyType>(key ^ SIGN_BIT));
+        } else {
+            return key;
+        }
+    }
+
+    static void CountingSort(ValueType *values, uint32_t length)
+    {
+        std::array<uint32_t, RADIX_SIZE> counts {};
+        for (uint32_t i = 0; i < length; i++) {
+            counts[ToKey(values[i])]++;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        uint32_t index = 0;
+        for (uint32_t key = 0; key < RADIX_SIZE; key++) {
+            for (uint32_t count = counts[key]; count > 0; count--) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                values[index++] = FromKey(static_cast<KeyType>(key));
+            }
+        }
+    }
+
+    static void RadixSort(CVector<KeyType> &keys)
+    {
+        auto length = static_cast<uint32_t>(keys.size());
+        CVector<KeyType> scratch(length);
+        KeyType *src = keys.data();
+        KeyType *dst = scratch.data();
+        for (uint32_t shift = 0; shift < sizeof(KeyType) * 8 && length > 1; shift += RADIX_BITS) {
+            std::array<uint32_t, RADIX_SIZE> offsets {};
+            for (uint32_t i = 0; i < length; i++) {
+                offsets[(src[i] >> shift) & RADIX_MASK]++;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+            // Skip the pass when every key has the same digit, e.g. the high bytes of small integers.
+            if (offsets[(src[0] >> shift) & RADIX_MASK] == length) {  // NOLINT(cppcoreguidelines-pro-bounds-*)
+                continue;
+            }
+            uint32_t sum = 0;
+            for (uint32_t &offset : offsets) {
+                uint32_t count = offset;
+                offset = sum;
+                sum += count;
+            }
+            for (uint32_t i = 0; i < length; i++) {
+                KeyType key = src[i];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                dst[offsets[(key >> shift) & RADIX_MASK]++] = key;  // NOLINT(cppcoreguidelines-pro-bounds-*)
+            }
+            std::swap(src, dst);
+        }
+        if (src != keys.data()) {
+            std::copy(src, src + length, keys.data());  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+    }
+};
+}  // namespace panda::ecmascript::base
+
+#endif  // ECMASCRIPT_BASE_TYPED_ARRAY_SORT_H
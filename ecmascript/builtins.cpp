@@ -611,6 +611,8 @@ void Builtins::InitializeSymbol(const JSHandle<GlobalEnv> &env, const JSHandle<J
     env->SetHoleySymbol(thread_, holeySymbol.GetTaggedValue());
     JSHandle<JSTaggedValue> elementIcSymbol(factory_->NewPrivateNameSymbolWithChar("element-ic"));
     env->SetElementICSymbol(thread_, elementIcSymbol.GetTaggedValue());
+    JSHandle<JSTaggedValue> elementsKindSymbol(factory_->NewPrivateNameSymbolWithChar("elements-kind"));
+    env->SetElementsKindSymbol(thread_, elementsKindSymbol.GetTaggedValue());
 
     // ecma 19.2.3.6 Function.prototype[@@hasInstance] ( V )
     JSHandle<JSObject> funcFuncPrototypeObj = JSHandle<JSObject>(env->GetFunctionPrototype());
@@ -694,6 +696,8 @@ void Builtins::InitializeSymbolWithRealm(const JSHandle<GlobalEnv> &realm,
     realm->SetHoleySymbol(thread_, holeySymbol.GetTaggedValue());
     JSHandle<JSTaggedValue> elementIcSymbol(factory_->NewPrivateNameSymbolWithChar("element-ic"));
     realm->SetElementICSymbol(thread_, elementIcSymbol.GetTaggedValue());
+    JSHandle<JSTaggedValue> elementsKindSymbol(factory_->NewPrivateNameSymbolWithChar("elements-kind"));
+    realm->SetElementsKindSymbol(thread_, elementsKindSymbol.GetTaggedValue());
 
     // ecma 19.2.3.6 Function.prototype[@@hasInstance] ( V )
     JSHandle<JSObject> funcFuncPrototypeObj = JSHandle<JSObject>(realm->GetFunctionPrototype());
@@ -65,7 +65,9 @@ JSTaggedValue BuiltinsArray::ArrayConstructor(EcmaRuntimeCallInfo *argv)
     // 22.1.1.1 Array ( )
     if (argc == 0) {
         // 6. Return ArrayCreate(0, proto).
-        return JSTaggedValue(JSArray::ArrayCreate(thread, JSTaggedNumber(0), newTarget).GetObject<JSArray>());
+        JSHandle<JSObject> newArrayHandle(JSArray::ArrayCreate(thread, JSTaggedNumber(0), newTarget));
+        JSHClass::TransitionElementsKind(thread, newArrayHandle, ElementsKind::PACKED_INT);
+        return newArrayHandle.GetTaggedValue();
     }
 
     // 22.1.1.2 Array(len)
@@ -73,6 +75,7 @@ JSTaggedValue BuiltinsArray::ArrayConstructor(EcmaRuntimeCallInfo *argv)
         // 6. Let array be ArrayCreate(0, proto).
         uint32_t newLen = 0;
         JSHandle<JSObject> newArrayHandle(JSArray::ArrayCreate(thread, JSTaggedNumber(newLen), newTarget));
+        JSHClass::TransitionElementsKind(thread, newArrayHandle, ElementsKind::PACKED_INT);
         JSHandle<JSTaggedValue> len = GetCallArg(argv, 0);
         // 7. If Type(len) is not Number, then
         //   a. Let defineStatus be CreateDataProperty(array, "0", len).
@@ -93,6 +96,10 @@ JSTaggedValue BuiltinsArray::ArrayConstructor(EcmaRuntimeCallInfo *argv)
             if (JSTaggedNumber(len.GetTaggedValue()).GetNumber() != newLen) {
                 THROW_RANGE_ERROR_AND_RETURN(thread, "The length is out of range.", JSTaggedValue::Exception());
             }
+            // the elements below the length are holes
+            if (newLen > 0) {
+                JSHClass::TransitionElementsKind(thread, newArrayHandle, ElementsKind::HOLEY_INT);
+            }
         }
         JSArray::Cast(*newArrayHandle)->SetArrayLength(thread, newLen);
 
@@ -106,6 +113,12 @@ JSTaggedValue BuiltinsArray::ArrayConstructor(EcmaRuntimeCallInfo *argv)
         THROW_TYPE_ERROR_AND_RETURN(thread, "Failed to create array.", JSTaggedValue::Exception());
     }
     JSHandle<JSObject> newArrayHandle(thread, newArray);
+    // the items are defined below the length of the new array, so its kind is the one of the items
+    ElementsKind kind = ElementsKind::PACKED_INT;
+    for (uint32_t k = 0; k < argc; k++) {
+        kind = MergeElementsKind(kind, TaggedToElementsKind(GetCallArg(argv, k).GetTaggedValue()));
+    }
+    JSHClass::TransitionElementsKind(thread, newArrayHandle, kind);
 
     // 8. Let k be 0.
     // 9. Let items be a zero-origined List containing the argument items in order.
@@ -791,6 +804,15 @@ JSTaggedValue BuiltinsArray::Fill(EcmaRuntimeCallInfo *argv)
         end = argEnd < len ? argEnd : len;
     }
 
+    // the conversions of start and end may have changed the array
+    if (start < end && thisHandle->IsStableJSArray(thread)) {
+        JSTaggedValue result = JSStableArray::Fill(thread, JSHandle<JSArray>::Cast(thisHandle), value,
+                                                   static_cast<uint32_t>(start), static_cast<uint32_t>(end));
+        if (!result.IsHole()) {
+            return result;
+        }
+    }
+
     // 11. Repeat, while k < final
     //   a. Let Pk be ToString(k).
     //   b. Let setStatus be Set(O, Pk, value, true).
@@ -1131,6 +1153,12 @@ JSTaggedValue BuiltinsArray::IndexOf(EcmaRuntimeCallInfo *argv)
     //   b. If k < 0, let k be 0.
     double from = (fromIndex >= 0) ? fromIndex : ((len + fromIndex) >= 0 ? len + fromIndex : 0);
 
+    // the conversion of fromIndex may have changed the array
+    if (thisHandle->IsStableJSArray(thread)) {
+        return JSStableArray::IndexOf(JSHandle<JSArray>::Cast(thisHandle), searchElement, static_cast<uint32_t>(from),
+                                      static_cast<uint32_t>(len));
+    }
+
     // 11. Repeat, while k<len
     //   a. Let kPresent be HasProperty(O, ToString(k)).
     //   b. ReturnIfAbrupt(kPresent).
@@ -1377,6 +1405,13 @@ JSTaggedValue BuiltinsArray::Map(EcmaRuntimeCallInfo *argv)
         THROW_TYPE_ERROR_AND_RETURN(thread, "Failed to create Object.", JSTaggedValue::Exception());
     }
     JSHandle<JSObject> newArrayHandle(thread, newArray);
+    // a new array without elements has only holes, the mapped values generalize its elements kind
+    if (newArray.IsStableJSArray(thread) &&
+        TaggedArray::Cast(newArrayHandle->GetElements().GetTaggedObject())->GetLength() == 0) {
+        bool isEmpty = JSArray::Cast(*newArrayHandle)->GetArrayLength() == 0;
+        JSHClass::TransitionElementsKind(thread, newArrayHandle,
+                                         isEmpty ? ElementsKind::PACKED_INT : ElementsKind::HOLEY_INT);
+    }
 
     // 9. Let k be 0.
     // 10. Repeat, while k < len
@@ -1393,13 +1428,23 @@ JSTaggedValue BuiltinsArray::Map(EcmaRuntimeCallInfo *argv)
     //   e. Increase k by 1.
     JSMutableHandle<JSTaggedValue> key(thread, JSTaggedValue::Undefined());
     JSMutableHandle<JSTaggedValue> mapResultHandle(thread, JSTaggedValue::Undefined());
+    JSMutableHandle<JSTaggedValue> kValue(thread, JSTaggedValue::Undefined());
     uint32_t k = 0;
     while (k < len) {
-        bool exists = JSTaggedValue::HasProperty(thread, thisObjVal, k);
-        RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-        if (exists) {
-            JSHandle<JSTaggedValue> kValue = JSArray::FastGetPropertyByValue(thread, thisObjVal, k);
+        bool exists = false;
+        // the callback may have changed the array, a hole of a stable array is absent on its prototypes as well
+        if (thisObjVal->IsStableJSArray(thread) && k < JSArray::Cast(*thisObjHandle)->GetArrayLength()) {
+            kValue.Update(JSStableArray::GetElement(JSHandle<JSArray>::Cast(thisObjVal), k));
+            exists = !kValue->IsHole();
+        } else {
+            exists = JSTaggedValue::HasProperty(thread, thisObjVal, k);
             RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+            if (exists) {
+                kValue.Update(JSArray::FastGetPropertyByValue(thread, thisObjVal, k).GetTaggedValue());
+                RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+            }
+        }
+        if (exists) {
             key.Update(JSTaggedValue(k));
             const size_t argsLength = 3; // 3: «kValue, k, O»
             JSHandle<JSTaggedValue> undefined = thread->GlobalConstants()->GetHandledUndefined();
@@ -1610,12 +1655,22 @@ JSTaggedValue BuiltinsArray::Reduce(EcmaRuntimeCallInfo *argv)
     //   e. Increase k by 1.
     JSTaggedValue callResult = JSTaggedValue::Undefined();
     JSMutableHandle<JSTaggedValue> key(thread, JSTaggedValue::Undefined());
+    JSMutableHandle<JSTaggedValue> kValue(thread, JSTaggedValue::Undefined());
     while (k < len) {
-        bool exists = (thisHandle->IsTypedArray() || JSTaggedValue::HasProperty(thread, thisObjVal, k));
-        RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-        if (exists) {
-            JSHandle<JSTaggedValue> kValue = JSArray::FastGetPropertyByValue(thread, thisObjVal, k);
+        bool exists = false;
+        // the callback may have changed the array, a hole of a stable array is absent on its prototypes as well
+        if (thisObjVal->IsStableJSArray(thread) && k < JSArray::Cast(*thisObjHandle)->GetArrayLength()) {
+            kValue.Update(JSStableArray::GetElement(JSHandle<JSArray>::Cast(thisObjVal), k));
+            exists = !kValue->IsHole();
+        } else {
+            exists = (thisHandle->IsTypedArray() || JSTaggedValue::HasProperty(thread, thisObjVal, k));
             RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+            if (exists) {
+                kValue.Update(JSArray::FastGetPropertyByValue(thread, thisObjVal, k).GetTaggedValue());
+                RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+            }
+        }
+        if (exists) {
             key.Update(JSTaggedValue(k));
             JSHandle<JSTaggedValue> thisArgHandle = globalConst->GetHandledUndefined();
             const size_t argsLength = 4; // 4: «accumulator, kValue, k, O»
@@ -1995,11 +2050,21 @@ JSTaggedValue BuiltinsArray::Slice(EcmaRuntimeCallInfo *argv)
     JSHandle<JSObject> newArrayHandle(thread, newArray);
 
     if (thisHandle->IsStableJSArray(thread) && newArray.IsStableJSArray(thread)) {
+        // the copy is all the elements of an array without elements
+        bool isEmpty = TaggedArray::Cast(newArrayHandle->GetElements().GetTaggedObject())->GetLength() == 0;
         TaggedArray *destElements = *JSObject::GrowElementsCapacity(thread, newArrayHandle, count);
         TaggedArray *srcElements = TaggedArray::Cast(thisObjHandle->GetElements().GetTaggedObject());
 
+        ElementsKind kind = ElementsKind::PACKED_INT;
         for (uint32_t idx = 0; idx < count; idx++) {
-            destElements->Set(thread, idx, srcElements->Get(k + idx));
+            JSTaggedValue value = srcElements->Get(k + idx);
+            kind = MergeElementsKind(kind, TaggedToElementsKind(value));
+            destElements->Set(thread, idx, value);
+        }
+        if (isEmpty) {
+            JSHClass::TransitionElementsKind(thread, newArrayHandle, kind);
+        } else {
+            JSHClass::UpdateElementsKind(thread, newArrayHandle, kind);
         }
 
         JSHandle<JSArray>::Cast(newArrayHandle)->SetArrayLength(thread, count);
@@ -2134,6 +2199,10 @@ JSTaggedValue BuiltinsArray::Sort(EcmaRuntimeCallInfo *argv)
         THROW_TYPE_ERROR_AND_RETURN(thread, "Callable is false", JSTaggedValue::Exception());
     }
 
+    if (thisHandle->IsStableJSArray(thread)) {
+        return JSStableArray::Sort(thread, JSHandle<JSArray>::Cast(thisHandle), callbackFnHandle);
+    }
+
     // 2. Let len be ToLength(Get(obj, "length")).
     double len = ArrayHelper::GetArrayLength(thread, JSHandle<JSTaggedValue>(thisObjHandle));
     // 3. ReturnIfAbrupt(len).
@@ -2806,6 +2875,12 @@ JSTaggedValue BuiltinsArray::Includes(EcmaRuntimeCallInfo *argv)
     //     b. If k < 0, let k be 0.
     double from = (fromIndex >= 0) ? fromIndex : ((len + fromIndex) >= 0 ? len + fromIndex : 0);
 
+    // the conversion of fromIndex may have changed the array
+    if (thisHandle->IsStableJSArray(thread)) {
+        return JSStableArray::Includes(JSHandle<JSArray>::Cast(thisHandle), searchElement,
+                                       static_cast<uint32_t>(from), static_cast<uint32_t>(len));
+    }
+
     // 10. Repeat, while k < len,
     //     a. Let elementK be ? Get(O, ! ToString(!(k))).
     //     b. If SameValueZero(searchElement, elementK) is true, return true.
@@ -17,6 +17,7 @@
 #include <cmath>
 #include "ecmascript/base/typed_array_helper-inl.h"
 #include "ecmascript/base/typed_array_helper.h"
+#include "ecmascript/base/tim_sort.h"
 #include "ecmascript/builtins/builtins_array.h"
 #include "ecmascript/builtins/builtins_arraybuffer.h"
 #include "ecmascript/ecma_runtime_call_info.h"
@@ -32,12 +33,69 @@
 #include "ecmascript/js_tagged_value-inl.h"
 #include "ecmascript/js_typed_array.h"
 #include "ecmascript/object_factory.h"
+#include "ecmascript/tagged_array-inl.h"
 
 namespace panda::ecmascript::builtins {
 using TypedArrayHelper = base::TypedArrayHelper;
 using BuiltinsArray = builtins::BuiltinsArray;
 using BuiltinsArrayBuffer = builtins::BuiltinsArrayBuffer;
 
+namespace {
+// Sorts a TaggedArray of typed array values through TypedArrayHelper::SortCompare.
+class TypedArraySortAccessor {
+public:
+    TypedArraySortAccessor(JSThread *thread, const JSHandle<TaggedArray> &items, const JSHandle<TaggedArray> &tmp,
+                           const JSHandle<JSTaggedValue> &fn, const JSHandle<JSTaggedValue> &buffer)
+        : thread_(thread), items_(items), tmp_(tmp), fn_(fn), buffer_(buffer),
+          lhs_(thread, JSTaggedValue::Undefined()), rhs_(thread, JSTaggedValue::Undefined())
+    {
+    }
+    ~TypedArraySortAccessor() = default;
+    NO_COPY_SEMANTIC(TypedArraySortAccessor);
+    NO_MOVE_SEMANTIC(TypedArraySortAccessor);
+
+    bool Less(base::SortSlot lhsSlot, uint32_t lhs, base::SortSlot rhsSlot, uint32_t rhs)
+    {
+        if (IsAbrupt()) {
+            return false;
+        }
+        lhs_.Update(Get(lhsSlot, lhs));
+        rhs_.Update(Get(rhsSlot, rhs));
+        int32_t compareResult = TypedArrayHelper::SortCompare(thread_, fn_, buffer_, lhs_, rhs_);
+        return !IsAbrupt() && compareResult < 0;
+    }
+
+    void Move(base::SortSlot dstSlot, uint32_t dst, base::SortSlot srcSlot, uint32_t src)
+    {
+        JSTaggedValue value = Get(srcSlot, src);
+        if (dstSlot == base::SortSlot::MAIN) {
+            items_->Set(thread_, dst, value);
+        } else {
+            tmp_->Set(thread_, dst, value);
+        }
+    }
+
+    bool IsAbrupt() const
+    {
+        return thread_->HasPendingException();
+    }
+
+private:
+    JSTaggedValue Get(base::SortSlot slot, uint32_t index) const
+    {
+        return slot == base::SortSlot::MAIN ? items_->Get(index) : tmp_->Get(index);
+    }
+
+    JSThread *thread_;
+    JSHandle<TaggedArray> items_;
+    JSHandle<TaggedArray> tmp_;
+    JSHandle<JSTaggedValue> fn_;
+    JSHandle<JSTaggedValue> buffer_;
+    JSMutableHandle<JSTaggedValue> lhs_;
+    JSMutableHandle<JSTaggedValue> rhs_;
+};
+}  // namespace
+
 // 22.2.1
 JSTaggedValue BuiltinsTypedArray::TypedArrayBaseConstructor(EcmaRuntimeCallInfo *argv)
 {
@@ -1316,30 +1374,36 @@ JSTaggedValue BuiltinsTypedArray::Sort(EcmaRuntimeCallInfo *argv)
     JSHandle<JSTaggedValue> buffer;
     buffer = JSHandle<JSTaggedValue>(thread, TypedArrayHelper::ValidateTypedArray(thread, thisHandle));
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-    double len = TypedArrayHelper::GetArrayLength(thread, thisObjHandle);
+    uint32_t len = static_cast<uint32_t>(TypedArrayHelper::GetArrayLength(thread, thisObjHandle));
 
     JSHandle<JSTaggedValue> callbackFnHandle = GetCallArg(argv, 0);
+    if (!callbackFnHandle->IsUndefined() && !callbackFnHandle->IsCallable()) {
+        THROW_TYPE_ERROR_AND_RETURN(thread, "Callable is false", JSTaggedValue::Exception());
+    }
+    if (callbackFnHandle->IsUndefined()) {
+        TypedArrayHelper::SortRawElements(thread, thisObjHandle, len);
+        return thisObjHandle.GetTaggedValue();
+    }
 
-    uint32_t i = 0;
-    while (i < len - 1) {
-        uint32_t j = len - 1;
-        while (j > i) {
-            JSHandle<JSTaggedValue> xValue = JSTaggedValue::GetProperty(thread, thisObjVal, j - 1).GetValue();
-            RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-            JSHandle<JSTaggedValue> yValue = JSTaggedValue::GetProperty(thread, thisObjVal, j).GetValue();
-            RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-            int32_t compareResult;
-            compareResult = TypedArrayHelper::SortCompare(thread, callbackFnHandle, buffer, xValue, yValue);
-            RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-            if (compareResult > 0) {
-                JSTaggedValue::SetProperty(thread, thisObjVal, j - 1, yValue, true);
-                RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-                JSTaggedValue::SetProperty(thread, thisObjVal, j, xValue, true);
-                RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-            }
-            j--;
-        }
-        i++;
+    // The comparator may detach the buffer, so sort a private copy of the values and store them back afterwards.
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> items = factory->NewTaggedArray(len);
+    for (uint32_t k = 0; k < len; k++) {
+        JSHandle<JSTaggedValue> kValue = JSTaggedValue::GetProperty(thread, thisObjVal, k).GetValue();
+        RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+        items->Set(thread, k, kValue.GetTaggedValue());
+    }
+    using Sorter = base::TimSort<TypedArraySortAccessor>;
+    JSHandle<TaggedArray> tmp = factory->NewTaggedArray(Sorter::GetTmpLength(len));
+    TypedArraySortAccessor accessor(thread, items, tmp, callbackFnHandle, buffer);
+    Sorter(accessor).Sort(len);
+    RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+
+    JSMutableHandle<JSTaggedValue> kValue(thread, JSTaggedValue::Undefined());
+    for (uint32_t k = 0; k < len; k++) {
+        kValue.Update(items->Get(k));
+        JSTaggedValue::SetProperty(thread, thisObjVal, k, kValue, true);
+        RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
     }
     return JSTaggedValue::ToObject(thread, thisHandle).GetTaggedValue();
 }
@@ -25,6 +25,7 @@
 #include "ecmascript/global_env.h"
 #include "ecmascript/js_array.h"
 #include "ecmascript/js_array_iterator.h"
+#include "ecmascript/js_arraybuffer.h"
 #include "ecmascript/js_handle.h"
 #include "ecmascript/js_hclass.h"
 #include "ecmascript/js_object-inl.h"
@@ -209,6 +210,18 @@ JSTypedArray *CreateTypedArrayFromList(JSThread *thread, const JSHandle<TaggedAr
     return int8arr;
 }
 
+JSTaggedValue SortTypedArray(JSThread *thread, const JSHandle<JSTaggedValue> &obj)
+{
+    auto ecmaRuntimeCallInfo = TestHelper::CreateEcmaRuntimeCallInfo(thread, JSTaggedValue::Undefined(), 4);
+    ecmaRuntimeCallInfo->SetFunction(JSTaggedValue::Undefined());
+    ecmaRuntimeCallInfo->SetThis(obj.GetTaggedValue());
+
+    [[maybe_unused]] auto prev = TestHelper::SetupFrame(thread, ecmaRuntimeCallInfo.get());
+    JSTaggedValue result = TypedArray::Sort(ecmaRuntimeCallInfo.get());
+    TestHelper::TearDownFrame(thread, prev);
+    return result;
+}
+
 
 HWTEST_F_L0(BuiltinsTypedArrayTest, Species)
 {
@@ -295,4 +308,46 @@ HWTEST_F_L0(BuiltinsTypedArrayTest, Includes)
 
     ASSERT_TRUE(!result.JSTaggedValue::ToBoolean()); // new Int8Array[2,3,4].includes(2, -2)
 }
+
+HWTEST_F_L0(BuiltinsTypedArrayTest, SortEmpty)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> array(factory->NewTaggedArray(0));
+    JSHandle<JSTaggedValue> obj(thread, CreateTypedArrayFromList(thread, array));
+
+    JSTaggedValue result = SortTypedArray(thread, obj);  // new Int8Array([]).sort()
+    ASSERT_FALSE(thread->HasPendingException());
+    ASSERT_EQ(result.GetRawData(), obj.GetTaggedValue().GetRawData());
+    ASSERT_EQ(TypedArrayHelper::GetArrayLength(thread, JSHandle<JSObject>(obj)), 0);
+}
+
+HWTEST_F_L0(BuiltinsTypedArrayTest, SortOneElement)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> array(factory->NewTaggedArray(1));
+    array->Set(thread, 0, JSTaggedValue(5));  // 5: test case
+    JSHandle<JSTaggedValue> obj(thread, CreateTypedArrayFromList(thread, array));
+
+    JSTaggedValue result = SortTypedArray(thread, obj);  // new Int8Array([5]).sort()
+    ASSERT_FALSE(thread->HasPendingException());
+    ASSERT_EQ(result.GetRawData(), obj.GetTaggedValue().GetRawData());
+    ASSERT_EQ(JSTaggedValue::GetProperty(thread, obj, 0).GetValue()->GetInt(), 5);  // 5: the only element
+}
+
+HWTEST_F_L0(BuiltinsTypedArrayTest, SortDetached)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> array(factory->NewTaggedArray(3));
+    array->Set(thread, 0, JSTaggedValue(3));
+    array->Set(thread, 1, JSTaggedValue(1));
+    array->Set(thread, 2, JSTaggedValue(2));
+    JSHandle<JSTaggedValue> obj(thread, CreateTypedArrayFromList(thread, array));
+    JSHandle<JSTypedArray> typedArray = JSHandle<JSTypedArray>::Cast(obj);
+    JSArrayBuffer::Cast(typedArray->GetViewedArrayBuffer().GetTaggedObject())->Detach(thread);
+
+    JSTaggedValue result = SortTypedArray(thread, obj);
+    ASSERT_TRUE(result.IsException());
+    ASSERT_TRUE(thread->HasPendingException());
+    thread->ClearException();
+}
 }  // namespace panda::test
@@ -113,7 +113,7 @@ int Main(const int argc, const char **argv)
     std::string entry = entrypoint.GetValue();
 
     arg_list_t pandaFileNames = files.GetValue();
-    PassManager passManager(vm, entry);
+    PassManager passManager(vm, entry, runtimeOptions.GetCompilerThreads());
     std::string triple = runtimeOptions.GetTargetTriple();
     std::string outputFileName = runtimeOptions.GetAOTOutputFile();
     size_t optLevel = runtimeOptions.GetOptLevel();
@@ -13,6 +13,23 @@
  * limitations under the License.
  */
 #include "aot_file_manager.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <dirent.h>
+#include <dlfcn.h>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <sys/stat.h>
+#include <utime.h>
+
+#include "ecmascript/jspandafile/js_pandafile.h"
+#include "ecmascript/jspandafile/panda_file_translator.h"
+#include "libpandafile/file.h"
+#include "llvm-c/BitReader.h"
+#include "llvm-c/BitWriter.h"
 #include "llvm_ir_builder.h"
 
 namespace panda::ecmascript::kungfu {
@@ -122,4 +139,185 @@ void AotFileManager::SaveAOTFile(const std::string &filename)
     CollectAOTCodeInfo();
     aotInfo_.Serialize(filename);
 }
+
+namespace {
+// 64-bit FNV-1a, stable across hosts and compiler runs, unlike std::hash
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+uint64_t HashBytes(uint64_t hash, const uint8_t *data, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+uint64_t HashString(uint64_t hash, const std::string &str)
+{
+    // the terminating zero separates consecutive strings
+    return HashBytes(hash, reinterpret_cast<const uint8_t *>(str.c_str()), str.size() + 1);
+}
+
+// the cached IR depends on the compiler that generated it, so every key includes the contents of the binary this code
+// is linked into; a rebuilt compiler never restores the entries of another build
+uint64_t HashCompilerBuild()
+{
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void *>(&HashCompilerBuild), &info) == 0 || info.dli_fname == nullptr) {
+        return 0;
+    }
+    std::ifstream in(info.dli_fname, std::ifstream::binary);
+    if (!in.good()) {
+        return 0;
+    }
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;
+    std::vector<char> buffer(BUFFER_SIZE);
+    uint64_t hash = FNV_OFFSET_BASIS;
+    while (in.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || in.gcount() > 0) {
+        hash = HashBytes(hash, reinterpret_cast<const uint8_t *>(buffer.data()), static_cast<size_t>(in.gcount()));
+    }
+    return hash;
+}
+
+template<class T>
+uint64_t HashValue(uint64_t hash, T value)
+{
+    return HashBytes(hash, reinterpret_cast<const uint8_t *>(&value), sizeof(value));
+}
+}  // namespace
+
+void AotMethodCache::Initialize(const JSPandaFile *jsPandaFile, const std::string &triple, size_t optLevel,
+                                const std::string &profileFile)
+{
+    uint64_t compilerHash = HashCompilerBuild();
+    if (compilerHash == 0) {
+        COMPILER_LOG(ERROR) << "Cannot identify the aot compiler build, aot cache '" << cacheDir_ << "' is disabled";
+        cacheDir_.clear();
+        return;
+    }
+    uint64_t hash = HashValue(FNV_OFFSET_BASIS, compilerHash);
+    hash = HashString(hash, triple);
+    hash = HashValue(hash, static_cast<uint64_t>(optLevel));
+    // a profile only applies to the abc file it was recorded for and lets the lowering of a method depend on its
+    // callees, so with a profile every method depends on the whole file
+    if (!profileFile.empty()) {
+        std::ifstream in(profileFile, std::ifstream::binary);
+        std::string profile((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        hash = HashString(hash, profile);
+        const panda_file::File *pf = jsPandaFile->GetPandaFile();
+        hash = HashBytes(hash, pf->GetBase(), pf->GetHeader()->file_size);
+    }
+    baseKey_ = hash;
+}
+
+uint64_t AotMethodCache::ComputeKey(const MethodPcInfo &methodInfo,
+                                    const std::map<uint32_t, std::string> &strings) const
+{
+    const JSMethod *method = methodInfo.method;
+    uint64_t hash = HashString(baseKey_, CstringConvertToStdString(method->ParseFunctionName()));
+    hash = HashValue(hash, method->GetCallField());
+    hash = HashValue(hash, method->GetNumVregs());
+    // the last pc is the end of the method
+    const auto &pcArray = methodInfo.pcArray;
+    if (!pcArray.empty()) {
+        hash = HashValue(hash, static_cast<uint64_t>(pcArray.back() - pcArray.front()));
+        hash = HashBytes(hash, pcArray.front(), static_cast<size_t>(pcArray.back() - pcArray.front()));
+    }
+    hash = HashValue(hash, static_cast<uint64_t>(methodInfo.regTypes.size()));
+    for (uint64_t type : methodInfo.regTypes) {
+        hash = HashValue(hash, type);
+    }
+    // the code holds the index of a string in the const string table, and type lowering compares property keys
+    // against its contents
+    for (const auto &[index, string] : strings) {
+        hash = HashValue(hash, index);
+        hash = HashString(hash, string);
+    }
+    return hash;
+}
+
+std::string AotMethodCache::GetEntryPath(uint64_t key) const
+{
+    std::stringstream path;
+    // 16: hex digits
+    path << cacheDir_ << "/" << std::hex << std::setw(16) << std::setfill('0') << key << ENTRY_SUFFIX;
+    return path.str();
+}
+
+LLVMModuleRef AotMethodCache::Load(uint64_t key) const
+{
+    std::string entry = GetEntryPath(key);
+    LLVMMemoryBufferRef buffer = nullptr;
+    char *message = nullptr;
+    if (LLVMCreateMemoryBufferWithContentsOfFile(entry.c_str(), &buffer, &message) != 0) {
+        LLVMDisposeMessage(message);
+        return nullptr;
+    }
+    LLVMModuleRef module = nullptr;
+    bool failed = LLVMParseBitcode2(buffer, &module) != 0;
+    LLVMDisposeMemoryBuffer(buffer);
+    if (failed) {
+        COMPILER_LOG(ERROR) << "Cannot read aot cache entry '" << entry << "'";
+        return nullptr;
+    }
+    // the modification time orders the entries for eviction
+    utime(entry.c_str(), nullptr);
+    return module;
+}
+
+void AotMethodCache::Store(uint64_t key, LLVMModuleRef module) const
+{
+    // an entry is written under a temporary name and renamed afterwards, so that a concurrent or interrupted run
+    // never sees a truncated entry
+    std::string entry = GetEntryPath(key);
+    std::string tmp = entry + ".tmp";
+    if (LLVMWriteBitcodeToFile(module, tmp.c_str()) != 0 || std::rename(tmp.c_str(), entry.c_str()) != 0) {
+        std::remove(tmp.c_str());
+        COMPILER_LOG(ERROR) << "Cannot store '" << entry << "' to aot cache";
+    }
+}
+
+void AotMethodCache::Evict() const
+{
+    struct Entry {
+        time_t time;
+        size_t size;
+        std::string path;
+    };
+    DIR *dir = opendir(cacheDir_.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+    std::vector<Entry> entries;
+    size_t totalSize = 0;
+    std::string suffix(ENTRY_SUFFIX);
+    for (struct dirent *file = readdir(dir); file != nullptr; file = readdir(dir)) {
+        std::string name(file->d_name);
+        if (name.size() <= suffix.size() || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+            continue;
+        }
+        std::string path = cacheDir_ + "/" + name;
+        struct stat status {};
+        if (stat(path.c_str(), &status) != 0) {
+            continue;
+        }
+        entries.push_back({status.st_mtime, static_cast<size_t>(status.st_size), path});
+        totalSize += static_cast<size_t>(status.st_size);
+    }
+    closedir(dir);
+    if (totalSize <= maxSize_) {
+        return;
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.time < b.time; });
+    for (const auto &entry : entries) {
+        if (totalSize <= maxSize_) {
+            break;
+        }
+        if (std::remove(entry.path.c_str()) == 0) {
+            totalSize -= entry.size;
+        }
+    }
+}
 }  // namespace panda::ecmascript::kungfu
@@ -15,12 +15,20 @@
 #ifndef ECMASCRIPT_KUNGFU_AOT_FILE_MANAGER_H
 #define ECMASCRIPT_KUNGFU_AOT_FILE_MANAGER_H
 
+#include <map>
+#include <string>
+
 #include "compiler_log.h"
 #include "ecmascript/mem/machine_code.h"
 #include "assembler_module.h"
 #include "llvm_ir_builder.h"
 #include "llvm_codegen.h"
 
+namespace panda::ecmascript {
+class JSPandaFile;
+struct MethodPcInfo;
+}  // namespace panda::ecmascript
+
 namespace panda::ecmascript::kungfu {
 class AotFileManager {
 public:
@@ -56,5 +64,41 @@ private:
     void CollectAOTCodeInfoOfStubs();
     void CollectAOTCodeInfo();
 };
+
+// On-disk cache of the LLVM IR of compiled methods. An entry holds the bitcode of one method and is keyed by a hash
+// of everything that IR depends on: the bytecode of the method, the constant strings it loads, the TS types of its
+// registers, the compiler options and the build of the compiler itself. Methods which are unchanged since an earlier
+// compilation skip the circuit pipeline and IR generation; the LLVM back end still runs on the whole file. Once the
+// entries exceed the size limit, the least recently used ones are evicted.
+class AotMethodCache {
+public:
+    AotMethodCache(const std::string &cacheDir, size_t maxSize) : cacheDir_(cacheDir), maxSize_(maxSize) {}
+    ~AotMethodCache() = default;
+
+    bool IsEnabled() const
+    {
+        return !cacheDir_.empty();
+    }
+
+    // hashes what all methods of a compilation share, disables the cache if the compiler build can not be identified
+    void Initialize(const JSPandaFile *jsPandaFile, const std::string &triple, size_t optLevel,
+                    const std::string &profileFile);
+    // strings maps the const string table index of every string the method loads to its contents
+    uint64_t ComputeKey(const MethodPcInfo &methodInfo, const std::map<uint32_t, std::string> &strings) const;
+    // returns the module of the method, or nullptr if key is not cached
+    LLVMModuleRef Load(uint64_t key) const;
+    void Store(uint64_t key, LLVMModuleRef module) const;
+    // removes the least recently used entries until the cache fits into its size limit again
+    void Evict() const;
+
+private:
+    static constexpr const char *ENTRY_SUFFIX = ".bc";
+
+    std::string GetEntryPath(uint64_t key) const;
+
+    std::string cacheDir_;
+    size_t maxSize_ {0};
+    uint64_t baseKey_ {0};
+};
 }  // namespace panda::ecmascript::kungfu
 #endif // ECMASCRIPT_KUNGFU_AOT_FILE_MANAGER_H
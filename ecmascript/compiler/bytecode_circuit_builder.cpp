@@ -2132,10 +2132,7 @@ void BytecodeCircuitBuilder::BuildCircuit(BytecodeGraph &byteCodeGraph)
                                                               {Circuit::GetCircuitRoot(OpCode(OpCode::CONSTANT_LIST))},
                                                               GateType::NJS_VALUE);
                     } else if (std::holds_alternative<StringId>(input)) {
-                        auto tsLoader = vm_->GetTSLoader();
-                        JSHandle<ConstantPool> newConstPool(vm_->GetJSThread(), constantPool_.GetTaggedValue());
-                        auto string = newConstPool->GetObjectFromCache(std::get<StringId>(input).GetId());
-                        size_t index = tsLoader->AddConstString(string);
+                        uint32_t index = constStringIndexes_.at(std::get<StringId>(input).GetId());
                         inList[i + length] = circuit_.NewGate(OpCode(OpCode::CONSTANT), MachineType::I32, index,
                                                               {Circuit::GetCircuitRoot(OpCode(OpCode::CONSTANT_LIST))},
                                                               GateType::NJS_VALUE);
@@ -2316,9 +2313,6 @@ void BytecodeCircuitBuilder::BuildCircuit(BytecodeGraph &byteCodeGraph)
         byteCodeToJSGate_[value.second] = key;
     }
 
-    // ts loader
-    panda::ecmascript::TSLoader* tsLoader = vm_->GetTSLoader();
-
     // resolve def-site of virtual regs and set all value inputs
     for (auto gate: circuit_.GetAllGates()) {
         auto valueCount = circuit_.GetOpCode(gate).GetInValueCount(circuit_.GetBitField(gate));
@@ -2430,9 +2424,8 @@ void BytecodeCircuitBuilder::BuildCircuit(BytecodeGraph &byteCodeGraph)
                     if (ans == Circuit::NullGate() && bbId == 0) { // entry block
                         // find def-site in function args
                         ASSERT(!acc && reg >= offsetArgs && reg < offsetArgs + argGates.size());
-                        const panda_file::File *pf = file_->GetPandaFile();
                         auto argVreg = reg - offsetArgs;
-                        auto tsType = tsLoader->GetGTFromPandaFile(*pf, argVreg, method_).GetGlobalTSTypeRef();
+                        auto tsType = GetRegType(argVreg);
                         auto index = GetFunctionArgIndex(reg, offsetArgs);
                         circuit_.LoadGatePtr(ans)->SetGateType(static_cast<GateType>(tsType));
                         return argGates.at(index);
@@ -2442,8 +2435,7 @@ void BytecodeCircuitBuilder::BuildCircuit(BytecodeGraph &byteCodeGraph)
                         return defSiteOfReg(bb.iDominator->id, bb.iDominator->end, reg, acc);
                     } else {
                         // def-site already found
-                        const panda_file::File *pf = file_->GetPandaFile();
-                        auto tsType = tsLoader->GetGTFromPandaFile(*pf, reg, method_).GetGlobalTSTypeRef();
+                        auto tsType = GetRegType(reg);
                         circuit_.LoadGatePtr(ans)->SetGateType(static_cast<GateType>(tsType));
                         return ans;
                     }
@@ -2476,6 +2468,12 @@ size_t BytecodeCircuitBuilder::GetFunctionArgIndex(size_t currentVreg, size_t nu
     return (currentVreg - numVregs + CommonArgIdx::NUM_OF_ARGS);
 }
 
+uint64_t BytecodeCircuitBuilder::GetRegType(uint32_t reg) const
+{
+    ASSERT(reg < regTypes_.size());
+    return reg < regTypes_.size() ? regTypes_[reg] : GlobalTSTypeRef::Default().GetGlobalTSTypeRef();
+}
+
 void BytecodeCircuitBuilder::PrintCollectBlockInfo(std::vector<CfgInfo> &bytecodeBlockInfos)
 {
     for (auto iter = bytecodeBlockInfos.begin(); iter != bytecodeBlockInfos.end(); iter++) {
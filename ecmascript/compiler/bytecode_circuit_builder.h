@@ -226,8 +226,9 @@ public:
     explicit BytecodeCircuitBuilder(EcmaVM *vm, const BytecodeTranslationInfo &translationInfo, size_t index, 
                                     bool enableLog)
         : vm_(vm), file_(translationInfo.jsPandaFile), method_(translationInfo.methodPcInfos[index].method),
-        pcArray_(translationInfo.methodPcInfos[index].pcArray), constantPool_(translationInfo.constantPool),
-        enableLog_(enableLog)
+        pcArray_(translationInfo.methodPcInfos[index].pcArray),
+        regTypes_(translationInfo.methodPcInfos[index].regTypes),
+        constStringIndexes_(translationInfo.constStringIndexes), enableLog_(enableLog)
     {
     }
     ~BytecodeCircuitBuilder() = default;
@@ -300,6 +301,7 @@ private:
     GateRef SetGateConstant(const BytecodeInfo &info);
     void PrintCollectBlockInfo(std::vector<CfgInfo> &bytecodeBlockInfos);
     size_t GetFunctionArgIndex(size_t currentVreg, size_t numVregs) const;
+    uint64_t GetRegType(uint32_t reg) const;
     void PrintGraph(std::vector<BytecodeRegion> &graph);
     void PrintBytecodeInfo(std::vector<BytecodeRegion> &graph);
     void PrintBBInfo(std::vector<BytecodeRegion> &graph);
@@ -325,7 +327,8 @@ private:
     const JSPandaFile* file_ {nullptr};
     const JSMethod* method_ {nullptr};
     const std::vector<uint8_t *> pcArray_;
-    JSHandle<JSTaggedValue> constantPool_;
+    const std::vector<uint64_t> &regTypes_;
+    const std::vector<uint32_t> &constStringIndexes_;
     bool enableLog_ {false};
 };
 }  // namespace panda::ecmascript::kungfu
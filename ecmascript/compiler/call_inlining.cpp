@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "call_inlining.h"
+
+#include "ecmascript/ic/invoke_cache.h"
+#include "ecmascript/js_function.h"
+#include "slowpath_lowering.h"
+#include "type_lowering.h"
+
+namespace panda::ecmascript::kungfu {
+size_t CallInlining::Run()
+{
+    size_t inlined = 0;
+    const auto &gateList = circuit_->GetAllGates();
+    for (const auto &gate : gateList) {
+        if (circuit_->GetOpCode(gate) == OpCode::JS_BYTECODE && TryInline(gate)) {
+            inlined++;
+        }
+    }
+
+    if (IsLogEnabled()) {
+        COMPILER_LOG(INFO) << "CallInlining inlined " << inlined << " call sites";
+        COMPILER_LOG(INFO) << "=========================================================";
+        circuit_->PrintAllGates(*bcBuilder_);
+    }
+    return inlined;
+}
+
+bool CallInlining::GetCallInfo(GateRef gate, CallInfo *info)
+{
+    auto pc = bcBuilder_->GetJSBytecode(gate);
+    size_t numValueIn = acc_.GetNumValueIn(gate);
+    size_t firstArg = 1;
+    switch (static_cast<EcmaOpcode>(*pc)) {
+        case CALLARG0DYN_PREF_V8:
+        case CALLARG1DYN_PREF_V8_V8:
+        case CALLARGS2DYN_PREF_V8_V8_V8:
+        case CALLARGS3DYN_PREF_V8_V8_V8_V8:
+            info->thisObj = builder_.Undefined();
+            break;
+        case CALLITHISRANGEDYN_PREF_IMM16_V8:
+            // the first register input is callTarget, the second one is thisObj
+            info->thisObj = acc_.GetValueIn(gate, 1);
+            firstArg = 2;  // 2: skip callTarget and thisObj
+            break;
+        default:
+            return false;
+    }
+    info->func = acc_.GetValueIn(gate, 0);
+    for (size_t i = firstArg; i < numValueIn; i++) {
+        info->args.emplace_back(acc_.GetValueIn(gate, i));
+    }
+    return true;
+}
+
+bool CallInlining::IsInlinableBytecode(EcmaOpcode opcode)
+{
+    switch (opcode) {
+        case LDNAN_PREF:
+        case LDINFINITY_PREF:
+        case LDUNDEFINED_PREF:
+        case LDNULL_PREF:
+        case LDTRUE_PREF:
+        case LDFALSE_PREF:
+        case LDHOLE_PREF:
+        case LDAI_DYN_IMM32:
+        case FLDAI_DYN_IMM64:
+        case LDA_STR_ID32:
+        case LDFUNCTION_PREF:
+        case LDGLOBALTHIS_PREF:
+        case JMP_IMM8:
+        case JMP_IMM16:
+        case JMP_IMM32:
+        case JEQZ_IMM8:
+        case JEQZ_IMM16:
+        case JNEZ_IMM8:
+        case JNEZ_IMM16:
+        case RETURN_DYN:
+        case RETURNUNDEFINED_PREF:
+        case ADD2DYN_PREF_V8:
+        case SUB2DYN_PREF_V8:
+        case MUL2DYN_PREF_V8:
+        case DIV2DYN_PREF_V8:
+        case MOD2DYN_PREF_V8:
+        case EQDYN_PREF_V8:
+        case NOTEQDYN_PREF_V8:
+        case STRICTEQDYN_PREF_V8:
+        case STRICTNOTEQDYN_PREF_V8:
+        case LESSDYN_PREF_V8:
+        case LESSEQDYN_PREF_V8:
+        case GREATERDYN_PREF_V8:
+        case GREATEREQDYN_PREF_V8:
+        case SHL2DYN_PREF_V8:
+        case SHR2DYN_PREF_V8:
+        case ASHR2DYN_PREF_V8:
+        case AND2DYN_PREF_V8:
+        case OR2DYN_PREF_V8:
+        case XOR2DYN_PREF_V8:
+        case TONUMBER_PREF_V8:
+        case NEGDYN_PREF_V8:
+        case NOTDYN_PREF_V8:
+        case INCDYN_PREF_V8:
+        case DECDYN_PREF_V8:
+        case TYPEOFDYN_PREF:
+        case ISTRUE_PREF:
+        case ISFALSE_PREF:
+        case CREATEEMPTYOBJECT_PREF:
+        case CREATEEMPTYARRAY_PREF:
+        case LDOBJBYNAME_PREF_ID32_V8:
+        case STOBJBYNAME_PREF_ID32_V8:
+        case LDOBJBYVALUE_PREF_V8_V8:
+        case STOBJBYVALUE_PREF_V8_V8:
+        case LDOBJBYINDEX_PREF_V8_IMM32:
+        case STOBJBYINDEX_PREF_V8_IMM32:
+        case TRYLDGLOBALBYNAME_PREF_ID32:
+        case LDGLOBALVAR_PREF_ID32:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool CallInlining::IsInlinableCircuit(BytecodeCircuitBuilder *calleeBuilder)
+{
+    const Circuit *circuit = calleeBuilder->GetCircuit();
+    size_t numReturns = 0;
+    for (const auto &[gate, bytecode] : calleeBuilder->GetGateToBytecode()) {
+        if (!IsInlinableBytecode(static_cast<EcmaOpcode>(*bytecode.second))) {
+            return false;
+        }
+        if (circuit->GetOpCode(gate) == OpCode::RETURN) {
+            numReturns++;
+        }
+    }
+    if (numReturns == 0 || numReturns > MAX_INLINED_RETURNS) {
+        return false;
+    }
+    // exception handlers read the pending exception of the frame
+    for (const auto &gate : circuit->GetAllGates()) {
+        if (circuit->GetOpCode(gate) == OpCode::GET_EXCEPTION) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CallInlining::TryInline(GateRef gate)
+{
+    CallInfo info;
+    if (!GetCallInfo(gate, &info)) {
+        return false;
+    }
+    uint32_t callerMethodId = method_->GetMethodId().GetOffset();
+    auto offset = static_cast<uint32_t>(bcBuilder_->GetJSBytecode(gate) - method_->GetBytecodeArray());
+    const PGOProfile::CallSiteInfo *site = profile_->GetMonoCallTarget(
+        PGOProfile::GetChecksum(translationInfo_->jsPandaFile), callerMethodId, offset);
+    // recursive calls are left alone, the callee would be the caller itself
+    if (site == nullptr || site->calleeMethodId == callerMethodId) {
+        return false;
+    }
+    auto iter = methodIndexes_->find(site->calleeMethodId);
+    if (iter == methodIndexes_->end()) {
+        return false;
+    }
+    const JSMethod *callee = translationInfo_->methodPcInfos[iter->second].method;
+    if (!InvokeCache::DecideCanBeInlined(callee) || callee->HaveExtraWithCallField()) {
+        return false;
+    }
+
+    BytecodeCircuitBuilder calleeBuilder(bcBuilder_->GetEcmaVM(), *translationInfo_, iter->second, false);
+    calleeBuilder.BytecodeToCircuit();
+    if (!IsInlinableCircuit(&calleeBuilder)) {
+        return false;
+    }
+    TypeLowering typeLowering(&calleeBuilder, calleeBuilder.GetCircuit(), cmpCfg_, tsLoader_, profile_, callee, false);
+    typeLowering.Run();
+    SlowPathLowering slowPathLowering(&calleeBuilder, calleeBuilder.GetCircuit(), cmpCfg_, false);
+    slowPathLowering.CallRuntimeLowering();
+
+    LowerToInlinedCall(gate, info, callee, calleeBuilder.GetCircuit());
+    return true;
+}
+
+std::vector<GateRef> CallInlining::GetCalleeArgs(const JSMethod *callee, const CallInfo &info)
+{
+    GateRef undefined = builder_.Undefined();
+    std::vector<GateRef> args {
+        bcBuilder_->GetCommonArgByIndex(CommonArgIdx::GLUE),
+        builder_.Int32(static_cast<int32_t>(info.args.size() + NUM_MANDATORY_JSFUNC_ARGS)),
+        info.func,
+        undefined,
+        info.thisObj,
+    };
+    // the registers behind the vregs of the callee hold func, newTarget and this if the method reads them, followed
+    // by the declared arguments
+    if (callee->HaveFuncWithCallField()) {
+        args.emplace_back(info.func);
+    }
+    if (callee->HaveNewTargetWithCallField()) {
+        args.emplace_back(undefined);
+    }
+    if (callee->HaveThisWithCallField()) {
+        args.emplace_back(info.thisObj);
+    }
+    uint32_t numDeclaredArgs = callee->GetNumArgsWithCallField();
+    for (uint32_t i = 0; i < numDeclaredArgs; i++) {
+        args.emplace_back(i < info.args.size() ? info.args[i] : undefined);
+    }
+    return args;
+}
+
+GateRef CallInlining::CopyCallee(const Circuit *callee, const std::vector<GateRef> &args)
+{
+    GateRef stateEntry = builder_.GetState();
+    GateRef dependEntry = builder_.GetDepend();
+    std::unordered_map<GateRef, GateRef> gateMap;
+    std::vector<GateRef> copiedGates;
+    std::vector<GateRef> returns;
+    const auto &gateList = callee->GetAllGates();
+    // create the gates first and connect them afterwards, loops refer to gates that come later in the list
+    for (const auto &gate : gateList) {
+        OpCode op = callee->GetOpCode(gate);
+        switch (op) {
+            case OpCode::NOP:
+                break;
+            case OpCode::STATE_ENTRY:
+                gateMap[gate] = stateEntry;
+                break;
+            case OpCode::DEPEND_ENTRY:
+                gateMap[gate] = dependEntry;
+                break;
+            case OpCode::CIRCUIT_ROOT:
+            case OpCode::FRAMESTATE_ENTRY:
+            case OpCode::RETURN_LIST:
+            case OpCode::THROW_LIST:
+            case OpCode::CONSTANT_LIST:
+            case OpCode::ALLOCA_LIST:
+            case OpCode::ARG_LIST:
+                // roots are at the same position in every circuit
+                gateMap[gate] = gate;
+                break;
+            case OpCode::ARG:
+                gateMap[gate] = args.at(callee->GetBitField(gate));
+                break;
+            case OpCode::CONSTANT:
+                gateMap[gate] = circuit_->GetConstantGate(callee->GetMachineType(gate), callee->GetBitField(gate),
+                                                          callee->GetGateType(gate));
+                break;
+            case OpCode::RETURN:
+                returns.emplace_back(gate);
+                break;
+            default: {
+                size_t numIns = op.GetOpCodeNumIns(callee->GetBitField(gate));
+                std::vector<GateRef> inList(numIns, Circuit::NullGate());
+                GateRef newGate = op.GetMachineType() == MachineType::FLEX ?
+                    circuit_->NewGate(op, callee->GetMachineType(gate), callee->GetBitField(gate), inList,
+                                      callee->GetGateType(gate)) :
+                    circuit_->NewGate(op, callee->GetBitField(gate), inList, callee->GetGateType(gate));
+                gateMap[gate] = newGate;
+                copiedGates.emplace_back(gate);
+                break;
+            }
+        }
+    }
+    for (const auto &gate : copiedGates) {
+        size_t numIns = callee->GetOpCode(gate).GetOpCodeNumIns(callee->GetBitField(gate));
+        for (size_t i = 0; i < numIns; i++) {
+            if (!callee->IsInGateNull(gate, i)) {
+                circuit_->NewIn(gateMap.at(gate), i, gateMap.at(callee->GetIn(gate, i)));
+            }
+        }
+    }
+
+    // 0: state, 1: depend, 2: value of RETURN
+    auto getReturnIn = [&](GateRef ret, size_t idx) { return gateMap.at(callee->GetIn(ret, idx)); };
+    Label *label = builder_.GetCurrentLabel();
+    if (returns.size() == 1) {
+        label->SetControl(getReturnIn(returns[0], 0));
+        label->SetDepend(getReturnIn(returns[0], 1));
+        return getReturnIn(returns[0], 2);  // 2: value
+    }
+    std::vector<GateRef> states;
+    for (const auto &ret : returns) {
+        states.emplace_back(getReturnIn(ret, 0));
+    }
+    GateRef merge = circuit_->NewGate(OpCode(OpCode::MERGE), returns.size(), states, GateType::EMPTY);
+    std::vector<GateRef> depends {merge};
+    std::vector<GateRef> values {merge};
+    for (const auto &ret : returns) {
+        depends.emplace_back(getReturnIn(ret, 1));
+        values.emplace_back(getReturnIn(ret, 2));  // 2: value
+    }
+    GateRef dependSelector = circuit_->NewGate(OpCode(OpCode::DEPEND_SELECTOR), returns.size(), depends,
+                                               GateType::EMPTY);
+    GateRef valueSelector = circuit_->NewGate(OpCode(OpCode::VALUE_SELECTOR), MachineType::I64, returns.size(),
+                                              values, GateType::TAGGED_VALUE);
+    label->SetControl(merge);
+    label->SetDepend(dependSelector);
+    return valueSelector;
+}
+
+void CallInlining::LowerToInlinedCall(GateRef gate, const CallInfo &info, const JSMethod *callee,
+                                      const Circuit *calleeCircuit)
+{
+    bool isArch32 = cmpCfg_->Is32Bit();
+    GateRef glue = bcBuilder_->GetCommonArgByIndex(CommonArgIdx::GLUE);
+    GateRef callerFunc = bcBuilder_->GetCommonArgByIndex(CommonArgIdx::FUNC);
+
+    Environment env(gate, circuit_, &builder_);
+    DEFVAlUE(result, (&builder_), VariableType::JS_ANY(), builder_.HoleConstant());
+    Label isHeapObject(&builder_);
+    Label isJSFunction(&builder_);
+    Label sameMethodId(&builder_);
+    Label inlinePath(&builder_);
+    Label slowPath(&builder_);
+    Label successExit(&builder_);
+    Label exceptionExit(&builder_);
+    builder_.Branch(builder_.TaggedIsHeapObject(info.func), &isHeapObject, &slowPath);
+    builder_.Bind(&isHeapObject);
+    builder_.Branch(builder_.IsJsType(info.func, JSType::JS_FUNCTION), &isJSFunction, &slowPath);
+    builder_.Bind(&isJSFunction);
+    GateRef calleeMethod = builder_.Load(VariableType::NATIVE_POINTER(), info.func,
+                                         builder_.IntPtr(JSFunctionBase::METHOD_OFFSET));
+    GateRef literalInfo = builder_.Load(VariableType::INT64(), calleeMethod,
+                                        builder_.IntPtr(JSMethod::GetLiteralInfoOffset(isArch32)));
+    uint64_t methodIdMask = ((1ULL << JSMethod::METHOD_ARGS_METHODID_BITS) - 1) << JSMethod::MethodIdBits::START_BIT;
+    uint64_t methodId = static_cast<uint64_t>(callee->GetMethodId().GetOffset()) << JSMethod::MethodIdBits::START_BIT;
+    builder_.Branch(builder_.Equal(builder_.Int64And(literalInfo, builder_.Int64(methodIdMask)),
+                                   builder_.Int64(methodId)), &sameMethodId, &slowPath);
+    builder_.Bind(&sameMethodId);
+    {
+        // method ids are only unique inside a panda file
+        GateRef callerMethod = builder_.Load(VariableType::NATIVE_POINTER(), callerFunc,
+                                             builder_.IntPtr(JSFunctionBase::METHOD_OFFSET));
+        GateRef fileOffset = builder_.IntPtr(JSMethod::GetJSPandaFileOffset(isArch32));
+        GateRef calleeFile = builder_.Load(VariableType::NATIVE_POINTER(), calleeMethod, fileOffset);
+        GateRef callerFile = builder_.Load(VariableType::NATIVE_POINTER(), callerMethod, fileOffset);
+        builder_.Branch(builder_.Equal(calleeFile, callerFile), &inlinePath, &slowPath);
+    }
+    builder_.Bind(&inlinePath);
+    {
+        result = CopyCallee(calleeCircuit, GetCalleeArgs(callee, info));
+        builder_.Branch(builder_.IsSpecial(*result, JSTaggedValue::VALUE_EXCEPTION), &exceptionExit, &successExit);
+    }
+    builder_.Bind(&slowPath);
+    {
+        auto actualArgc = static_cast<int32_t>(info.args.size() + NUM_MANDATORY_JSFUNC_ARGS);
+        std::vector<GateRef> args {glue, builder_.Int32(actualArgc), info.func, builder_.Undefined(), info.thisObj};
+        args.insert(args.end(), info.args.begin(), info.args.end());
+        result = builder_.CallNGCRuntime(glue, RTSTUB_ID(JSCall), args);
+        builder_.Branch(builder_.IsSpecial(*result, JSTaggedValue::VALUE_EXCEPTION), &exceptionExit, &successExit);
+    }
+    ReplaceHirToSubCfg(gate, &result, &successExit, &exceptionExit);
+}
+
+void CallInlining::ReplaceHirToSubCfg(GateRef hir, Variable *result, Label *successExit, Label *exceptionExit)
+{
+    std::vector<GateRef> successControl;
+    std::vector<GateRef> failControl;
+    GateRef value;
+    builder_.Bind(successExit);
+    {
+        value = **result;
+        successControl.emplace_back(builder_.GetState());
+        successControl.emplace_back(builder_.GetDepend());
+    }
+    builder_.Bind(exceptionExit);
+    {
+        failControl.emplace_back(builder_.GetState());
+        failControl.emplace_back(builder_.GetDepend());
+    }
+    acc_.ReplaceHirToSubCfg(hir, value, successControl, failControl);
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_CALL_INLINING_H
+#define ECMASCRIPT_COMPILER_CALL_INLINING_H
+
+#include <unordered_map>
+
+#include "bytecode_circuit_builder.h"
+#include "circuit.h"
+#include "circuit_builder.h"
+#include "circuit_builder-inl.h"
+#include "gate_accessor.h"
+#include "ecmascript/pgo_profiler/pgo_profiler.h"
+#include "ecmascript/ts_types/ts_loader.h"
+
+namespace panda::ecmascript::kungfu {
+// CallInlining runs before SlowPathLowering and inlines the callee of a call bytecode whose site only ever called
+// one small method of the same panda file in the profiled run:
+//     if (func is a JSFunction whose method has the profiled method id and panda file) {
+//         lowered circuit of the callee, with its arguments replaced by the values of the call
+//     } else {
+//         JSCall, as SlowPathLowering would emit
+//     }
+// The callee is built and lowered on a circuit of its own and copied into the caller; its RETURN gates are merged
+// into the exits of the call. Callees that could observe their frame (calls, lexical environments, generators,
+// exception handlers, arguments objects) are not inlined.
+class CallInlining {
+public:
+    CallInlining(BytecodeCircuitBuilder *bcBuilder, Circuit *circuit, CompilationConfig *cmpCfg, TSLoader *tsLoader,
+                 const PGOProfile *profile, const JSMethod *method, const BytecodeTranslationInfo *translationInfo,
+                 const std::unordered_map<uint32_t, size_t> *methodIndexes, bool enableLog)
+        : bcBuilder_(bcBuilder), circuit_(circuit), acc_(circuit), builder_(circuit, cmpCfg), cmpCfg_(cmpCfg),
+          tsLoader_(tsLoader), profile_(profile), method_(method), translationInfo_(translationInfo),
+          methodIndexes_(methodIndexes), enableLog_(enableLog) {}
+    ~CallInlining() = default;
+
+    // returns the number of inlined call sites
+    size_t Run();
+
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+private:
+    // a callee with more returns than this is not worth the selectors
+    static constexpr size_t MAX_INLINED_RETURNS = 8;
+
+    struct CallInfo {
+        GateRef func {Circuit::NullGate()};
+        GateRef thisObj {Circuit::NullGate()};
+        std::vector<GateRef> args {};
+    };
+
+    bool TryInline(GateRef gate);
+    bool GetCallInfo(GateRef gate, CallInfo *info);
+    static bool IsInlinableBytecode(EcmaOpcode opcode);
+    static bool IsInlinableCircuit(BytecodeCircuitBuilder *calleeBuilder);
+    // environment must be initialized
+    std::vector<GateRef> GetCalleeArgs(const JSMethod *callee, const CallInfo &info);
+    GateRef CopyCallee(const Circuit *callee, const std::vector<GateRef> &args);
+    void LowerToInlinedCall(GateRef gate, const CallInfo &info, const JSMethod *callee, const Circuit *calleeCircuit);
+    void ReplaceHirToSubCfg(GateRef hir, Variable *result, Label *successExit, Label *exceptionExit);
+
+    BytecodeCircuitBuilder *bcBuilder_;
+    Circuit *circuit_;
+    GateAccessor acc_;
+    CircuitBuilder builder_;
+    CompilationConfig *cmpCfg_;
+    TSLoader *tsLoader_;
+    const PGOProfile *profile_;
+    const JSMethod *method_;
+    const BytecodeTranslationInfo *translationInfo_;
+    // method id -> index in translationInfo_->methodPcInfos
+    const std::unordered_map<uint32_t, size_t> *methodIndexes_;
+    bool enableLog_ {false};
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_CALL_INLINING_H
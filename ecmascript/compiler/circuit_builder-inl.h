@@ -67,6 +67,17 @@ GateRef CircuitBuilder::TaggedCastToIntPtr(GateRef x)
     return cmpCfg_->Is32Bit() ? TaggedCastToInt32(x) : TaggedCastToInt64(x);
 }
 
+GateRef CircuitBuilder::IntPtrAnd(GateRef x, GateRef y)
+{
+    return cmpCfg_->Is32Bit() ? Int32And(x, y) : Int64And(x, y);
+}
+
+GateRef CircuitBuilder::IntPtrLSR(GateRef x, GateRef y)
+{
+    auto ptrSize = cmpCfg_->Is32Bit() ? MachineType::I32 : MachineType::I64;
+    return BinaryArithmetic(OpCode(OpCode::LSR), ptrSize, x, y);
+}
+
 GateRef CircuitBuilder::TaggedCastToDouble(GateRef x)
 {
     GateRef tagged = ChangeTaggedPointerToInt64(x);
@@ -342,6 +353,51 @@ GateRef CircuitBuilder::IsDictionaryElement(GateRef hClass)
         Int32(0));
 }
 
+GateRef CircuitBuilder::GetLayoutFromHClass(GateRef hClass)
+{
+    GateRef attrOffset = IntPtr(JSHClass::LAYOUT_OFFSET);
+    return Load(VariableType::JS_POINTER(), hClass, attrOffset);
+}
+
+GateRef CircuitBuilder::GetNumberOfPropsFromHClass(GateRef hClass)
+{
+    GateRef bitfield = Load(VariableType::INT32(), hClass, IntPtr(JSHClass::BIT_FIELD1_OFFSET));
+    return Int32And(Int32LSR(bitfield,
+        Int32(JSHClass::NumberOfPropsBits::START_BIT)),
+        Int32((1LLU << JSHClass::NumberOfPropsBits::SIZE) - 1));
+}
+
+GateRef CircuitBuilder::GetInlinedPropsStartFromHClass(GateRef hClass)
+{
+    GateRef bitfield = Load(VariableType::INT32(), hClass, IntPtr(JSHClass::BIT_FIELD1_OFFSET));
+    return Int32And(Int32LSR(bitfield,
+        Int32(JSHClass::InlinedPropsStartBits::START_BIT)),
+        Int32((1LU << JSHClass::InlinedPropsStartBits::SIZE) - 1));
+}
+
+GateRef CircuitBuilder::IsAccessor(GateRef attr)
+{
+    return NotEqual(Int32And(Int32LSR(attr,
+        Int32(PropertyAttributes::IsAccessorField::START_BIT)),
+        Int32((1LLU << PropertyAttributes::IsAccessorField::SIZE) - 1)),
+        Int32(0));
+}
+
+GateRef CircuitBuilder::IsInlinedProperty(GateRef attr)
+{
+    return NotEqual(Int32And(Int32LSR(attr,
+        Int32(PropertyAttributes::IsInlinedPropsField::START_BIT)),
+        Int32((1LLU << PropertyAttributes::IsInlinedPropsField::SIZE) - 1)),
+        Int32(0));
+}
+
+GateRef CircuitBuilder::GetOffsetFieldInPropAttr(GateRef attr)
+{
+    return Int32And(Int32LSR(attr,
+        Int32(PropertyAttributes::OffsetField::START_BIT)),
+        Int32((1LLU << PropertyAttributes::OffsetField::SIZE) - 1));
+}
+
 GateRef CircuitBuilder::IsClassConstructor(GateRef object)
 {
     GateRef hClass = LoadHClass(object);
@@ -440,6 +496,28 @@ GateRef CircuitBuilder::IsCallable(GateRef obj)
         Int32(0));
 }
 
+GateRef CircuitBuilder::ObjectAddressToRange(GateRef x)
+{
+    return IntPtrAnd(TaggedCastToIntPtr(x), IntPtr(~panda::ecmascript::DEFAULT_REGION_MASK));
+}
+
+GateRef CircuitBuilder::InYoungGeneration(GateRef region)
+{
+    bool isArch32 = cmpCfg_->Is32Bit();
+    auto offset = isArch32 ? Region::REGION_FLAG_OFFSET_32 : Region::REGION_FLAG_OFFSET_64;
+    GateRef x = Load(VariableType::NATIVE_POINTER(), region, IntPtr(offset));
+    GateRef mask = IntPtr(RegionFlags::IS_IN_YOUNG_GENERATION);
+    return NotEqual(IntPtrAnd(x, mask), IntPtr(0));
+}
+
+GateRef CircuitBuilder::GetBitMask(GateRef bitoffset)
+{
+    // IndexInWord(bitOffset) = bitOffset & BIT_PER_WORD_MASK
+    GateRef indexInWord = Int32And(bitoffset, Int32(GCBitset::BIT_PER_WORD_MASK));
+    // Mask(indexInWord) = 1 << index
+    return Int32LSL(Int32(1), indexInWord);
+}
+
 int CircuitBuilder::NextVariableId()
 {
     return env_->NextVariableId();
@@ -17,7 +17,9 @@
 #include "ecmascript/compiler/circuit_builder-inl.h"
 #include "ecmascript/js_thread.h"
 #include "ecmascript/js_function.h"
+#include "ecmascript/mem/remembered_set.h"
 #include "ecmascript/compiler/common_stubs.h"
+#include "ecmascript/compiler/gate_accessor.h"
 #include "ecmascript/compiler/rt_call_signature.h"
 #include "include/coretypes/tagged_value.h"
 #include "utils/bit_utils.h"
@@ -365,12 +367,104 @@ void CircuitBuilder::Store(VariableType type, GateRef glue, GateRef base, GateRe
     GateRef ptr = PtrAdd(base, offset);
     GateRef result = GetCircuit()->NewGate(OpCode(OpCode::STORE), 0, { depend, value, ptr }, type.GetGateType());
     label->SetDepend(result);
-    if (type == VariableType::JS_POINTER() || type == VariableType::JS_ANY()) {
-        CallStub(glue, CommonStubCSigns::SetValueWithBarrier, {glue, base, offset, value});
+    if ((type == VariableType::JS_POINTER() || type == VariableType::JS_ANY()) && MayBeHeapObject(value)) {
+        SetValueWithBarrier(glue, base, offset, value);
     }
     return;
 }
 
+// the same filters as Stub::SetValueWithBarrier, only the slow paths leave the compiled code:
+// the first old to new slot of a region allocating its remembered set, and the marking barrier
+void CircuitBuilder::SetValueWithBarrier(GateRef glue, GateRef obj, GateRef offset, GateRef value)
+{
+    Label entry(env_);
+    SubCfgEntry(&entry);
+    Label exit(env_);
+    Label isHeapObject(env_);
+    Label oldToNew(env_);
+    Label checkMarking(env_);
+    Branch(TaggedIsHeapObject(value), &isHeapObject, &exit);
+    Bind(&isHeapObject);
+    {
+        GateRef objectRegion = ObjectAddressToRange(obj);
+        GateRef valueRegion = ObjectAddressToRange(value);
+        GateRef slotAddr = PtrAdd(TaggedCastToIntPtr(obj), offset);
+        GateRef objectNotInYoung = BoolNot(InYoungGeneration(objectRegion));
+        GateRef valueRegionInYoung = InYoungGeneration(valueRegion);
+        Branch(BoolAnd(objectNotInYoung, valueRegionInYoung), &oldToNew, &checkMarking);
+        Bind(&oldToNew);
+        {
+            GateRef loadOffset = IntPtr(Region::GetOldToNewSetOffset(cmpCfg_->Is32Bit()));
+            GateRef oldToNewSet = Load(VariableType::NATIVE_POINTER(), objectRegion, loadOffset);
+            Label isNullPtr(env_);
+            Label notNullPtr(env_);
+            Branch(Equal(oldToNewSet, IntPtr(0)), &isNullPtr, &notNullPtr);
+            Bind(&notNullPtr);
+            {
+                // (slotAddr - this) >> TAGGED_TYPE_SIZE_LOG
+                GateRef bitOffsetPtr = IntPtrLSR(PtrSub(slotAddr, objectRegion), IntPtr(TAGGED_TYPE_SIZE_LOG));
+                GateRef bitOffset = TruncPtrToInt32(bitOffsetPtr);
+                // bitset_[bitOffset >> BIT_PER_WORD_LOG2] |= mask
+                GateRef index = Int32LSR(bitOffset, Int32(GCBitset::BIT_PER_WORD_LOG2));
+                GateRef byteIndex = ZExtInt32ToPtr(Int32Mul(index, Int32(GCBitset::BYTE_PER_WORD)));
+                GateRef bitsetData = PtrAdd(oldToNewSet, IntPtr(RememberedSet::GCBITSET_DATA_OFFSET));
+                GateRef oldsetValue = Load(VariableType::INT32(), bitsetData, byteIndex);
+                GateRef newsetValue = Int32Or(oldsetValue, GetBitMask(bitOffset));
+                Store(VariableType::INT32(), glue, bitsetData, byteIndex, newsetValue);
+                Jump(&checkMarking);
+            }
+            Bind(&isNullPtr);
+            {
+                CallNGCRuntime(glue, RTSTUB_ID(InsertOldToNewRSet), { glue, objectRegion, slotAddr });
+                Jump(&checkMarking);
+            }
+        }
+        Bind(&checkMarking);
+        {
+            Label marking(env_);
+            GateRef stateBitFieldOffset = IntPtr(JSThread::GlueData::GetStateBitFieldOffset(cmpCfg_->Is32Bit()));
+            GateRef stateBitField = Load(VariableType::INT64(), glue, stateBitFieldOffset);
+            Branch(Equal(stateBitField, Int64(0)), &exit, &marking);
+            Bind(&marking);
+            CallNGCRuntime(glue, RTSTUB_ID(MarkingBarrier),
+                { glue, slotAddr, objectRegion, TaggedCastToIntPtr(value), valueRegion });
+            Jump(&exit);
+        }
+    }
+    Bind(&exit);
+    SubCfgExit();
+}
+
+// Smis, doubles and the special values never need a barrier, so the stores of the values known to be one of them,
+// i.e. not pointer typed gates, tagged constants and the results of Stub::IntBuildTaggedWithNoGC, TaggedNGC and
+// DoubleToTaggedNGC, are emitted without it.
+bool CircuitBuilder::MayBeHeapObject(GateRef value) const
+{
+    GateAccessor acc(GetCircuit());
+    if (acc.GetGateType(value) == GateType::TAGGED_NPOINTER) {
+        return false;
+    }
+    if (acc.GetOpCode(value) == OpCode::INT64_TO_TAGGED) {
+        value = acc.GetValueIn(value, 0);
+    }
+    OpCode op = acc.GetOpCode(value);
+    if (op == OpCode::CONSTANT) {
+        return JSTaggedValue(static_cast<JSTaggedType>(GetCircuit()->GetBitField(value))).IsHeapObject();
+    }
+    if (op != OpCode::OR && op != OpCode::ADD) {
+        return true;
+    }
+    GateRef tag = acc.GetValueIn(value, 1);
+    if (acc.GetOpCode(tag) != OpCode::CONSTANT) {
+        return true;
+    }
+    auto tagValue = static_cast<JSTaggedType>(GetCircuit()->GetBitField(tag));
+    if (op == OpCode::OR) {
+        return tagValue != JSTaggedValue::TAG_INT;
+    }
+    return tagValue != JSTaggedValue::DOUBLE_ENCODE_OFFSET;
+}
+
 GateRef CircuitBuilder::Alloca(int size)
 {
     auto allocaList = Circuit::GetCircuitRoot(OpCode(OpCode::ALLOCA_LIST));
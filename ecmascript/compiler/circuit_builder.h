@@ -77,6 +77,7 @@ class Variable;
     V(BoolNot, OpCode::REV, MachineType::I1)                                      \
     V(Int32Not, OpCode::REV, MachineType::I32)                                    \
     V(Int64Not, OpCode::REV, MachineType::I64)                                    \
+    V(ChangeInt32ToFloat64, OpCode::SIGNED_INT_TO_FLOAT, MachineType::F64)        \
     V(CastDoubleToInt64, OpCode::BITCAST, MachineType::I64)                       \
     V(CastInt64ToFloat64, OpCode::BITCAST, MachineType::F64)
 
@@ -259,6 +260,8 @@ public:
     // memory
     inline GateRef Load(VariableType type, GateRef base, GateRef offset);
     void Store(VariableType type, GateRef glue, GateRef base, GateRef offset, GateRef value);
+    void SetValueWithBarrier(GateRef glue, GateRef obj, GateRef offset, GateRef value);
+    bool MayBeHeapObject(GateRef value) const;
 
 #define ARITHMETIC_BINARY_OP_WITH_BITWIDTH(NAME, OPCODEID, MACHINETYPEID)                 \
     inline GateRef NAME(GateRef x, GateRef y)                                             \
@@ -297,6 +300,8 @@ public:
     inline GateRef TaggedCastToInt64(GateRef x);
     inline GateRef TaggedCastToInt32(GateRef x);
     inline GateRef TaggedCastToIntPtr(GateRef x);
+    inline GateRef IntPtrAnd(GateRef x, GateRef y);
+    inline GateRef IntPtrLSR(GateRef x, GateRef y);
     inline GateRef TaggedCastToDouble(GateRef x);
     inline GateRef ChangeTaggedPointerToInt64(GateRef x);
     inline GateRef ChangeInt64ToTagged(GateRef x);
@@ -342,6 +347,12 @@ public:
     inline GateRef GetObjectType(GateRef hClass);
     inline GateRef IsDictionaryModeByHClass(GateRef hClass);
     inline GateRef IsDictionaryElement(GateRef hClass);
+    inline GateRef GetLayoutFromHClass(GateRef hClass);
+    inline GateRef GetNumberOfPropsFromHClass(GateRef hClass);
+    inline GateRef GetInlinedPropsStartFromHClass(GateRef hClass);
+    inline GateRef IsAccessor(GateRef attr);
+    inline GateRef IsInlinedProperty(GateRef attr);
+    inline GateRef GetOffsetFieldInPropAttr(GateRef attr);
     inline GateRef IsClassConstructor(GateRef object);
     inline GateRef IsClassPrototype(GateRef object);
     inline GateRef IsExtensible(GateRef object);
@@ -349,6 +360,10 @@ public:
     inline GateRef IsJsObject(GateRef obj);
     inline GateRef BothAreString(GateRef x, GateRef y);
     inline GateRef IsCallable(GateRef obj);
+    // region operation
+    inline GateRef ObjectAddressToRange(GateRef x);
+    inline GateRef InYoungGeneration(GateRef region);
+    inline GateRef GetBitMask(GateRef bitoffset);
     GateRef GetGlobalObject(GateRef glue);
     GateRef GetFunctionBitFieldFromJSFunction(GateRef function);
     GateRef GetModuleFromFunction(GateRef function);
@@ -23,6 +23,8 @@
 #include <string>
 #include <vector>
 
+#include "os/mutex.h"
+
 namespace panda::ecmascript::kungfu {
 class CompilerLog {
 public:
@@ -44,8 +46,23 @@ public:
         return methods_.find(methodName) != std::string::npos;
     }
 
+    // Counters reported by optimization passes, e.g. the number of gates a pass removed from a method.
+    // Passes of different methods may run on different compiler threads.
+    void AddMethodStatistic(const std::string &methodName, const std::string &item, size_t count)
+    {
+        os::memory::LockHolder lock(statisticsMutex_);
+        methodStatistics_[methodName][item] += count;
+    }
+
+    const std::map<std::string, std::map<std::string, size_t>> &GetMethodStatistics() const
+    {
+        return methodStatistics_;
+    }
+
 private:
     std::string methods_ {"none"};
+    std::map<std::string, std::map<std::string, size_t>> methodStatistics_ {};
+    os::memory::Mutex statisticsMutex_;
 };
 
 class AotLog : public CompilerLog {
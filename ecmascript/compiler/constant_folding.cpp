@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/constant_folding.h"
+
+#include <deque>
+
+#include "ecmascript/ecma_macros.h"
+
+namespace panda::ecmascript::kungfu {
+namespace {
+constexpr size_t BITS_OF_I1 = 1;
+constexpr size_t BITS_OF_I8 = 8;
+constexpr size_t BITS_OF_I16 = 16;
+constexpr size_t BITS_OF_I32 = 32;
+constexpr size_t BITS_OF_I64 = 64;
+
+uint64_t TruncateToBits(uint64_t value, size_t bits)
+{
+    return bits == BITS_OF_I64 ? value : (value & ((1ULL << bits) - 1));
+}
+
+int64_t SignExtendFromBits(uint64_t value, size_t bits)
+{
+    size_t shift = BITS_OF_I64 - bits;
+    return static_cast<int64_t>(value << shift) >> shift;
+}
+
+// CONSTANT bitfields hold integers sign extended to 64 bits (see CircuitBuilder::Int32), except that booleans are
+// 0 or 1. Folded results use the same encoding so that Circuit::GetConstantGate shares them with existing constants.
+BitField EncodeConstant(uint64_t value, size_t bits)
+{
+    if (bits == BITS_OF_I1) {
+        return TruncateToBits(value, bits);
+    }
+    return static_cast<BitField>(SignExtendFromBits(TruncateToBits(value, bits), bits));
+}
+}  // namespace
+
+size_t ConstantFolding::Run()
+{
+    const auto &gateList = circuit_->GetAllGates();
+    std::deque<GateRef> worklist(gateList.begin(), gateList.end());
+    size_t foldedCount = 0;
+    while (!worklist.empty()) {
+        GateRef gate = worklist.front();
+        worklist.pop_front();
+        if (!acc_.HasUses(gate)) {
+            continue;
+        }
+        auto result = Fold(gate);
+        if (!result.has_value()) {
+            continue;
+        }
+        GateRef constant = circuit_->GetConstantGate(circuit_->GetMachineType(gate), result.value(),
+                                                     circuit_->GetGateType(gate));
+        // users may become foldable once this gate is a constant
+        for (auto use : acc_.ConstUses(gate)) {
+            worklist.push_back(use);
+        }
+        acc_.ReplaceAllUses(gate, constant);
+        foldedCount++;
+    }
+
+    if (IsLogEnabled()) {
+        COMPILER_LOG(INFO) << "[ConstantFolding] " << foldedCount << " gates folded";
+    }
+    return foldedCount;
+}
+
+std::optional<BitField> ConstantFolding::Fold(GateRef gate) const
+{
+    OpCode op = acc_.GetOpCode(gate);
+    bool isCompare = false;
+    switch (op) {
+        case OpCode::ADD:
+        case OpCode::SUB:
+        case OpCode::MUL:
+        case OpCode::SDIV:
+        case OpCode::SMOD:
+        case OpCode::UDIV:
+        case OpCode::UMOD:
+        case OpCode::AND:
+        case OpCode::XOR:
+        case OpCode::OR:
+        case OpCode::LSL:
+        case OpCode::LSR:
+        case OpCode::ASR:
+            break;
+        case OpCode::SLT:
+        case OpCode::SLE:
+        case OpCode::SGT:
+        case OpCode::SGE:
+        case OpCode::ULT:
+        case OpCode::ULE:
+        case OpCode::UGT:
+        case OpCode::UGE:
+        case OpCode::EQ:
+        case OpCode::NE:
+            isCompare = true;
+            break;
+        default:
+            return std::nullopt;
+    }
+    GateRef lhs = acc_.GetValueIn(gate, 0);
+    GateRef rhs = acc_.GetValueIn(gate, 1);
+    if (acc_.GetOpCode(lhs) != OpCode::CONSTANT || acc_.GetOpCode(rhs) != OpCode::CONSTANT) {
+        return std::nullopt;
+    }
+    MachineType operandType = circuit_->GetMachineType(lhs);
+    if (operandType != circuit_->GetMachineType(rhs)) {
+        return std::nullopt;
+    }
+    if (!isCompare && operandType != circuit_->GetMachineType(gate)) {
+        return std::nullopt;
+    }
+    size_t bits = GetBitWidth(operandType);
+    if (bits == 0) {
+        return std::nullopt;
+    }
+    uint64_t lhsValue = TruncateToBits(circuit_->GetBitField(lhs), bits);
+    uint64_t rhsValue = TruncateToBits(circuit_->GetBitField(rhs), bits);
+    return isCompare ? FoldCompare(op, lhsValue, rhsValue, bits) : FoldBinaryOp(op, lhsValue, rhsValue, bits);
+}
+
+std::optional<BitField> ConstantFolding::FoldBinaryOp(OpCode op, uint64_t lhs, uint64_t rhs, size_t bits) const
+{
+    int64_t signedLhs = SignExtendFromBits(lhs, bits);
+    int64_t signedRhs = SignExtendFromBits(rhs, bits);
+    int64_t signedMin = SignExtendFromBits(1ULL << (bits - 1), bits);
+    uint64_t result = 0;
+    switch (op) {
+        case OpCode::ADD:
+            result = lhs + rhs;
+            break;
+        case OpCode::SUB:
+            result = lhs - rhs;
+            break;
+        case OpCode::MUL:
+            result = lhs * rhs;
+            break;
+        case OpCode::SDIV:
+        case OpCode::SMOD:
+            if (signedRhs == 0 || (signedLhs == signedMin && signedRhs == -1)) {
+                return std::nullopt;
+            }
+            result = static_cast<uint64_t>(op == OpCode::SDIV ? signedLhs / signedRhs : signedLhs % signedRhs);
+            break;
+        case OpCode::UDIV:
+        case OpCode::UMOD:
+            if (rhs == 0) {
+                return std::nullopt;
+            }
+            result = op == OpCode::UDIV ? lhs / rhs : lhs % rhs;
+            break;
+        case OpCode::AND:
+            result = lhs & rhs;
+            break;
+        case OpCode::XOR:
+            result = lhs ^ rhs;
+            break;
+        case OpCode::OR:
+            result = lhs | rhs;
+            break;
+        case OpCode::LSL:
+        case OpCode::LSR:
+        case OpCode::ASR:
+            if (rhs >= bits) {
+                return std::nullopt;
+            }
+            if (op == OpCode::LSL) {
+                result = lhs << rhs;
+            } else if (op == OpCode::LSR) {
+                result = lhs >> rhs;
+            } else {
+                result = static_cast<uint64_t>(signedLhs >> rhs);
+            }
+            break;
+        default:
+            UNREACHABLE();
+    }
+    return EncodeConstant(result, bits);
+}
+
+std::optional<BitField> ConstantFolding::FoldCompare(OpCode op, uint64_t lhs, uint64_t rhs, size_t bits) const
+{
+    int64_t signedLhs = SignExtendFromBits(lhs, bits);
+    int64_t signedRhs = SignExtendFromBits(rhs, bits);
+    bool result = false;
+    switch (op) {
+        case OpCode::SLT:
+            result = signedLhs < signedRhs;
+            break;
+        case OpCode::SLE:
+            result = signedLhs <= signedRhs;
+            break;
+        case OpCode::SGT:
+            result = signedLhs > signedRhs;
+            break;
+        case OpCode::SGE:
+            result = signedLhs >= signedRhs;
+            break;
+        case OpCode::ULT:
+            result = lhs < rhs;
+            break;
+        case OpCode::ULE:
+            result = lhs <= rhs;
+            break;
+        case OpCode::UGT:
+            result = lhs > rhs;
+            break;
+        case OpCode::UGE:
+            result = lhs >= rhs;
+            break;
+        case OpCode::EQ:
+            result = lhs == rhs;
+            break;
+        case OpCode::NE:
+            result = lhs != rhs;
+            break;
+        default:
+            UNREACHABLE();
+    }
+    return result ? 1 : 0;
+}
+
+size_t ConstantFolding::GetBitWidth(MachineType type) const
+{
+    switch (type) {
+        case MachineType::I1:
+            return BITS_OF_I1;
+        case MachineType::I8:
+            return BITS_OF_I8;
+        case MachineType::I16:
+            return BITS_OF_I16;
+        case MachineType::I32:
+            return BITS_OF_I32;
+        case MachineType::I64:
+            return BITS_OF_I64;
+        case MachineType::ARCH:
+            return cmpCfg_->Is64Bit() ? BITS_OF_I64 : BITS_OF_I32;
+        default:
+            // floating point and untyped values are not folded
+            return 0;
+    }
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_CONSTANT_FOLDING_H
+#define ECMASCRIPT_COMPILER_CONSTANT_FOLDING_H
+
+#include <optional>
+
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/circuit_builder.h"
+#include "ecmascript/compiler/gate_accessor.h"
+
+namespace panda::ecmascript::kungfu {
+// Replaces integer arithmetic, bitwise and comparison gates whose operands are all CONSTANT gates with the
+// equivalent CONSTANT. Only operations whose result is fully defined are folded: division by zero, signed overflow
+// of division and out-of-range shifts are left to the backend. The folded gates lose all their uses and are removed
+// by DeadGateElimination.
+class ConstantFolding {
+public:
+    ConstantFolding(Circuit *circuit, const CompilationConfig *cmpCfg, bool enableLog)
+        : circuit_(circuit), acc_(circuit), cmpCfg_(cmpCfg), enableLog_(enableLog) {}
+    ~ConstantFolding() = default;
+
+    // Returns the number of gates folded.
+    size_t Run();
+
+private:
+    std::optional<BitField> Fold(GateRef gate) const;
+    std::optional<BitField> FoldBinaryOp(OpCode op, uint64_t lhs, uint64_t rhs, size_t bits) const;
+    std::optional<BitField> FoldCompare(OpCode op, uint64_t lhs, uint64_t rhs, size_t bits) const;
+    size_t GetBitWidth(MachineType type) const;
+
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+    Circuit *circuit_;
+    GateAccessor acc_;
+    const CompilationConfig *cmpCfg_;
+    bool enableLog_ {false};
+};
+}  // namespace panda::ecmascript::kungfu
+
+#endif  // ECMASCRIPT_COMPILER_CONSTANT_FOLDING_H
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/dead_gate_elimination.h"
+
+#include <deque>
+
+#include "ecmascript/ecma_macros.h"
+
+namespace panda::ecmascript::kungfu {
+size_t DeadGateElimination::Run()
+{
+    const auto &gateList = circuit_->GetAllGates();
+    std::deque<GateRef> worklist(gateList.begin(), gateList.end());
+    size_t removedCount = 0;
+    while (!worklist.empty()) {
+        GateRef gate = worklist.front();
+        worklist.pop_front();
+        if (!IsRemovable(gate) || acc_.HasUses(gate)) {
+            continue;
+        }
+        size_t numIns = acc_.GetNumIns(gate);
+        for (size_t idx = 0; idx < numIns; idx++) {
+            if (!circuit_->IsInGateNull(gate, idx)) {
+                worklist.push_back(acc_.GetIn(gate, idx));
+            }
+        }
+        circuit_->DeleteGate(gate);
+        removedCount++;
+    }
+
+    if (IsLogEnabled()) {
+        COMPILER_LOG(INFO) << "[DeadGateElimination] " << removedCount << " gates removed";
+    }
+    return removedCount;
+}
+
+bool DeadGateElimination::IsRemovable(GateRef gate) const
+{
+    OpCode op = acc_.GetOpCode(gate);
+    if (op == OpCode::VALUE_SELECTOR) {
+        return true;
+    }
+    // schedulable gates without uses are never placed by the scheduler, deleting them only releases their inputs
+    return op.IsSchedulable() && op != OpCode::CONSTANT;
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_DEAD_GATE_ELIMINATION_H
+#define ECMASCRIPT_COMPILER_DEAD_GATE_ELIMINATION_H
+
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/gate_accessor.h"
+
+namespace panda::ecmascript::kungfu {
+// Deletes floating gates and value selectors that nothing uses, then whatever became unused through them. Unused
+// value selectors are the important case: the scheduler roots them at their merge and would otherwise materialize
+// all of their inputs. CONSTANT gates are kept since Circuit caches and hands them out again.
+class DeadGateElimination {
+public:
+    explicit DeadGateElimination(Circuit *circuit, bool enableLog)
+        : circuit_(circuit), acc_(circuit), enableLog_(enableLog) {}
+    ~DeadGateElimination() = default;
+
+    // Returns the number of gates deleted.
+    size_t Run();
+
+private:
+    bool IsRemovable(GateRef gate) const;
+
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+    Circuit *circuit_;
+    GateAccessor acc_;
+    bool enableLog_ {false};
+};
+}  // namespace panda::ecmascript::kungfu
+
+#endif  // ECMASCRIPT_COMPILER_DEAD_GATE_ELIMINATION_H
@@ -89,6 +89,19 @@ void GateAccessor::ReplaceIn(UsesIterator &useIt, GateRef replaceGate)
     useIt.SetChanged();
 }
 
+void GateAccessor::ReplaceAllUses(GateRef gate, GateRef replaceGate)
+{
+    auto uses = Uses(gate);
+    for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
+        ReplaceIn(useIt, replaceGate);
+    }
+}
+
+bool GateAccessor::HasUses(GateRef gate) const
+{
+    return !circuit_->IsFirstOutNull(gate);
+}
+
 GateType GateAccessor::GetGateType(GateRef gate)
 {
     return circuit_->LoadGatePtr(gate)->GetGateType();
@@ -136,4 +149,61 @@ void GateAccessor::DecreaseIn(UsesIterator &useIt)
     circuit_->DecreaseIn(*useIt, idx);
     useIt.SetChanged();
 }
+
+void GateAccessor::ReplaceHirControlGate(UsesIterator &useIt, GateRef newGate, bool noThrow)
+{
+    ASSERT(GetOpCode(*useIt) == OpCode::IF_SUCCESS || GetOpCode(*useIt) == OpCode::IF_EXCEPTION);
+    if (!noThrow) {
+        auto firstUse = Uses(*useIt).begin();
+        circuit_->ModifyIn(*firstUse, firstUse.GetIndex(), newGate);
+    }
+    DeleteGate(useIt);
+}
+
+void GateAccessor::ReplaceHirToSubCfg(GateRef hir, GateRef outir,
+                                      const std::vector<GateRef> &successControl,
+                                      const std::vector<GateRef> &exceptionControl,
+                                      bool noThrow)
+{
+    if (outir != Circuit::NullGate()) {
+        SetGateType(outir, GetGateType(hir));
+    }
+    auto uses = Uses(hir);
+    for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
+        // replace HIR:IF_SUCCESS/IF_EXCEPTION with control flow in Label successExit/failExit of MIR Circuit
+        if (GetOpCode(*useIt) == OpCode::IF_SUCCESS) {
+            ReplaceHirControlGate(useIt, successControl[0]);
+        } else if (GetOpCode(*useIt) == OpCode::IF_EXCEPTION) {
+            ReplaceHirControlGate(useIt, exceptionControl[0], noThrow);
+        // change depend flow in catch block from HIR:JS_BYTECODE to depend flow in MIR Circuit
+        } else if (GetOpCode(*useIt) == OpCode::DEPEND_SELECTOR) {
+            if (GetOpCode(GetIn(GetIn(*useIt, 0), useIt.GetIndex() - 1)) == OpCode::IF_EXCEPTION) {
+                noThrow ? DeleteExceptionDep(useIt) : ReplaceIn(useIt, exceptionControl[1]);
+            } else {
+                ReplaceIn(useIt, successControl[1]);
+            }
+        } else if (GetOpCode(*useIt) == OpCode::DEPEND_RELAY) {
+            if (GetOpCode(GetIn(*useIt, 0)) == OpCode::IF_EXCEPTION) {
+                ReplaceIn(useIt, exceptionControl[1]);
+            } else {
+                ReplaceIn(useIt, successControl[1]);
+            }
+        // replace normal depend
+        } else if ((GetOpCode(*useIt) == OpCode::JS_BYTECODE) && useIt.GetIndex() == 1) {
+            ReplaceIn(useIt, successControl[1]);
+        // if no catch block, just throw exception(RETURN)
+        } else if ((GetOpCode(*useIt) == OpCode::RETURN) &&
+                    GetOpCode(GetIn(*useIt, 0)) == OpCode::IF_EXCEPTION) {
+            noThrow ? DeleteExceptionDep(useIt) : ReplaceIn(useIt, exceptionControl[1]);
+        // if isThrow..
+        } else if (useIt.GetIndex() == 1) {
+            ReplaceIn(useIt, successControl[1]);
+        // replace data flow with data output in label successExit(valueSelector...)
+        } else {
+            ReplaceIn(useIt, outir);
+        }
+    }
+
+    circuit_->DeleteGate(hir);
+}
 }
\ No newline at end of file
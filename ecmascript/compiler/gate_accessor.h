@@ -323,6 +323,8 @@ public:
     [[nodiscard]] GateRef GetDep(GateRef gate, size_t idx = 0) const;
     void SetDep(GateRef gate, GateRef depGate, size_t idx = 0);
     void ReplaceIn(UsesIterator &useIt, GateRef replaceGate);
+    void ReplaceAllUses(GateRef gate, GateRef replaceGate);
+    [[nodiscard]] bool HasUses(GateRef gate) const;
     // Add for lowering
     [[nodiscard]] GateType GetGateType(GateRef gate);
     void SetGateType(GateRef gate, GateType gt);
@@ -330,8 +332,15 @@ public:
     void DeleteIn(UsesIterator &useIt);
     void DeleteGate(UsesIterator &useIt);
     void DecreaseIn(UsesIterator &useIt);
+    // replace a JS_BYTECODE gate with the sub-cfg built for it, exits hold {state, depend}
+    void ReplaceHirToSubCfg(GateRef hir, GateRef outir,
+                            const std::vector<GateRef> &successControl,
+                            const std::vector<GateRef> &exceptionControl,
+                            bool noThrow = false);
 
 private:
+    void ReplaceHirControlGate(UsesIterator &useIt, GateRef newGate, bool noThrow = false);
+
     [[nodiscard]] ConstUsesIterator ConstUseBegin(GateRef gate) const
     {
         if (circuit_->LoadGatePtrConst(gate)->IsFirstOutNull()) {
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/global_value_numbering.h"
+
+#include "ecmascript/ecma_macros.h"
+
+namespace panda::ecmascript::kungfu {
+size_t GlobalValueNumbering::Run()
+{
+    size_t replacedCount = 0;
+    std::map<ValueKey, GateRef> valueTable;
+    // every pure input is numbered before its uses, so the key of a gate already holds the leaders of its inputs and
+    // a single pass finds all the equivalences
+    for (GateRef gate : ComputeValueOrder()) {
+        auto result = valueTable.emplace(GetValueKey(gate), gate);
+        if (result.second) {
+            continue;
+        }
+        GateRef leader = result.first->second;
+        if (!acc_.HasUses(gate)) {
+            continue;
+        }
+        acc_.ReplaceAllUses(gate, leader);
+        // CONSTANT gates may be cached by the circuit, leave them in place and unused
+        if (acc_.GetOpCode(gate) != OpCode::CONSTANT) {
+            circuit_->DeleteGate(gate);
+        }
+        replacedCount++;
+    }
+
+    if (IsLogEnabled()) {
+        COMPILER_LOG(INFO) << "[GlobalValueNumbering] " << replacedCount << " gates replaced";
+    }
+    return replacedCount;
+}
+
+std::vector<GateRef> GlobalValueNumbering::ComputeValueOrder() const
+{
+    // the post order of a depth first walk along the inputs, i.e. the reverse post order of the value graph. Only the
+    // pure gates are walked, they form no cycles as the loops of the value graph go through the value selectors.
+    std::vector<GateRef> order;
+    std::vector<std::pair<GateRef, size_t>> stack;
+    circuit_->AdvanceTime();
+    for (GateRef root : circuit_->GetAllGates()) {
+        if (circuit_->GetMark(root) != MarkCode::NO_MARK || !IsPure(root)) {
+            continue;
+        }
+        circuit_->SetMark(root, MarkCode::VISITED);
+        stack.emplace_back(root, 0);
+        while (!stack.empty()) {
+            GateRef gate = stack.back().first;
+            size_t idx = stack.back().second;
+            if (idx == acc_.GetNumIns(gate)) {
+                order.emplace_back(gate);
+                stack.pop_back();
+                continue;
+            }
+            stack.back().second++;
+            GateRef in = acc_.GetIn(gate, idx);
+            if (circuit_->GetMark(in) == MarkCode::NO_MARK && IsPure(in)) {
+                circuit_->SetMark(in, MarkCode::VISITED);
+                stack.emplace_back(in, 0);
+            }
+        }
+    }
+    return order;
+}
+
+bool GlobalValueNumbering::IsPure(GateRef gate) const
+{
+    switch (acc_.GetOpCode(gate)) {
+        case OpCode::CONSTANT:
+        case OpCode::ZEXT_TO_INT64:
+        case OpCode::ZEXT_TO_INT32:
+        case OpCode::ZEXT_TO_INT16:
+        case OpCode::ZEXT_TO_ARCH:
+        case OpCode::SEXT_TO_INT64:
+        case OpCode::SEXT_TO_INT32:
+        case OpCode::SEXT_TO_ARCH:
+        case OpCode::TRUNC_TO_INT32:
+        case OpCode::TRUNC_TO_INT1:
+        case OpCode::TRUNC_TO_INT16:
+        case OpCode::REV:
+        case OpCode::ADD:
+        case OpCode::SUB:
+        case OpCode::MUL:
+        case OpCode::EXP:
+        // integer division traps on zero or overflow, and a merged gate may be scheduled above the check guarding
+        // its use, so only the float division is merged
+        case OpCode::FDIV:
+        case OpCode::AND:
+        case OpCode::XOR:
+        case OpCode::OR:
+        case OpCode::LSL:
+        case OpCode::LSR:
+        case OpCode::ASR:
+        case OpCode::SLT:
+        case OpCode::SLE:
+        case OpCode::SGT:
+        case OpCode::SGE:
+        case OpCode::ULT:
+        case OpCode::ULE:
+        case OpCode::UGT:
+        case OpCode::UGE:
+        case OpCode::FLT:
+        case OpCode::FLE:
+        case OpCode::FGT:
+        case OpCode::FGE:
+        case OpCode::EQ:
+        case OpCode::NE:
+        case OpCode::TAGGED_TO_INT64:
+        case OpCode::INT64_TO_TAGGED:
+        case OpCode::SIGNED_INT_TO_FLOAT:
+        case OpCode::UNSIGNED_INT_TO_FLOAT:
+        case OpCode::FLOAT_TO_SIGNED_INT:
+        case OpCode::UNSIGNED_FLOAT_TO_INT:
+        case OpCode::BITCAST:
+            break;
+        default:
+            return false;
+    }
+    size_t numIns = acc_.GetNumIns(gate);
+    for (size_t idx = 0; idx < numIns; idx++) {
+        if (circuit_->IsInGateNull(gate, idx)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+GlobalValueNumbering::ValueKey GlobalValueNumbering::GetValueKey(GateRef gate) const
+{
+    return std::make_tuple(static_cast<OpCode::Op>(acc_.GetOpCode(gate)), circuit_->GetMachineType(gate),
+                           circuit_->GetBitField(gate), circuit_->GetGateType(gate), circuit_->GetInVector(gate));
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_GLOBAL_VALUE_NUMBERING_H
+#define ECMASCRIPT_COMPILER_GLOBAL_VALUE_NUMBERING_H
+
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/gate_accessor.h"
+
+namespace panda::ecmascript::kungfu {
+// Merges pure gates (no state or depend inputs) that compute the same value: same opcode, machine type, bitfield,
+// gate type and inputs. Pure gates float freely and are placed by the scheduler, so any equivalent gate can stand
+// in for another regardless of where it was created. Gates with depend inputs, such as runtime calls and loads,
+// are never merged because the IR carries no effect information that would prove them redundant, and neither are
+// the gates which may trap, e.g. an integer division placed above its zero check.
+class GlobalValueNumbering {
+public:
+    explicit GlobalValueNumbering(Circuit *circuit, bool enableLog)
+        : circuit_(circuit), acc_(circuit), enableLog_(enableLog) {}
+    ~GlobalValueNumbering() = default;
+
+    // Returns the number of gates replaced by an equivalent one.
+    size_t Run();
+
+private:
+    using ValueKey = std::tuple<OpCode::Op, MachineType, BitField, GateType, std::vector<GateRef>>;
+
+    // the pure gates, each after its pure inputs
+    std::vector<GateRef> ComputeValueOrder() const;
+    bool IsPure(GateRef gate) const;
+    ValueKey GetValueKey(GateRef gate) const;
+
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+    Circuit *circuit_;
+    GateAccessor acc_;
+    bool enableLog_ {false};
+};
+}  // namespace panda::ecmascript::kungfu
+
+#endif  // ECMASCRIPT_COMPILER_GLOBAL_VALUE_NUMBERING_H
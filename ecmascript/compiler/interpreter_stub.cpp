@@ -4451,7 +4451,9 @@ DECLARE_ASM_HANDLER(HandleTryLdGlobalByNamePrefId32)
         Branch(TaggedIsHeapObject(handler), &isHeapObject, &ldMiss);
         Bind(&isHeapObject);
         {
-            icResult = LoadGlobal(handler);
+            // LoadICWithHandler loads a property box as well as a property of the prototype chain of the global object
+            GateRef globalObject = GetGlobalObject(glue);
+            icResult = LoadICWithHandler(glue, globalObject, globalObject, handler);
             Branch(TaggedIsHole(*icResult), &ldMiss, &icResultCheck);
         }
         Bind(&ldMiss);
@@ -4542,8 +4544,21 @@ DECLARE_ASM_HANDLER(HandleTryStGlobalByNamePrefId32)
         Branch(TaggedIsHeapObject(handler), &isHeapObject, &stMiss);
         Bind(&isHeapObject);
         {
-            result = StoreGlobal(glue, acc, handler);
-            Branch(TaggedIsHole(*result), &stMiss, &checkResult);
+            Label isPrototypeHandler(env);
+            Label notPrototypeHandler(env);
+            Branch(TaggedIsPrototypeHandler(handler), &isPrototypeHandler, &notPrototypeHandler);
+            Bind(&isPrototypeHandler);
+            {
+                // a setter of the prototype chain of the global object
+                GateRef globalObject = GetGlobalObject(glue);
+                result = ChangeInt64ToTagged(StoreICWithHandler(glue, globalObject, globalObject, acc, handler));
+                Branch(TaggedIsHole(*result), &stMiss, &checkResult);
+            }
+            Bind(&notPrototypeHandler);
+            {
+                result = StoreGlobal(glue, acc, handler);
+                Branch(TaggedIsHole(*result), &stMiss, &checkResult);
+            }
         }
         Bind(&stMiss);
         {
@@ -4621,7 +4636,8 @@ DECLARE_ASM_HANDLER(HandleLdGlobalVarPrefId32)
         Branch(TaggedIsHeapObject(handler), &isHeapObject, &ldMiss);
         Bind(&isHeapObject);
         {
-            result = LoadGlobal(handler);
+            // LoadICWithHandler loads a property box as well as a property of the prototype chain of the global object
+            result = LoadICWithHandler(glue, globalObject, globalObject, handler);
             Branch(TaggedIsHole(*result), &ldMiss, &checkResult);
         }
         Bind(&ldMiss);
@@ -4679,8 +4695,21 @@ DECLARE_ASM_HANDLER(HandleStGlobalVarPrefId32)
         Branch(TaggedIsHeapObject(handler), &isHeapObject, &stMiss);
         Bind(&isHeapObject);
         {
-            result = StoreGlobal(glue, acc, handler);
-            Branch(TaggedIsHole(*result), &stMiss, &checkResult);
+            Label isPrototypeHandler(env);
+            Label notPrototypeHandler(env);
+            Branch(TaggedIsPrototypeHandler(handler), &isPrototypeHandler, &notPrototypeHandler);
+            Bind(&isPrototypeHandler);
+            {
+                // a setter of the prototype chain of the global object
+                GateRef globalObject = GetGlobalObject(glue);
+                result = ChangeInt64ToTagged(StoreICWithHandler(glue, globalObject, globalObject, acc, handler));
+                Branch(TaggedIsHole(*result), &stMiss, &checkResult);
+            }
+            Bind(&notPrototypeHandler);
+            {
+                result = StoreGlobal(glue, acc, handler);
+                Branch(TaggedIsHole(*result), &stMiss, &checkResult);
+            }
         }
         Bind(&stMiss);
         {
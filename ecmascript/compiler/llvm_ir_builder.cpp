@@ -48,6 +48,7 @@
 #pragma GCC diagnostic pop
 #endif
 
+#include "llvm-c/Linker.h"
 #include "llvm/Support/Host.h"
 #include "securec.h"
 #include "utils/logger.h"
@@ -1937,10 +1938,41 @@ LLVMValueRef LLVMModule::AddFunc(const panda::ecmascript::JSMethod *method)
     auto funcType = LLVMFunctionType(returnType, paramTys.data(), paramCount, false); // not variable args
     CString name = method->ParseFunctionName();
     auto function = LLVMAddFunction(module_, name.c_str(), funcType);
+    SetFunction(GetMethodIndex(method), function);
+    return function;
+}
+
+bool LLVMModule::LinkMethodModule(const panda::ecmascript::JSMethod *method, LLVMModuleRef src)
+{
+    std::string name = CstringConvertToStdString(method->ParseFunctionName());
+    LLVMValueRef function = LLVMGetNamedFunction(src, name.c_str());
+    if (function == nullptr || LLVMIsDeclaration(function)) {
+        LLVMDisposeModule(src);
+        return false;
+    }
+    // the globals of the method, e.g. its relocatable data, are named alike in every method module
+    for (LLVMValueRef global = LLVMGetFirstGlobal(src); global != nullptr; global = LLVMGetNextGlobal(global)) {
+        if (!LLVMIsDeclaration(global)) {
+            LLVMSetLinkage(global, LLVMInternalLinkage);
+        }
+    }
+    // methods may share a name, which LLVMAddFunction would have made unique within the module
+    std::string uniqueName = name;
+    for (size_t i = 1; LLVMGetNamedFunction(module_, uniqueName.c_str()) != nullptr; i++) {
+        uniqueName = name + "." + std::to_string(i);
+    }
+    LLVMSetValueName2(function, uniqueName.c_str(), uniqueName.size());
+    if (LLVMLinkModules2(module_, src) != 0) {
+        return false;
+    }
+    SetFunction(GetMethodIndex(method), LLVMGetNamedFunction(module_, uniqueName.c_str()));
+    return true;
+}
+
+size_t LLVMModule::GetMethodIndex(const panda::ecmascript::JSMethod *method)
+{
     auto offsetInPandaFile = method->GetMethodId().GetOffset();
     JSPandaFile *jsPandaFile = const_cast<JSPandaFile *>(method->GetJSPandaFile());
-    size_t index = jsPandaFile->GetIdInConstantPool(offsetInPandaFile);
-    SetFunction(index, function);
-    return function;
+    return jsPandaFile->GetIdInConstantPool(offsetInPandaFile);
 }
 }  // namespace panda::ecmascript::kungfu
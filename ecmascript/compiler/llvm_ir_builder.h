@@ -116,10 +116,21 @@ public:
     void SetUpForCommonStubs();
     void SetUpForBytecodeHandlerStubs();
     LLVMValueRef AddFunc(const panda::ecmascript::JSMethod *method);
+    // links a module which holds only the function of method, e.g. one restored from the aot cache, into this one;
+    // the linker consumes src
+    bool LinkMethodModule(const panda::ecmascript::JSMethod *method, LLVMModuleRef src);
     LLVMModuleRef GetModule() const
     {
         return module_;
     }
+
+    // hands the module over to the caller, who disposes it
+    LLVMModuleRef ReleaseModule()
+    {
+        LLVMModuleRef module = module_;
+        module_ = nullptr;
+        return module;
+    }
     LLVMTypeRef GetFuncType(const CallSignature *stubDescriptor);
 
     void SetFunction(size_t index, LLVMValueRef func)
@@ -163,6 +174,7 @@ private:
     void InitialLLVMFuncTypeAndFuncByModuleCSigns();
     LLVMValueRef AddAndGetFunc(CallSignature *stubDescriptor);
     LLVMTypeRef ConvertLLVMTypeFromVariableType(VariableType type);
+    static size_t GetMethodIndex(const panda::ecmascript::JSMethod *method);
     // index:
     //     stub scenario - sequence of function adding to llvmModule
     //     aot scenario - method Id of function generated by panda files
@@ -17,10 +17,16 @@
 #define ECMASCRIPT_COMPILER_PASS_H
 
 #include "bytecode_circuit_builder.h"
+#include "call_inlining.h"
 #include "common_stubs.h"
+#include "compiler_log.h"
+#include "constant_folding.h"
+#include "dead_gate_elimination.h"
+#include "global_value_numbering.h"
 #include "llvm_codegen.h"
 #include "scheduler.h"
 #include "slowpath_lowering.h"
+#include "type_lowering.h"
 #include "verifier.h"
 
 namespace panda::ecmascript::kungfu {
@@ -66,6 +72,32 @@ private:
     bool enableLog_ {false};
 };
 
+class TypeLoweringPass {
+public:
+    bool Run(PassData* data, bool enableLog, BytecodeCircuitBuilder *builder, CompilationConfig *cmpCfg,
+             TSLoader *tsLoader, const PGOProfile *profile, const JSMethod *method, CompilerLog *log,
+             const std::string &methodName)
+    {
+        TypeLowering lowering(builder, data->GetCircuit(), cmpCfg, tsLoader, profile, method, enableLog);
+        log->AddMethodStatistic(methodName, "TypeLowering", lowering.Run());
+        return true;
+    }
+};
+
+class InliningPass {
+public:
+    bool Run(PassData* data, bool enableLog, BytecodeCircuitBuilder *builder, CompilationConfig *cmpCfg,
+             TSLoader *tsLoader, const PGOProfile *profile, const JSMethod *method,
+             const BytecodeTranslationInfo *translationInfo, const std::unordered_map<uint32_t, size_t> *methodIndexes,
+             CompilerLog *log, const std::string &methodName)
+    {
+        CallInlining inlining(builder, data->GetCircuit(), cmpCfg, tsLoader, profile, method, translationInfo,
+                              methodIndexes, enableLog);
+        log->AddMethodStatistic(methodName, "Inlining", inlining.Run());
+        return true;
+    }
+};
+
 class SlowPathLoweringPass {
 public:
     bool Run(PassData* data, bool enableLog, BytecodeCircuitBuilder *builder, CompilationConfig *cmpCfg)
@@ -76,6 +108,37 @@ public:
     }
 };
 
+class ConstantFoldingPass {
+public:
+    bool Run(PassData* data, bool enableLog, CompilationConfig *cmpCfg, CompilerLog *log,
+             const std::string &methodName)
+    {
+        ConstantFolding folding(data->GetCircuit(), cmpCfg, enableLog);
+        log->AddMethodStatistic(methodName, "ConstantFolding", folding.Run());
+        return true;
+    }
+};
+
+class GlobalValueNumberingPass {
+public:
+    bool Run(PassData* data, bool enableLog, CompilerLog *log, const std::string &methodName)
+    {
+        GlobalValueNumbering gvn(data->GetCircuit(), enableLog);
+        log->AddMethodStatistic(methodName, "GlobalValueNumbering", gvn.Run());
+        return true;
+    }
+};
+
+class DeadGateEliminationPass {
+public:
+    bool Run(PassData* data, bool enableLog, CompilerLog *log, const std::string &methodName)
+    {
+        DeadGateElimination elimination(data->GetCircuit(), enableLog);
+        log->AddMethodStatistic(methodName, "DeadGateElimination", elimination.Run());
+        return true;
+    }
+};
+
 class VerifierPass {
 public:
     bool Run(PassData* data, bool enableLog)
@@ -14,18 +14,25 @@
  */
 #include "pass_manager.h"
 
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
 #include "aot_file_manager.h"
+#include "ecmascript/base/string_helper.h"
 #include "ecmascript/ecma_handle_scope.h"
 #include "ecmascript/js_tagged_value.h"
 #include "ecmascript/jspandafile/js_pandafile_manager.h"
 #include "ecmascript/jspandafile/panda_file_translator.h"
+#include "ecmascript/jspandafile/program_object.h"
 #include "ecmascript/snapshot/mem/snapshot.h"
+#include "ecmascript/taskpool/taskpool.h"
 #include "ecmascript/ts_types/ts_loader.h"
 #include "pass.h"
 
 namespace panda::ecmascript::kungfu {
 bool PassManager::Compile(const std::string &fileName, const std::string &triple,
-                          const std::string &outputFileName, const AotLog &log, size_t optLevel)
+                          const std::string &outputFileName, AotLog &log, size_t optLevel)
 {
     BytecodeTranslationInfo translationInfo;
     [[maybe_unused]] EcmaHandleScope handleScope(vm_->GetJSThread());
@@ -34,40 +41,190 @@ bool PassManager::Compile(const std::string &fileName, const std::string &triple
         COMPILER_LOG(ERROR) << "Cannot execute panda file '" << fileName << "'";
         return false;
     }
+    const std::string snapshotPath = vm_->GetJSOptions().GetSnapshotOutputFile();
+    const std::string profileFile = vm_->GetJSOptions().GetPGOProfileFile();
+    // 1024 * 1024: bytes of a MB
+    AotMethodCache cache(vm_->GetJSOptions().GetAOTCacheDir(),
+                         static_cast<size_t>(vm_->GetJSOptions().GetAOTCacheMaxSize()) * 1024 * 1024);
+    if (cache.IsEnabled()) {
+        cache.Initialize(translationInfo.jsPandaFile, triple, optLevel, profileFile);
+    }
+
     LLVMModule aotModule("aot_file", triple);
     CompilationConfig cmpCfg(triple);
 
     bool enableLog = log.IsAlwaysEnabled();
+    TSLoader *tsLoader = vm_->GetTSLoader();
+    uint32_t threadNum = GetCompilerThreadNum();
+    size_t methodNum = translationInfo.methodPcInfos.size();
+    size_t batchSize = threadNum * METHODS_PER_THREAD_IN_BATCH;
 
-    for (size_t i = 0; i < translationInfo.methodPcInfos.size(); i++) {
-        const JSMethod *method = translationInfo.methodPcInfos[i].method;
-        const std::string methodName(method->GetMethodName());
-        if (!log.IsAlwaysEnabled() && !log.IsAlwaysDisabled()) {  // neither "all" nor "none"
-            enableLog = log.IncludesMethod(fileName, methodName);
+    // ic states and call targets of the profiled run drive type lowering and inlining
+    PGOProfile profile;
+    bool enableInlining = !profileFile.empty() && profile.Load(profileFile);
+    const PGOProfile *loweringProfile = enableInlining ? &profile : nullptr;
+    std::unordered_map<uint32_t, size_t> methodIndexes;
+    for (size_t i = 0; i < methodNum && enableInlining; i++) {
+        methodIndexes[translationInfo.methodPcInfos[i].method->GetMethodId().GetOffset()] = i;
+    }
+
+    MethodCompiler::Context context {vm_, &translationInfo, &cmpCfg, tsLoader, loweringProfile, &methodIndexes, &log};
+    for (size_t begin = 0; begin < methodNum; begin += batchSize) {
+        size_t end = std::min(methodNum, begin + batchSize);
+        std::vector<CompilationUnit> units(end - begin);
+        for (size_t i = begin; i < end; i++) {
+            CompilationUnit &unit = units[i - begin];
+            unit.methodIndex = i;
+            unit.method = translationInfo.methodPcInfos[i].method;
+            const std::string methodName(unit.method->GetMethodName());
+            if (!log.IsAlwaysEnabled() && !log.IsAlwaysDisabled()) {  // neither "all" nor "none"
+                enableLog = log.IncludesMethod(fileName, methodName);
+            }
+            unit.enableLog = enableLog;
+            unit.fullName = fileName + ":" + methodName;
+            if (cache.IsEnabled()) {
+                unit.cacheKey = cache.ComputeKey(translationInfo.methodPcInfos[i],
+                                                 CollectMethodStrings(translationInfo, i));
+                unit.cachedModule = cache.Load(unit.cacheKey);
+            }
         }
 
-        if (enableLog) {
-            COMPILER_LOG(INFO) << "\033[34m" << "aot method [" << fileName << ":"
-                               << methodName << "] log:" << "\033[0m";
+        MethodCompiler compiler(&units, &context);
+        compiler.Run(threadNum);
+
+        // functions are added to the module in method order whatever thread optimized them, which keeps the aot file
+        // identical for any number of compiler threads
+        for (auto &unit : units) {
+            if (!cache.IsEnabled()) {
+                PassRunner<PassData> pipeline(unit.data.get(), unit.enableLog);
+                pipeline.RunPass<LLVMIRGenPass>(&aotModule, unit.method);
+                continue;
+            }
+            // with the cache every method is generated into a module of its own, which is stored as it is
+            LLVMModuleRef methodModule = unit.cachedModule;
+            if (methodModule == nullptr) {
+                LLVMModule module("aot_method", triple);
+                PassRunner<PassData> pipeline(unit.data.get(), unit.enableLog);
+                pipeline.RunPass<LLVMIRGenPass>(&module, unit.method);
+                cache.Store(unit.cacheKey, module.GetModule());
+                methodModule = module.ReleaseModule();
+            } else if (unit.enableLog) {
+                COMPILER_LOG(INFO) << "aot method [" << unit.fullName << "] restored from aot cache";
+            }
+            if (!aotModule.LinkMethodModule(unit.method, methodModule)) {
+                COMPILER_LOG(ERROR) << "Cannot link aot method [" << unit.fullName << "]";
+                return false;
+            }
         }
+    }
+    if (cache.IsEnabled()) {
+        cache.Evict();
+    }
 
-        BytecodeCircuitBuilder builder(vm_, translationInfo, i, enableLog);
-        builder.BytecodeToCircuit();
-        PassData data(builder.GetCircuit());
-        PassRunner<PassData> pipeline(&data, enableLog);
-        pipeline.RunPass<SlowPathLoweringPass>(&builder, &cmpCfg);
-        pipeline.RunPass<VerifierPass>();
-        pipeline.RunPass<SchedulingPass>();
-        pipeline.RunPass<LLVMIRGenPass>(&aotModule, method);
+    if (!log.IsAlwaysDisabled()) {
+        PrintOptimizationStatistics(log);
     }
 
     AotFileManager manager(&aotModule, &log, LOptions(optLevel, true));
     manager.SaveAOTFile(outputFileName);
-    TSLoader *tsLoader = vm_->GetTSLoader();
     SnapShot snapShot(vm_);
     CVector<JSTaggedType> constStringTable = tsLoader->GetConstStringTable();
-    const CString snapshotPath(vm_->GetJSOptions().GetSnapshotOutputFile().c_str());
-    snapShot.Serialize(reinterpret_cast<uintptr_t>(constStringTable.data()), constStringTable.size(), snapshotPath);
+    snapShot.Serialize(reinterpret_cast<uintptr_t>(constStringTable.data()), constStringTable.size(),
+                       CString(snapshotPath.c_str()));
+    return true;
+}
+
+uint32_t PassManager::GetCompilerThreadNum() const
+{
+    if (threadNum_ > 0) {
+        return threadNum_;
+    }
+    return Taskpool::GetCurrentTaskpool()->GetTotalThreadNum() + 1;
+}
+
+void PassManager::PrintOptimizationStatistics(const CompilerLog &log)
+{
+    COMPILER_LOG(INFO) << "\033[34m" << "optimization statistics (gates per pass):" << "\033[0m";
+    for (const auto &[methodName, items] : log.GetMethodStatistics()) {
+        std::string line = methodName + ":";
+        for (const auto &[item, count] : items) {
+            line += " " + item + "=" + std::to_string(count);
+        }
+        COMPILER_LOG(INFO) << line;
+    }
+}
+
+void MethodCompiler::Run(uint32_t threadNum)
+{
+    size_t taskNum = std::min<size_t>(threadNum, units_->size());
+    if (taskNum > 1) {
+        os::memory::LockHolder holder(mutex_);
+        running_ = static_cast<int>(taskNum - 1);
+        for (size_t i = 1; i < taskNum; i++) {
+            Taskpool::GetCurrentTaskpool()->PostTask(std::make_unique<CompileTask>(this));
+        }
+    }
+    ProcessUnits(true);
+    WaitFinished();
+}
+
+void MethodCompiler::ProcessUnits(bool isMain)
+{
+    size_t index = nextUnit_.fetch_add(1, std::memory_order_relaxed);
+    while (index < units_->size()) {
+        CompileUnit(&units_->at(index));
+        index = nextUnit_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (!isMain) {
+        os::memory::LockHolder holder(mutex_);
+        if (--running_ <= 0) {
+            condition_.SignalAll();
+        }
+    }
+}
+
+void MethodCompiler::CompileUnit(CompilationUnit *unit)
+{
+    if (unit->cachedModule != nullptr) {
+        return;
+    }
+    if (unit->enableLog) {
+        COMPILER_LOG(INFO) << "\033[34m" << "aot method [" << unit->fullName << "] log:" << "\033[0m";
+    }
+    unit->builder = std::make_unique<BytecodeCircuitBuilder>(context_->vm, *context_->translationInfo,
+                                                             unit->methodIndex, unit->enableLog);
+    unit->builder->BytecodeToCircuit();
+    unit->data = std::make_unique<PassData>(unit->builder->GetCircuit());
+
+    CompilationConfig *cmpCfg = context_->cmpCfg;
+    CompilerLog *log = context_->log;
+    PassRunner<PassData> pipeline(unit->data.get(), unit->enableLog);
+    pipeline.RunPass<TypeLoweringPass>(unit->builder.get(), cmpCfg, context_->tsLoader, context_->profile,
+                                       unit->method, log, unit->fullName);
+    if (context_->profile != nullptr) {
+        pipeline.RunPass<InliningPass>(unit->builder.get(), cmpCfg, context_->tsLoader, context_->profile,
+                                       unit->method, context_->translationInfo, context_->methodIndexes, log,
+                                       unit->fullName);
+    }
+    pipeline.RunPass<SlowPathLoweringPass>(unit->builder.get(), cmpCfg);
+    pipeline.RunPass<ConstantFoldingPass>(cmpCfg, log, unit->fullName);
+    pipeline.RunPass<GlobalValueNumberingPass>(log, unit->fullName);
+    pipeline.RunPass<DeadGateEliminationPass>(log, unit->fullName);
+    pipeline.RunPass<VerifierPass>();
+    pipeline.RunPass<SchedulingPass>();
+}
+
+void MethodCompiler::WaitFinished()
+{
+    os::memory::LockHolder holder(mutex_);
+    while (running_ > 0) {
+        condition_.Wait(&mutex_);
+    }
+}
+
+bool MethodCompiler::CompileTask::Run([[maybe_unused]] uint32_t threadIndex)
+{
+    compiler_->ProcessUnits(false);
     return true;
 }
 
@@ -92,6 +249,60 @@ bool PassManager::CollectInfoOfPandaFile(const std::string &fileName, std::strin
     JSHandle<JSFunction> mainFunc(vm_->GetJSThread(), program->GetMainFunction());
     JSHandle<JSTaggedValue> constPool(vm_->GetJSThread(), mainFunc->GetConstantPool());
     translateInfo->constantPool = constPool;
+    CollectConstStrings(translateInfo);
+    CollectRegTypes(translateInfo);
     return true;
 }
+
+void PassManager::CollectConstStrings(BytecodeTranslationInfo *translateInfo)
+{
+    // strings enter the table in constant pool order rather than in the order the compiler threads reach them, so
+    // the snapshot is the same for any number of threads
+    TSLoader *tsLoader = vm_->GetTSLoader();
+    ConstantPool *constantPool = ConstantPool::Cast(translateInfo->constantPool->GetTaggedObject());
+    uint32_t length = constantPool->GetLength();
+    translateInfo->constStringIndexes.resize(length, std::numeric_limits<uint32_t>::max());
+    for (uint32_t i = 0; i < length; i++) {
+        JSTaggedValue value = constantPool->GetObjectFromCache(i);
+        if (value.IsString()) {
+            translateInfo->constStringIndexes[i] = static_cast<uint32_t>(tsLoader->AddConstString(value));
+        }
+    }
+}
+
+std::map<uint32_t, std::string> PassManager::CollectMethodStrings(const BytecodeTranslationInfo &translationInfo,
+                                                                 size_t index) const
+{
+    BytecodeCircuitBuilder builder(vm_, translationInfo, index, false);
+    TSLoader *tsLoader = vm_->GetTSLoader();
+    const auto &pcArray = translationInfo.methodPcInfos[index].pcArray;
+    std::map<uint32_t, std::string> strings;
+    // the last pc is the end of the method
+    for (size_t i = 0; i + 1 < pcArray.size(); i++) {
+        BytecodeInfo info = builder.GetBytecodeInfo(pcArray[i]);
+        for (const auto &input : info.inputs) {
+            if (std::holds_alternative<StringId>(input)) {
+                uint32_t stringIndex = translationInfo.constStringIndexes.at(std::get<StringId>(input).GetId());
+                strings[stringIndex] = base::StringHelper::ToStdString(*tsLoader->GetStringById(stringIndex));
+            }
+        }
+    }
+    return strings;
+}
+
+void PassManager::CollectRegTypes(BytecodeTranslationInfo *translateInfo)
+{
+    // reading the type annotations creates handles, so it is done here on the js thread before compilation starts
+    JSThread *thread = vm_->GetJSThread();
+    TSLoader *tsLoader = vm_->GetTSLoader();
+    const panda_file::File *pf = translateInfo->jsPandaFile->GetPandaFile();
+    for (auto &info : translateInfo->methodPcInfos) {
+        [[maybe_unused]] EcmaHandleScope handleScope(thread);
+        uint32_t regNum = info.method->GetNumVregs() + info.method->GetNumArgs();
+        info.regTypes.resize(regNum);
+        for (uint32_t reg = 0; reg < regNum; reg++) {
+            info.regTypes[reg] = tsLoader->GetGTFromPandaFile(*pf, reg, info.method).GetGlobalTSTypeRef();
+        }
+    }
+}
 } // namespace panda::ecmascript::kungfu
@@ -16,23 +16,111 @@
 #ifndef ECMASCRIPT_COMPILER_PASS_MANAGER_H
 #define ECMASCRIPT_COMPILER_PASS_MANAGER_H
 
+#include <atomic>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 #include "compiler_log.h"
 #include "ecmascript/ecma_vm.h"
+#include "ecmascript/taskpool/task.h"
 #include "bytecode_circuit_builder.h"
+#include "os/mutex.h"
+#include "pass.h"
 
 namespace panda::ecmascript::kungfu {
+// A method on its way through the pipeline. Its circuit is built, lowered, optimized and scheduled on one compiler
+// thread; the constant strings and TS types the builder needs are collected beforehand on the main thread.
+struct CompilationUnit {
+    size_t methodIndex {0};
+    const JSMethod *method {nullptr};
+    std::string fullName;
+    bool enableLog {false};
+    std::unique_ptr<BytecodeCircuitBuilder> builder {nullptr};
+    std::unique_ptr<PassData> data {nullptr};
+    uint64_t cacheKey {0};
+    // the IR restored from the aot cache, the unit skips the pipeline then
+    LLVMModuleRef cachedModule {nullptr};
+};
+
+// Compiles a batch of units up to scheduling on the main thread and up to threadNum - 1 taskpool workers. Every
+// unit is processed by exactly one thread and its result only depends on the method and the data collected before
+// compilation, so the output does not depend on how the units were distributed. Nothing here allocates on the VM
+// heap, which is what allows the workers to run while the js thread is busy with its own unit.
+class MethodCompiler {
+public:
+    struct Context {
+        EcmaVM *vm {nullptr};
+        const BytecodeTranslationInfo *translationInfo {nullptr};
+        CompilationConfig *cmpCfg {nullptr};
+        TSLoader *tsLoader {nullptr};
+        // nullptr without a profile, which also disables inlining
+        const PGOProfile *profile {nullptr};
+        const std::unordered_map<uint32_t, size_t> *methodIndexes {nullptr};
+        CompilerLog *log {nullptr};
+    };
+
+    MethodCompiler(std::vector<CompilationUnit> *units, const Context *context)
+        : units_(units), context_(context) {}
+    ~MethodCompiler() = default;
+    NO_COPY_SEMANTIC(MethodCompiler);
+    NO_MOVE_SEMANTIC(MethodCompiler);
+
+    void Run(uint32_t threadNum);
+
+private:
+    class CompileTask : public Task {
+    public:
+        explicit CompileTask(MethodCompiler *compiler) : compiler_(compiler) {}
+        ~CompileTask() override = default;
+        bool Run(uint32_t threadIndex) override;
+
+        NO_COPY_SEMANTIC(CompileTask);
+        NO_MOVE_SEMANTIC(CompileTask);
+
+    private:
+        MethodCompiler *compiler_;
+    };
+
+    void ProcessUnits(bool isMain);
+    void CompileUnit(CompilationUnit *unit);
+    void WaitFinished();
+
+    std::vector<CompilationUnit> *units_;
+    const Context *context_;
+    std::atomic<size_t> nextUnit_ {0};
+    int running_ {0};
+    os::memory::Mutex mutex_;
+    os::memory::ConditionVariable condition_;
+};
+
 class PassManager {
 public:
-    PassManager(EcmaVM* vm, std::string entry) : vm_(vm), entry_(entry) {}
+    PassManager(EcmaVM* vm, std::string entry, uint32_t threadNum = 1)
+        : vm_(vm), entry_(entry), threadNum_(threadNum) {}
     PassManager() = default;
     bool CollectInfoOfPandaFile(const std::string &filename, std::string_view entryPoint,
                                 BytecodeTranslationInfo *translateInfo);
     bool Compile(const std::string &fileName, const std::string &triple, const std::string &outputFileName,
-                 const AotLog &log, size_t optLevel);
+                 AotLog &log, size_t optLevel);
 
 private:
+    // circuits of one batch are alive at the same time, this bounds the memory parallel compilation costs
+    static constexpr size_t METHODS_PER_THREAD_IN_BATCH = 8;
+
+    static void PrintOptimizationStatistics(const CompilerLog &log);
+    void CollectConstStrings(BytecodeTranslationInfo *translateInfo);
+    void CollectRegTypes(BytecodeTranslationInfo *translateInfo);
+    // the const string table index and contents of every string the method loads
+    std::map<uint32_t, std::string> CollectMethodStrings(const BytecodeTranslationInfo &translationInfo,
+                                                         size_t index) const;
+    uint32_t GetCompilerThreadNum() const;
+
     EcmaVM* vm_;
     std::string entry_;
+    // 0: the main thread plus every taskpool thread
+    uint32_t threadNum_ {1};
 };
 }
-#endif
\ No newline at end of file
+#endif
@@ -48,63 +48,12 @@ void SlowPathLowering::CallRuntimeLowering()
     }
 }
 
-void SlowPathLowering::ReplaceHirControlGate(GateAccessor::UsesIterator &useIt, GateRef newGate, bool noThrow)
-{
-    GateAccessor acc(circuit_);
-    ASSERT(acc.GetOpCode(*useIt) == OpCode::IF_SUCCESS || acc.GetOpCode(*useIt) == OpCode::IF_EXCEPTION);
-    if (!noThrow) {
-        auto firstUse = acc.Uses(*useIt).begin();
-        circuit_->ModifyIn(*firstUse, firstUse.GetIndex(), newGate);
-    }
-    acc.DeleteGate(useIt);
-}
-
 void SlowPathLowering::ReplaceHirToSubCfg(GateRef hir, GateRef outir,
                                           const std::vector<GateRef> &successControl,
                                           const std::vector<GateRef> &exceptionControl,
                                           bool noThrow)
 {
-    GateAccessor acc(circuit_);
-    if (outir != Circuit::NullGate()) {
-        acc.SetGateType(outir, acc.GetGateType(hir));
-    }
-    auto uses = acc.Uses(hir);
-    for (auto useIt = uses.begin(); useIt != uses.end(); useIt++) {
-        // replace HIR:IF_SUCCESS/IF_EXCEPTION with control flow in Label successExit/failExit of MIR Circuit
-        if (acc.GetOpCode(*useIt) == OpCode::IF_SUCCESS) {
-            ReplaceHirControlGate(useIt, successControl[0]);
-        } else if (acc.GetOpCode(*useIt) == OpCode::IF_EXCEPTION) {
-            ReplaceHirControlGate(useIt, exceptionControl[0], noThrow);
-        // change depend flow in catch block from HIR:JS_BYTECODE to depend flow in MIR Circuit
-        } else if (acc.GetOpCode(*useIt) == OpCode::DEPEND_SELECTOR) {
-            if (acc.GetOpCode(acc.GetIn(acc.GetIn(*useIt, 0), useIt.GetIndex() - 1)) == OpCode::IF_EXCEPTION) {
-                noThrow ? acc.DeleteExceptionDep(useIt) : acc.ReplaceIn(useIt, exceptionControl[1]);
-            } else {
-                acc.ReplaceIn(useIt, successControl[1]);
-            }
-        } else if (acc.GetOpCode(*useIt) == OpCode::DEPEND_RELAY) {
-            if (acc.GetOpCode(acc.GetIn(*useIt, 0)) == OpCode::IF_EXCEPTION) {
-                acc.ReplaceIn(useIt, exceptionControl[1]);
-            } else {
-                acc.ReplaceIn(useIt, successControl[1]);
-            }
-        // replace normal depend
-        } else if ((acc.GetOpCode(*useIt) == OpCode::JS_BYTECODE) && useIt.GetIndex() == 1) {
-            acc.ReplaceIn(useIt, successControl[1]);
-        // if no catch block, just throw exception(RETURN)
-        } else if ((acc.GetOpCode(*useIt) == OpCode::RETURN) &&
-                    acc.GetOpCode(acc.GetIn(*useIt, 0)) == OpCode::IF_EXCEPTION) {
-            noThrow ? acc.DeleteExceptionDep(useIt) : acc.ReplaceIn(useIt, exceptionControl[1]);
-        // if isThrow..
-        } else if (useIt.GetIndex() == 1) {
-            acc.ReplaceIn(useIt, successControl[1]);
-        // replace data flow with data output in label successExit(valueSelector...)
-        } else {
-            acc.ReplaceIn(useIt, outir);
-        }
-    }
-
-    circuit_->DeleteGate(hir);
+    acc_.ReplaceHirToSubCfg(hir, outir, successControl, exceptionControl, noThrow);
 }
 
 
@@ -1122,6 +1122,30 @@ inline GateRef Stub::IsDictionaryElement(GateRef hClass)
         Int32(0));
 }
 
+inline GateRef Stub::GetElementsKindFromHClass(GateRef hClass)
+{
+    GateRef bitfieldOffset = IntPtr(JSHClass::BIT_FIELD_OFFSET);
+    GateRef bitfield = Load(VariableType::INT32(), hClass, bitfieldOffset);
+    return Int32And(
+        Int32LSR(bitfield, Int32(JSHClass::ElementsKindBits::START_BIT)),
+        Int32((1LU << JSHClass::ElementsKindBits::SIZE) - 1));
+}
+
+inline GateRef Stub::IsHoleyElements(GateRef kind)
+{
+    return Int32NotEqual(Int32And(kind, Int32(ELEMENTS_KIND_HOLEY_BIT)), Int32(0));
+}
+
+// same as JSHClass::IsElementsKindCompatible for a value which is not a hole
+inline GateRef Stub::IsElementsKindCompatible(GateRef kind, GateRef value)
+{
+    GateRef isGeneric = Int32GreaterThanOrEqual(kind, Int32(static_cast<int32_t>(ElementsKind::PACKED_ELEMENTS)));
+    GateRef isDouble = BoolAnd(
+        Int32GreaterThanOrEqual(kind, Int32(static_cast<int32_t>(ElementsKind::PACKED_DOUBLE))),
+        TaggedIsDouble(value));
+    return BoolOr(isGeneric, BoolOr(TaggedIsInt(value), isDouble));
+}
+
 inline GateRef Stub::NotBuiltinsConstructor(GateRef object)
 {
     GateRef hclass = LoadHClass(object);
@@ -995,6 +995,24 @@ GateRef Stub::AddPropertyByName(GateRef glue, GateRef receiver, GateRef key, Gat
         {
             attr = SetIsInlinePropsFieldInPropAttr(*attr, Int32(0));
             GateRef outProps = Int32Sub(numberOfProps, inlinedProperties);
+            Label ChangeToDict(env);
+            Label notChangeToDict(env);
+            // the offsets of the in-object and out-of-object properties together must fit in their bitfield
+            Branch(Int32Equal(numberOfProps, Int32(PropertyAttributes::MAX_CAPACITY_OF_PROPERTIES)),
+                &ChangeToDict, &notChangeToDict);
+            {
+                Bind(&ChangeToDict);
+                {
+                    attr = SetDictionaryOrderFieldInPropAttr(*attr,
+                        Int32(PropertyAttributes::MAX_CAPACITY_OF_PROPERTIES));
+                    GateRef res = CallRuntime(glue, RTSTUB_ID(NameDictPutIfAbsent),
+                        { receiver, *array, key, value, IntBuildTaggedTypeWithNoGC(*attr), TaggedTrue() });
+                    SetPropertiesArray(glue, receiver, res);
+                    result = Undefined(VariableType::INT64());
+                    Jump(&exit);
+                }
+            }
+            Bind(&notChangeToDict);
             Label isArrayFull(env);
             Label arrayNotFull(env);
             Label afterArrLenCon(env);
@@ -1002,26 +1020,6 @@ GateRef Stub::AddPropertyByName(GateRef glue, GateRef receiver, GateRef key, Gat
             {
                 Bind(&isArrayFull);
                 {
-                    Label ChangeToDict(env);
-                    Label notChangeToDict(env);
-                    Label afterDictChangeCon(env);
-                    Branch(Int32Equal(*length, Int32(JSHClass::MAX_CAPACITY_OF_OUT_OBJECTS)),
-                        &ChangeToDict, &notChangeToDict);
-                    {
-                        Bind(&ChangeToDict);
-                        {
-                            attr = SetDictionaryOrderFieldInPropAttr(*attr,
-                                Int32(PropertyAttributes::MAX_CAPACITY_OF_PROPERTIES));
-                            GateRef res = CallRuntime(glue, RTSTUB_ID(NameDictPutIfAbsent),
-                                { receiver, *array, key, value, IntBuildTaggedTypeWithNoGC(*attr), TaggedTrue() });
-                            SetPropertiesArray(glue, receiver, res);
-                            result = Undefined(VariableType::INT64());
-                            Jump(&exit);
-                        }
-                        Bind(&notChangeToDict);
-                        Jump(&afterDictChangeCon);
-                    }
-                    Bind(&afterDictChangeCon);
                     GateRef capacity = ComputePropertyCapacityInJSObj(*length);
                     array = CallRuntime(glue, RTSTUB_ID(CopyArray),
                         { *array, IntBuildTaggedTypeWithNoGC(*length), IntBuildTaggedTypeWithNoGC(capacity) });
@@ -1113,7 +1111,8 @@ void Stub::Store(VariableType type, GateRef glue, GateRef base, GateRef offset,
     } else {
         UNREACHABLE();
     }
-    if (type == VariableType::JS_POINTER() || type == VariableType::JS_ANY()) {
+    if ((type == VariableType::JS_POINTER() || type == VariableType::JS_ANY()) &&
+        env_.GetBuilder().MayBeHeapObject(value)) {
         SetValueWithBarrier(glue, base, offset, value);
     }
     return;
@@ -1672,6 +1671,8 @@ GateRef Stub::ICStoreElement(GateRef glue, GateRef receiver, GateRef key, GateRe
     Label handerInfoNotJSArray(env);
     Label indexGreaterLength(env);
     Label indexGreaterCapacity(env);
+    Label updateLength(env);
+    Label kindCompatible(env);
     Label callRuntime(env);
     Label storeElement(env);
     Label handlerIsInt(env);
@@ -1695,6 +1696,10 @@ GateRef Stub::ICStoreElement(GateRef glue, GateRef receiver, GateRef key, GateRe
         Branch(TaggedIsInt(*varHandler), &handlerIsInt, &handlerNotInt);
         Bind(&handlerIsInt);
         {
+            // a store which generalizes the elements kind takes the slow path to transition the hclass
+            GateRef kind = GetElementsKindFromHClass(LoadHClass(receiver));
+            Branch(IsElementsKindCompatible(kind, value), &kindCompatible, &exit);
+            Bind(&kindCompatible);
             GateRef handlerInfo = TaggedCastToInt32(*varHandler);
             Branch(HandlerBaseIsJSArray(handlerInfo), &handerInfoIsJSArray, &handerInfoNotJSArray);
             Bind(&handerInfoIsJSArray);
@@ -1702,6 +1707,10 @@ GateRef Stub::ICStoreElement(GateRef glue, GateRef receiver, GateRef key, GateRe
                 GateRef oldLength = GetArrayLength(receiver);
                 Branch(Int32GreaterThanOrEqual(index, oldLength), &indexGreaterLength, &handerInfoNotJSArray);
                 Bind(&indexGreaterLength);
+                // a store past the length leaves holes, which a packed kind does not allow
+                Branch(BoolAnd(Int32GreaterThan(index, oldLength), BoolNot(IsHoleyElements(kind))),
+                    &exit, &updateLength);
+                Bind(&updateLength);
                 Store(VariableType::INT64(), glue, receiver,
                     IntPtr(panda::ecmascript::JSArray::LENGTH_OFFSET),
                     IntBuildTaggedWithNoGC(Int32Add(index, Int32(1))));
@@ -2479,6 +2488,11 @@ GateRef Stub::SetPropertyByIndex(GateRef glue, GateRef receiver, GateRef index,
                     }
                     Bind(&notHole);
                     {
+                        // the slow path transitions the elements kind
+                        Label kindCompatible(env);
+                        Branch(IsElementsKindCompatible(GetElementsKindFromHClass(hclass), value),
+                            &kindCompatible, &exit);
+                        Bind(&kindCompatible);
                         SetValueToTaggedArray(VariableType::JS_ANY(), glue, elements, index, value);
                         returnValue = Undefined(VariableType::INT64());
                         Jump(&exit);
@@ -502,6 +502,9 @@ public:
     GateRef IsDictionaryMode(GateRef object);
     GateRef IsDictionaryModeByHClass(GateRef hClass);
     GateRef IsDictionaryElement(GateRef hClass);
+    GateRef GetElementsKindFromHClass(GateRef hClass);
+    GateRef IsHoleyElements(GateRef kind);
+    GateRef IsElementsKindCompatible(GateRef kind, GateRef value);
     GateRef NotBuiltinsConstructor(GateRef object);
     GateRef IsClassConstructor(GateRef object);
     GateRef IsClassPrototype(GateRef object);
@@ -0,0 +1,527 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "type_lowering.h"
+
+#include <algorithm>
+
+#include "ecmascript/base/string_helper.h"
+#include "ecmascript/ecma_string.h"
+#include "ecmascript/layout_info.h"
+
+namespace panda::ecmascript::kungfu {
+size_t TypeLowering::Run()
+{
+    size_t lowered = 0;
+    const auto &gateList = circuit_->GetAllGates();
+    for (const auto &gate : gateList) {
+        if (circuit_->GetOpCode(gate) == OpCode::JS_BYTECODE && Lower(gate)) {
+            lowered++;
+        }
+    }
+
+    if (IsLogEnabled()) {
+        COMPILER_LOG(INFO) << "TypeLowering lowered " << lowered << " bytecodes";
+        COMPILER_LOG(INFO) << "=========================================================";
+        circuit_->PrintAllGates(*bcBuilder_);
+    }
+    return lowered;
+}
+
+bool TypeLowering::Lower(GateRef gate)
+{
+    GateRef glue = bcBuilder_->GetCommonArgByIndex(CommonArgIdx::GLUE);
+
+    auto pc = bcBuilder_->GetJSBytecode(gate);
+    EcmaOpcode op = static_cast<EcmaOpcode>(*pc);
+    switch (op) {
+        case ADD2DYN_PREF_V8:
+            return LowerNumberArithmetic<OpCode::ADD>(gate, glue, RTSTUB_ID(Add2Dyn));
+        case SUB2DYN_PREF_V8:
+            return LowerNumberArithmetic<OpCode::SUB>(gate, glue, RTSTUB_ID(Sub2Dyn));
+        case MUL2DYN_PREF_V8:
+            return LowerNumberArithmetic<OpCode::MUL>(gate, glue, RTSTUB_ID(Mul2Dyn));
+        case LESSDYN_PREF_V8:
+            return LowerNumberComparison<OpCode::SLT>(gate, glue, RTSTUB_ID(LessDyn));
+        case LESSEQDYN_PREF_V8:
+            return LowerNumberComparison<OpCode::SLE>(gate, glue, RTSTUB_ID(LessEqDyn));
+        case GREATERDYN_PREF_V8:
+            return LowerNumberComparison<OpCode::SGT>(gate, glue, RTSTUB_ID(GreaterDyn));
+        case GREATEREQDYN_PREF_V8:
+            return LowerNumberComparison<OpCode::SGE>(gate, glue, RTSTUB_ID(GreaterEqDyn));
+        case LDOBJBYNAME_PREF_ID32_V8:
+            return LowerLdObjByName(gate, glue);
+        case LDOBJBYVALUE_PREF_V8_V8:
+            return LowerArrayLdObjByValue(gate, glue);
+        default:
+            return false;
+    }
+}
+
+TSTypeKind TypeLowering::GetTypeKind(GateRef gate)
+{
+    GateType type = acc_.GetGateType(gate);
+    // MIR types share the encoding space of GlobalTSTypeRef but carry no TS type
+    if (type >= GateType::TAGGED_VALUE && type <= GateType::EMPTY) {
+        return TSTypeKind::TS_ANY;
+    }
+    return TSLoader::GetTypeKind(GlobalTSTypeRef(type));
+}
+
+bool TypeLowering::IsNumberType(GateRef gate)
+{
+    if (circuit_->GetMachineType(gate) != MachineType::I64) {
+        return false;
+    }
+    // integer literals are tagged constants without a TS type
+    if (circuit_->GetOpCode(gate) == OpCode::CONSTANT) {
+        return JSTaggedValue(static_cast<JSTaggedType>(circuit_->GetBitField(gate))).IsNumber();
+    }
+    TSTypeKind kind = GetTypeKind(gate);
+    return kind == TSTypeKind::TS_NUMBER || kind == TSTypeKind::TS_INT;
+}
+
+template<OpCode::Op Op>
+bool TypeLowering::LowerNumberArithmetic(GateRef gate, GateRef glue, int runtimeId)
+{
+    // 2: number of value inputs
+    ASSERT(acc_.GetNumValueIn(gate) == 2);
+    GateRef left = acc_.GetValueIn(gate, 0);
+    GateRef right = acc_.GetValueIn(gate, 1);
+    if (!IsNumberType(left) || !IsNumberType(right)) {
+        return false;
+    }
+
+    Environment env(gate, circuit_, &builder_);
+    DEFVAlUE(result, (&builder_), VariableType::JS_ANY(), builder_.HoleConstant());
+    DEFVAlUE(doubleLeft, (&builder_), VariableType::FLOAT64(), builder_.Double(0));
+    DEFVAlUE(doubleRight, (&builder_), VariableType::FLOAT64(), builder_.Double(0));
+    Label bothInt(&builder_);
+    Label notBothInt(&builder_);
+    Label overflow(&builder_);
+    Label notOverflow(&builder_);
+    Label bothNumber(&builder_);
+    Label doFloatOp(&builder_);
+    Label slowPath(&builder_);
+    Label successExit(&builder_);
+    Label exceptionExit(&builder_);
+    builder_.Branch(builder_.BoolAnd(builder_.TaggedIsInt(left), builder_.TaggedIsInt(right)), &bothInt, &notBothInt);
+    builder_.Bind(&bothInt);
+    {
+        GateRef intLeft = builder_.SExtInt32ToInt64(builder_.TaggedCastToInt32(left));
+        GateRef intRight = builder_.SExtInt32ToInt64(builder_.TaggedCastToInt32(right));
+        GateRef res = builder_.BinaryArithmetic(OpCode(Op), MachineType::I64, intLeft, intRight);
+        GateRef isOverflow = builder_.BoolOr(builder_.Int64GreaterThan(res, builder_.Int64(INT32_MAX)),
+                                             builder_.Int64LessThan(res, builder_.Int64(INT32_MIN)));
+        if constexpr (Op == OpCode::MUL) {
+            // a zero product with a negative operand is -0, which only a double can hold
+            GateRef isMinusZero = builder_.BoolAnd(builder_.Equal(res, builder_.Int64(0)),
+                builder_.Int64LessThan(builder_.Int64Or(intLeft, intRight), builder_.Int64(0)));
+            isOverflow = builder_.BoolOr(isOverflow, isMinusZero);
+        }
+        builder_.Branch(isOverflow, &overflow, &notOverflow);
+        builder_.Bind(&notOverflow);
+        {
+            result = builder_.TaggedNGC(builder_.ZExtInt32ToInt64(builder_.TruncInt64ToInt32(res)));
+            builder_.Jump(&successExit);
+        }
+        builder_.Bind(&overflow);
+        {
+            doubleLeft = builder_.ChangeInt32ToFloat64(builder_.TaggedCastToInt32(left));
+            doubleRight = builder_.ChangeInt32ToFloat64(builder_.TaggedCastToInt32(right));
+            builder_.Jump(&doFloatOp);
+        }
+    }
+    builder_.Bind(&notBothInt);
+    {
+        builder_.Branch(builder_.BoolAnd(builder_.TaggedIsNumber(left), builder_.TaggedIsNumber(right)),
+                        &bothNumber, &slowPath);
+        builder_.Bind(&bothNumber);
+        {
+            doubleLeft = NumberToFloat64(left);
+            doubleRight = NumberToFloat64(right);
+            builder_.Jump(&doFloatOp);
+        }
+    }
+    builder_.Bind(&doFloatOp);
+    {
+        GateRef res = builder_.BinaryArithmetic(OpCode(Op), MachineType::F64, *doubleLeft, *doubleRight);
+        result = builder_.DoubleToTaggedNGC(res);
+        builder_.Jump(&successExit);
+    }
+    builder_.Bind(&slowPath);
+    {
+        result = builder_.CallRuntime(glue, runtimeId, {left, right}, true);
+        builder_.Branch(builder_.IsSpecial(*result, JSTaggedValue::VALUE_EXCEPTION), &exceptionExit, &successExit);
+    }
+    ReplaceHirToSubCfg(gate, &result, &successExit, &exceptionExit);
+    return true;
+}
+
+template<OpCode::Op Op>
+bool TypeLowering::LowerNumberComparison(GateRef gate, GateRef glue, int runtimeId)
+{
+    // 2: number of value inputs
+    ASSERT(acc_.GetNumValueIn(gate) == 2);
+    GateRef left = acc_.GetValueIn(gate, 0);
+    GateRef right = acc_.GetValueIn(gate, 1);
+    if (!IsNumberType(left) || !IsNumberType(right)) {
+        return false;
+    }
+
+    Environment env(gate, circuit_, &builder_);
+    DEFVAlUE(result, (&builder_), VariableType::JS_ANY(), builder_.HoleConstant());
+    Label bothInt(&builder_);
+    Label notBothInt(&builder_);
+    Label bothNumber(&builder_);
+    Label isTrue(&builder_);
+    Label isFalse(&builder_);
+    Label slowPath(&builder_);
+    Label successExit(&builder_);
+    Label exceptionExit(&builder_);
+    builder_.Branch(builder_.BoolAnd(builder_.TaggedIsInt(left), builder_.TaggedIsInt(right)), &bothInt, &notBothInt);
+    builder_.Bind(&bothInt);
+    {
+        GateRef cond = builder_.BinaryLogic(OpCode(Op), builder_.TaggedCastToInt32(left),
+                                            builder_.TaggedCastToInt32(right));
+        builder_.Branch(cond, &isTrue, &isFalse);
+    }
+    builder_.Bind(&notBothInt);
+    {
+        builder_.Branch(builder_.BoolAnd(builder_.TaggedIsNumber(left), builder_.TaggedIsNumber(right)),
+                        &bothNumber, &slowPath);
+        builder_.Bind(&bothNumber);
+        {
+            // ordered float compare, so NaN on either side gives false
+            GateRef cond = builder_.BinaryLogic(OpCode(Op), NumberToFloat64(left), NumberToFloat64(right));
+            builder_.Branch(cond, &isTrue, &isFalse);
+        }
+    }
+    builder_.Bind(&isTrue);
+    {
+        result = builder_.TaggedTrue();
+        builder_.Jump(&successExit);
+    }
+    builder_.Bind(&isFalse);
+    {
+        result = builder_.TaggedFalse();
+        builder_.Jump(&successExit);
+    }
+    builder_.Bind(&slowPath);
+    {
+        result = builder_.CallRuntime(glue, runtimeId, {left, right}, true);
+        builder_.Branch(builder_.IsSpecial(*result, JSTaggedValue::VALUE_EXCEPTION), &exceptionExit, &successExit);
+    }
+    ReplaceHirToSubCfg(gate, &result, &successExit, &exceptionExit);
+    return true;
+}
+
+const PGOProfile::ICSiteInfo *TypeLowering::GetICSite(GateRef gate)
+{
+    if (profile_ == nullptr) {
+        return nullptr;
+    }
+    // the panda file translator stores the ic slot id of a bytecode in its second byte
+    uint8_t slotId = bcBuilder_->GetJSBytecode(gate)[1];
+    if (slotId == JSMethod::MAX_SLOT_SIZE) {
+        return nullptr;
+    }
+    return profile_->GetICSite(PGOProfile::GetChecksum(method_->GetJSPandaFile()), method_->GetMethodId().GetOffset(),
+                               slotId);
+}
+
+int TypeLowering::GetProfiledFieldIndex(const PGOProfile::ICSiteInfo *site, JSHandle<EcmaString> propName)
+{
+    if (site == nullptr || site->state != ProfileTypeAccessor::ICState::MONO || site->layouts.size() != 1) {
+        return -1;
+    }
+    const PGOProfile::HClassLayout &layout = profile_->GetLayout(site->layouts[0]);
+    if (layout.isDictionary) {
+        return -1;
+    }
+    std::string key = base::StringHelper::ToStdString(*propName);
+    auto iter = std::find(layout.keys.begin(), layout.keys.end(), key);
+    if (iter == layout.keys.end()) {
+        return -1;
+    }
+    return static_cast<int>(iter - layout.keys.begin());
+}
+
+bool TypeLowering::LowerLdObjByName(GateRef gate, GateRef glue)
+{
+    // 2: number of value inputs
+    ASSERT(acc_.GetNumValueIn(gate) == 2);
+    GateRef stringIdGate = acc_.GetValueIn(gate, 0);
+    GateRef receiver = acc_.GetValueIn(gate, 1);
+    const PGOProfile::ICSiteInfo *site = GetICSite(gate);
+    if (site != nullptr && site->state == ProfileTypeAccessor::ICState::MEGA) {
+        return false;
+    }
+    JSHandle<EcmaString> propName = tsLoader_->GetStringById(circuit_->GetBitField(stringIdGate));
+    // the guard compares the key by its contents, as the string is only reachable through a runtime call
+    if (!propName->IsUtf8() || propName->GetLength() > MAX_INLINE_KEY_LENGTH) {
+        return false;
+    }
+    int index = -1;
+    if (GetTypeKind(receiver) == TSTypeKind::TS_CLASS_INSTANCE) {
+        index = tsLoader_->GetClassInstancePropertyIndex(GlobalTSTypeRef(acc_.GetGateType(receiver)), propName);
+    }
+    if (index < 0) {
+        index = GetProfiledFieldIndex(site, propName);
+    }
+    if (index < 0) {
+        return false;
+    }
+    LowerInlinedFieldLoad(gate, glue, index, propName);
+    return true;
+}
+
+GateRef TypeLowering::IsKeyDataEqual(GateRef key, JSHandle<EcmaString> name)
+{
+    // the data is compared 8 bytes at a time, the loads stay within the object as its size is 8 bytes aligned and the
+    // bytes beyond the length are masked out
+    const uint8_t *data = name->GetDataUtf8();
+    uint32_t length = name->GetLength();
+    GateRef result = builder_.Boolean(true);
+    for (uint32_t chunk = 0; chunk < length; chunk += sizeof(uint64_t)) {
+        uint32_t size = std::min<uint32_t>(length - chunk, sizeof(uint64_t));
+        uint64_t expected = 0;
+        uint64_t mask = 0;
+        for (uint32_t i = 0; i < size; i++) {
+            // 8: bits of a byte, the targets are little endian
+            expected |= static_cast<uint64_t>(data[chunk + i]) << (i * 8U);
+            mask |= static_cast<uint64_t>(UINT8_MAX) << (i * 8U);
+        }
+        GateRef value = builder_.Load(VariableType::INT64(), key, builder_.IntPtr(EcmaString::DATA_OFFSET + chunk));
+        GateRef equal = builder_.Equal(builder_.Int64And(value, builder_.Int64(static_cast<int64_t>(mask))),
+                                       builder_.Int64(static_cast<int64_t>(expected)));
+        result = builder_.BoolAnd(result, equal);
+    }
+    return result;
+}
+
+void TypeLowering::LowerInlinedFieldLoad(GateRef gate, GateRef glue, int index, JSHandle<EcmaString> propName)
+{
+    GateRef stringIdGate = acc_.GetValueIn(gate, 0);
+    GateRef receiver = acc_.GetValueIn(gate, 1);
+    // fields are added to an instance in declaration order, so a field keeps its slot in the class layout as its
+    // entry in the hclass layout, as does a field at the entry the profiled hclass had; the entry key is what the
+    // guard checks
+    // 2: key and attr of every layout entry
+    size_t keyOffset = TaggedArray::DATA_OFFSET +
+        (LayoutInfo::ELEMENTS_START_INDEX + static_cast<size_t>(index) * 2) * JSTaggedValue::TaggedTypeSize();
+    size_t attrOffset = keyOffset + JSTaggedValue::TaggedTypeSize();
+
+    Environment env(gate, circuit_, &builder_);
+    DEFVAlUE(result, (&builder_), VariableType::JS_ANY(), builder_.HoleConstant());
+    Label isHeapObject(&builder_);
+    Label notDictionary(&builder_);
+    Label hasEntry(&builder_);
+    Label keyIsString(&builder_);
+    Label lengthMatch(&builder_);
+    Label keyMatch(&builder_);
+    Label isInlinedField(&builder_);
+    Label stubPath(&builder_);
+    Label runtimePath(&builder_);
+    Label successExit(&builder_);
+    Label exceptionExit(&builder_);
+    // the key string is loaded by a runtime call off the inline path only
+    GateRef stringId = builder_.TaggedTypeNGC(builder_.ZExtInt32ToInt64(stringIdGate));
+    builder_.Branch(builder_.TaggedIsHeapObject(receiver), &isHeapObject, &runtimePath);
+    builder_.Bind(&isHeapObject);
+    {
+        GateRef hClass = builder_.LoadHClass(receiver);
+        builder_.Branch(builder_.IsDictionaryModeByHClass(hClass), &stubPath, &notDictionary);
+        builder_.Bind(&notDictionary);
+        {
+            GateRef propNums = builder_.GetNumberOfPropsFromHClass(hClass);
+            builder_.Branch(builder_.Int32GreaterThan(propNums, builder_.Int32(index)), &hasEntry, &stubPath);
+            builder_.Bind(&hasEntry);
+            {
+                GateRef layout = builder_.GetLayoutFromHClass(hClass);
+                // the key is a string or a symbol
+                GateRef key = builder_.Load(VariableType::JS_ANY(), layout, builder_.IntPtr(keyOffset));
+                GateRef isString = builder_.Equal(builder_.GetObjectType(builder_.LoadHClass(key)),
+                                                  builder_.Int32(static_cast<int32_t>(JSType::STRING)));
+                builder_.Branch(isString, &keyIsString, &stubPath);
+                builder_.Bind(&keyIsString);
+                // the layout keys are interned, the intern bit is not part of the contents
+                GateRef mixLength = builder_.Int32And(
+                    builder_.Load(VariableType::INT32(), key, builder_.IntPtr(EcmaString::MIX_LENGTH_OFFSET)),
+                    builder_.Int32(static_cast<int32_t>(~EcmaString::STRING_INTERN_BIT)));
+                // 2: the length is stored above the compressed and intern bits
+                uint32_t expectedMixLength = (propName->GetLength() << 2U) | EcmaString::STRING_COMPRESSED;
+                builder_.Branch(builder_.Equal(mixLength, builder_.Int32(static_cast<int32_t>(expectedMixLength))),
+                                &lengthMatch, &stubPath);
+                builder_.Bind(&lengthMatch);
+                builder_.Branch(IsKeyDataEqual(key, propName), &keyMatch, &stubPath);
+                builder_.Bind(&keyMatch);
+                {
+                    GateRef attr = builder_.TaggedCastToInt32(
+                        builder_.Load(VariableType::INT64(), layout, builder_.IntPtr(attrOffset)));
+                    GateRef isField = builder_.BoolAnd(builder_.IsInlinedProperty(attr),
+                                                       builder_.BoolNot(builder_.IsAccessor(attr)));
+                    builder_.Branch(isField, &isInlinedField, &stubPath);
+                    builder_.Bind(&isInlinedField);
+                    {
+                        GateRef slot = builder_.Int32Add(builder_.GetInlinedPropsStartFromHClass(hClass),
+                                                         builder_.GetOffsetFieldInPropAttr(attr));
+                        GateRef offset = builder_.Int32Mul(slot, builder_.Int32(JSTaggedValue::TaggedTypeSize()));
+                        result = builder_.Load(VariableType::JS_ANY(), receiver, builder_.ZExtInt32ToPtr(offset));
+                        builder_.Jump(&successExit);
+                    }
+                }
+            }
+        }
+    }
+    builder_.Bind(&stubPath);
+    {
+        GateRef prop = builder_.CallRuntime(glue, RTSTUB_ID(LoadValueFromConstantStringTable), {stringId}, true);
+        result = builder_.CallStub(glue, CommonStubCSigns::GetPropertyByName, {glue, receiver, prop});
+        Label notHole(&builder_);
+        builder_.Branch(builder_.IsSpecial(*result, JSTaggedValue::VALUE_HOLE), &runtimePath, &notHole);
+        builder_.Bind(&notHole);
+        builder_.Branch(builder_.IsSpecial(*result, JSTaggedValue::VALUE_EXCEPTION), &exceptionExit, &successExit);
+    }
+    builder_.Bind(&runtimePath);
+    {
+        GateRef prop = builder_.CallRuntime(glue, RTSTUB_ID(LoadValueFromConstantStringTable), {stringId}, true);
+        GateRef undefined = builder_.UndefineConstant();
+        result = builder_.CallRuntime(glue, RTSTUB_ID(LoadICByName), {undefined, receiver, prop, undefined}, true);
+        builder_.Branch(builder_.IsSpecial(*result, JSTaggedValue::VALUE_EXCEPTION), &exceptionExit, &successExit);
+    }
+    ReplaceHirToSubCfg(gate, &result, &successExit, &exceptionExit);
+}
+
+bool TypeLowering::LowerArrayLdObjByValue(GateRef gate, GateRef glue)
+{
+    // 2: number of value inputs
+    ASSERT(acc_.GetNumValueIn(gate) == 2);
+    GateRef receiver = acc_.GetValueIn(gate, 0);
+    GateRef propKey = acc_.GetValueIn(gate, 1);
+    if (GetTypeKind(receiver) != TSTypeKind::TS_ARRAY || !IsNumberType(propKey)) {
+        return false;
+    }
+
+    Environment env(gate, circuit_, &builder_);
+    DEFVAlUE(result, (&builder_), VariableType::JS_ANY(), builder_.HoleConstant());
+    Label isHeapObject(&builder_);
+    Label isJSArray(&builder_);
+    Label keyIsInt(&builder_);
+    Label notDictionary(&builder_);
+    Label inBounds(&builder_);
+    Label notHoleElement(&builder_);
+    Label stubPath(&builder_);
+    Label runtimePath(&builder_);
+    Label successExit(&builder_);
+    Label exceptionExit(&builder_);
+    builder_.Branch(builder_.TaggedIsHeapObject(receiver), &isHeapObject, &runtimePath);
+    builder_.Bind(&isHeapObject);
+    {
+        builder_.Branch(builder_.IsJsType(receiver, JSType::JS_ARRAY), &isJSArray, &stubPath);
+        builder_.Bind(&isJSArray);
+        {
+            builder_.Branch(builder_.TaggedIsInt(propKey), &keyIsInt, &stubPath);
+            builder_.Bind(&keyIsInt);
+            {
+                GateRef hClass = builder_.LoadHClass(receiver);
+                builder_.Branch(builder_.IsDictionaryElement(hClass), &stubPath, &notDictionary);
+                builder_.Bind(&notDictionary);
+                {
+                    GateRef elements = builder_.Load(VariableType::JS_POINTER(), receiver,
+                                                     builder_.IntPtr(JSObject::ELEMENTS_OFFSET));
+                    GateRef length = builder_.Load(VariableType::INT32(), elements,
+                                                   builder_.IntPtr(TaggedArray::LENGTH_OFFSET));
+                    GateRef index = builder_.TaggedCastToInt32(propKey);
+                    // a negative index wraps to a large unsigned value and fails the bounds check as well
+                    builder_.Branch(builder_.Int32UnsignedLessThan(index, length), &inBounds, &stubPath);
+                    builder_.Bind(&inBounds);
+                    {
+                        GateRef offset = builder_.PtrMul(builder_.ZExtInt32ToPtr(index),
+                                                         builder_.IntPtr(JSTaggedValue::TaggedTypeSize()));
+                        GateRef dataOffset = builder_.PtrAdd(offset, builder_.IntPtr(TaggedArray::DATA_OFFSET));
+                        result = builder_.Load(VariableType::JS_ANY(), elements, dataOffset);
+                        // a hole has to be looked up on the prototype chain
+                        builder_.Branch(builder_.TaggedIsHole(*result), &stubPath, &notHoleElement);
+                        builder_.Bind(&notHoleElement);
+                        builder_.Jump(&successExit);
+                    }
+                }
+            }
+        }
+    }
+    builder_.Bind(&stubPath);
+    {
+        result = builder_.CallStub(glue, CommonStubCSigns::GetPropertyByValue, {glue, receiver, propKey});
+        Label notHole(&builder_);
+        builder_.Branch(builder_.IsSpecial(*result, JSTaggedValue::VALUE_HOLE), &runtimePath, &notHole);
+        builder_.Bind(&notHole);
+        builder_.Branch(builder_.IsSpecial(*result, JSTaggedValue::VALUE_EXCEPTION), &exceptionExit, &successExit);
+    }
+    builder_.Bind(&runtimePath);
+    {
+        GateRef undefined = builder_.UndefineConstant();
+        result = builder_.CallRuntime(glue, RTSTUB_ID(LoadICByValue), {undefined, receiver, propKey,
+            builder_.TaggedTypeNGC(undefined)}, true);
+        builder_.Branch(builder_.IsSpecial(*result, JSTaggedValue::VALUE_EXCEPTION), &exceptionExit, &successExit);
+    }
+    ReplaceHirToSubCfg(gate, &result, &successExit, &exceptionExit);
+    return true;
+}
+
+GateRef TypeLowering::NumberToFloat64(GateRef number)
+{
+    Label subentry(&builder_);
+    builder_.SubCfgEntry(&subentry);
+    Label isInt(&builder_);
+    Label isDouble(&builder_);
+    Label exit(&builder_);
+    DEFVAlUE(result, (&builder_), VariableType::FLOAT64(), builder_.Double(0));
+    builder_.Branch(builder_.TaggedIsInt(number), &isInt, &isDouble);
+    builder_.Bind(&isInt);
+    {
+        result = builder_.ChangeInt32ToFloat64(builder_.TaggedCastToInt32(number));
+        builder_.Jump(&exit);
+    }
+    builder_.Bind(&isDouble);
+    {
+        result = builder_.TaggedCastToDouble(number);
+        builder_.Jump(&exit);
+    }
+    builder_.Bind(&exit);
+    auto ret = *result;
+    builder_.SubCfgExit();
+    return ret;
+}
+
+void TypeLowering::ReplaceHirToSubCfg(GateRef hir, Variable *result, Label *successExit, Label *exceptionExit)
+{
+    std::vector<GateRef> successControl;
+    std::vector<GateRef> failControl;
+    GateRef value;
+    builder_.Bind(successExit);
+    {
+        value = **result;
+        successControl.emplace_back(builder_.GetState());
+        successControl.emplace_back(builder_.GetDepend());
+    }
+    builder_.Bind(exceptionExit);
+    {
+        failControl.emplace_back(builder_.GetState());
+        failControl.emplace_back(builder_.GetDepend());
+    }
+    acc_.ReplaceHirToSubCfg(hir, value, successControl, failControl);
+}
+}  // namespace panda::ecmascript::kungfu
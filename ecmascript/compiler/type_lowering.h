@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_TYPE_LOWERING_H
+#define ECMASCRIPT_COMPILER_TYPE_LOWERING_H
+
+#include "bytecode_circuit_builder.h"
+#include "circuit.h"
+#include "circuit_builder.h"
+#include "circuit_builder-inl.h"
+#include "gate_accessor.h"
+#include "ecmascript/pgo_profiler/pgo_profiler.h"
+#include "ecmascript/ts_types/ts_loader.h"
+
+namespace panda::ecmascript::kungfu {
+// TypeLowering runs before SlowPathLowering and replaces a JS_BYTECODE gate by a fast path when the TS types of its
+// value inputs allow one:
+//     number op number      int32 operation with overflow check, float64 operation otherwise
+//     instance.field        inline field load at the slot the class declares in its TSObjLayoutInfo
+//     array[number]         load straight from the elements TaggedArray
+// TS types are not enforced at runtime, so every fast path is guarded and falls back to the same stub/runtime call
+// SlowPathLowering would emit. Gates without a usable type are left for SlowPathLowering.
+// With a pgo profile, the ic state of the bytecode in the profiled run takes part as well: a field load whose ic only
+// ever saw one hclass gets the inline field load at the index of the key in that hclass even without a TS type, and
+// no fast path is emitted for a load whose ic went megamorphic.
+class TypeLowering {
+public:
+    TypeLowering(BytecodeCircuitBuilder *bcBuilder, Circuit *circuit, CompilationConfig *cmpCfg, TSLoader *tsLoader,
+                 const PGOProfile *profile, const JSMethod *method, bool enableLog)
+        : bcBuilder_(bcBuilder), circuit_(circuit), acc_(circuit), builder_(circuit, cmpCfg), tsLoader_(tsLoader),
+          profile_(profile), method_(method), enableLog_(enableLog) {}
+    ~TypeLowering() = default;
+
+    // returns the number of bytecodes lowered to a typed fast path
+    size_t Run();
+
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+private:
+    // the longest key the inline field load compares by its contents, in utf8 bytes
+    static constexpr uint32_t MAX_INLINE_KEY_LENGTH = 64;
+
+    bool Lower(GateRef gate);
+    TSTypeKind GetTypeKind(GateRef gate);
+    bool IsNumberType(GateRef gate);
+    template<OpCode::Op Op>
+    bool LowerNumberArithmetic(GateRef gate, GateRef glue, int runtimeId);
+    template<OpCode::Op Op>
+    bool LowerNumberComparison(GateRef gate, GateRef glue, int runtimeId);
+    // returns nullptr without a profile or if the ic of the bytecode never missed in the profiled run
+    const PGOProfile::ICSiteInfo *GetICSite(GateRef gate);
+    int GetProfiledFieldIndex(const PGOProfile::ICSiteInfo *site, JSHandle<EcmaString> propName);
+    bool LowerLdObjByName(GateRef gate, GateRef glue);
+    void LowerInlinedFieldLoad(GateRef gate, GateRef glue, int index, JSHandle<EcmaString> propName);
+    // environment must be initialized, key is a string of the same length as name
+    GateRef IsKeyDataEqual(GateRef key, JSHandle<EcmaString> name);
+    bool LowerArrayLdObjByValue(GateRef gate, GateRef glue);
+    // environment must be initialized
+    GateRef NumberToFloat64(GateRef number);
+    void ReplaceHirToSubCfg(GateRef hir, Variable *result, Label *successExit, Label *exceptionExit);
+
+    BytecodeCircuitBuilder *bcBuilder_;
+    Circuit *circuit_;
+    GateAccessor acc_;
+    CircuitBuilder builder_;
+    TSLoader *tsLoader_;
+    const PGOProfile *profile_;
+    const JSMethod *method_;
+    bool enableLog_ {false};
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_TYPE_LOWERING_H
@@ -23,6 +23,7 @@ namespace panda::ecmascript {
 JSThread *ProfileProcessor::thread_ = nullptr;
 bool ProfileProcessor::isStart_ = true;
 ProfileProcessor::ProfileProcessor(ProfileGenerator *generator, const EcmaVM *vm, int interval)
+    : Task(TaskPriority::LOW)
 {
     generator_ = generator;
     interval_ = interval;
@@ -394,7 +394,7 @@ static void DumpHClass(const JSHClass *jshclass, std::ostream &os, bool withDeta
     os << "Ctor :" << jshclass->IsConstructor();
     os << "| Callable :" << jshclass->IsCallable();
     os << "| Extensible :" << jshclass->IsExtensible();
-    os << "| ElementRepresentation :" << static_cast<int>(jshclass->GetElementRepresentation());
+    os << "| ElementsKind :" << static_cast<int>(jshclass->GetElementsKind());
     os << "| NumberOfProps :" << std::dec << jshclass->NumberOfProps();
     os << "| InlinedProperties :" << std::dec << jshclass->GetInlinedProperties();
     os << "\n";
@@ -1714,6 +1714,8 @@ void GlobalEnv::Dump(std::ostream &os) const
     GetUnscopablesSymbol().GetTaggedValue().Dump(os);
     os << " - HoleySymbol: ";
     GetHoleySymbol().GetTaggedValue().Dump(os);
+    os << " - ElementsKindSymbol: ";
+    GetElementsKindSymbol().GetTaggedValue().Dump(os);
     os << " - ConstructorString: ";
     globalConst->GetConstructorString().Dump(os);
     os << " - IteratorPrototype: ";
@@ -3535,6 +3537,7 @@ void GlobalEnv::DumpForSnapshot(std::vector<std::pair<CString, JSTaggedValue>> &
     vec.push_back(std::make_pair(CString("ToPrimitiveSymbol"), GetToPrimitiveSymbol().GetTaggedValue()));
     vec.push_back(std::make_pair(CString("UnscopablesSymbol"), GetUnscopablesSymbol().GetTaggedValue()));
     vec.push_back(std::make_pair(CString("HoleySymbol"), GetHoleySymbol().GetTaggedValue()));
+    vec.push_back(std::make_pair(CString("ElementsKindSymbol"), GetElementsKindSymbol().GetTaggedValue()));
     vec.push_back(std::make_pair(CString("ConstructorString"), globalConst->GetConstructorString()));
     vec.push_back(std::make_pair(CString("IteratorPrototype"), GetIteratorPrototype().GetTaggedValue()));
     vec.push_back(std::make_pair(CString("ForinIteratorPrototype"), GetForinIteratorPrototype().GetTaggedValue()));
@@ -46,6 +46,7 @@
 #include "ecmascript/mem/machine_code.h"
 #include "ecmascript/module/js_module_manager.h"
 #include "ecmascript/object_factory.h"
+#include "ecmascript/pgo_profiler/pgo_profiler.h"
 #include "ecmascript/taskpool/taskpool.h"
 #include "ecmascript/regexp/regexp_parser_cache.h"
 #include "ecmascript/runtime_call_id.h"
@@ -157,6 +158,9 @@ bool EcmaVM::Initialize()
     tsLoader_ = new TSLoader(this);
     snapshotEnv_ = new SnapShotEnv(this);
     aotInfo_ = new AotCodeInfo();
+    if (options_.IsEnablePGOProfiler()) {
+        pgoProfiler_ = new PGOProfiler(options_.GetPGOProfileFile());
+    }
     if (options_.IsEnableStubAot()) {
         LoadStubs();
     }
@@ -297,6 +301,12 @@ EcmaVM::~EcmaVM()
         aotInfo_  = nullptr;
     }
 
+    if (pgoProfiler_ != nullptr) {
+        pgoProfiler_->Dump();
+        delete pgoProfiler_;
+        pgoProfiler_ = nullptr;
+    }
+
     if (thread_ != nullptr) {
         delete thread_;
         thread_ = nullptr;
@@ -598,6 +608,16 @@ void EcmaVM::CollectGarbage(TriggerGCType gcType) const
     heap_->CollectGarbage(gcType);
 }
 
+void EcmaVM::NotifyIdle(double idleMs) const
+{
+    heap_->NotifyIdle(idleMs);
+}
+
+void EcmaVM::NotifyMemoryPressure(bool critical) const
+{
+    heap_->NotifyMemoryPressure(critical);
+}
+
 void EcmaVM::StartHeapTracking(HeapTracker *tracker)
 {
     heap_->StartHeapTracking(tracker);
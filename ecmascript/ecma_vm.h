@@ -74,6 +74,7 @@ class Program;
 class TSLoader;
 class ModuleManager;
 class AotCodeInfo;
+class PGOProfiler;
 
 using HostPromiseRejectionTracker = void (*)(const EcmaVM* vm,
                                              const JSHandle<JSPromise> promise,
@@ -202,6 +203,10 @@ public:
 
     void CollectGarbage(TriggerGCType gcType) const;
 
+    void NotifyIdle(double idleMs) const;
+
+    void NotifyMemoryPressure(bool critical) const;
+
     void StartHeapTracking(HeapTracker *tracker);
 
     void StopHeapTracking();
@@ -238,6 +243,12 @@ public:
         return snapshotEnv_;
     }
 
+    // nullptr unless --enable-pgo-profiler is set
+    PGOProfiler *GetPGOProfiler() const
+    {
+        return pgoProfiler_;
+    }
+
     void LoadStubs();
     void SetupRegExpResultCache();
 
@@ -378,6 +389,7 @@ private:
     SnapShotEnv *snapshotEnv_ {nullptr};
     bool optionalLogEnabled_ {false};
     AotCodeInfo *aotInfo_ {nullptr};
+    PGOProfiler *pgoProfiler_ {nullptr};
 
     // Debugger
     tooling::JsDebuggerManager *debuggerManager_ {nullptr};
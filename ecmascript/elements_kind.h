@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_ELEMENTS_KIND_H
+#define ECMASCRIPT_ELEMENTS_KIND_H
+
+#include <algorithm>
+#include <cstdint>
+
+#include "ecmascript/js_tagged_value.h"
+
+namespace panda::ecmascript {
+// ElementsKind is what the hclass of an array knows about the values of its elements below the length: ints only,
+// numbers only or any values, and whether there may be holes (HOLEY) or not (PACKED).
+// The kinds form a lattice, the low bit is the holey bit and the bits above it are the value level, so that a kind
+// holds the values of another one if it is at least as holey and its level is at least as high. A store generalizes
+// the kind of its object to the merge of the kind and the value before it is visible to a fast path, while the
+// generic kind HOLEY_ELEMENTS assumes nothing and is the kind of every hclass which is not transitioned on purpose.
+enum class ElementsKind : uint8_t {
+    PACKED_INT = 0,
+    HOLEY_INT,
+    PACKED_DOUBLE,
+    HOLEY_DOUBLE,
+    PACKED_ELEMENTS,
+    HOLEY_ELEMENTS,
+};
+
+static constexpr uint32_t ELEMENTS_KIND_BITFIELD_NUM = 3;
+static constexpr uint32_t ELEMENTS_KIND_HOLEY_BIT = 1;
+
+static inline uint32_t GetElementsKindLevel(ElementsKind kind)
+{
+    return static_cast<uint32_t>(kind) >> 1U;
+}
+
+static inline bool IsHoleyElementsKind(ElementsKind kind)
+{
+    return (static_cast<uint32_t>(kind) & ELEMENTS_KIND_HOLEY_BIT) != 0;
+}
+
+static inline bool IsIntElementsKind(ElementsKind kind)
+{
+    return GetElementsKindLevel(kind) == GetElementsKindLevel(ElementsKind::PACKED_INT);
+}
+
+// ints or doubles only, the int kinds included
+static inline bool IsNumberElementsKind(ElementsKind kind)
+{
+    return GetElementsKindLevel(kind) <= GetElementsKindLevel(ElementsKind::PACKED_DOUBLE);
+}
+
+static inline ElementsKind GetHoleyElementsKind(ElementsKind kind)
+{
+    return static_cast<ElementsKind>(static_cast<uint32_t>(kind) | ELEMENTS_KIND_HOLEY_BIT);
+}
+
+static inline ElementsKind MergeElementsKind(ElementsKind kind, ElementsKind other)
+{
+    uint32_t level = std::max(GetElementsKindLevel(kind), GetElementsKindLevel(other));
+    uint32_t holey = (static_cast<uint32_t>(kind) | static_cast<uint32_t>(other)) & ELEMENTS_KIND_HOLEY_BIT;
+    return static_cast<ElementsKind>((level << 1U) | holey);
+}
+
+// whether kind holds every element of other
+static inline bool IsMoreGeneralElementsKind(ElementsKind kind, ElementsKind other)
+{
+    return MergeElementsKind(kind, other) == kind;
+}
+
+// the least general kind of an element which is value, a hole only makes the kind holey
+static inline ElementsKind TaggedToElementsKind(JSTaggedValue value)
+{
+    if (value.IsInt()) {
+        return ElementsKind::PACKED_INT;
+    }
+    if (value.IsDouble()) {
+        return ElementsKind::PACKED_DOUBLE;
+    }
+    if (value.IsHole()) {
+        return ElementsKind::HOLEY_INT;
+    }
+    return ElementsKind::PACKED_ELEMENTS;
+}
+}  // namespace panda::ecmascript
+
+#endif  // ECMASCRIPT_ELEMENTS_KIND_H
@@ -156,8 +156,9 @@ public:
         }
         if (op.IsInlinedProps()) {
             InlinedPropsBit::Set<uint32_t>(true, &handler);
-            JSHandle<JSObject> receiver = JSHandle<JSObject>::Cast(op.GetReceiver());
-            auto index = receiver->GetJSHClass()->GetInlinedPropertiesIndex(op.GetIndex());
+            // the setter of a prototype property is an inlined property of the holder
+            JSHandle<JSObject> owner = JSHandle<JSObject>::Cast(op.IsOnPrototype() ? op.GetHolder() : op.GetReceiver());
+            auto index = owner->GetJSHClass()->GetInlinedPropertiesIndex(op.GetIndex());
             OffsetBit::Set<uint32_t>(index, &handler);
             return JSHandle<JSTaggedValue>(thread, JSTaggedValue(handler));
         }
@@ -225,8 +226,7 @@ public:
         if (op.IsFound()) {
             handler->SetHolder(thread, op.GetHolder());
         }
-        auto result = JSHClass::EnableProtoChangeMarker(thread, hclass);
-        handler->SetProtoCell(thread, result);
+        handler->SetProtoCell(thread, EnableChangeMarker(thread, hclass));
         return JSHandle<JSTaggedValue>::Cast(handler);
     }
     static inline JSHandle<JSTaggedValue> StorePrototype(const JSThread *thread, const ObjectOperator &op,
@@ -237,11 +237,34 @@ public:
         JSHandle<JSTaggedValue> handlerInfo = StoreHandler::StoreProperty(thread, op);
         handler->SetHandlerInfo(thread, handlerInfo);
         handler->SetHolder(thread, op.GetHolder());
-        auto result = JSHClass::EnableProtoChangeMarker(thread, hclass);
-        handler->SetProtoCell(thread, result);
+        handler->SetProtoCell(thread, EnableChangeMarker(thread, hclass));
         return JSHandle<JSTaggedValue>::Cast(handler);
     }
 
+    // the element handler of the global object, which the slot of a global ic keeps without the hclass, guarded by
+    // the marker of the global object; the hclass of the global object changes when its elements become a dictionary
+    static inline JSHandle<JSTaggedValue> GlobalElement(const JSThread *thread,
+                                                        const JSHandle<JSTaggedValue> &handlerInfo,
+                                                        const JSHandle<JSHClass> &hclass)
+    {
+        ASSERT(hclass->IsJSGlobalObject());
+        ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+        JSHandle<PrototypeHandler> handler = factory->NewPrototypeHandler();
+        handler->SetHandlerInfo(thread, handlerInfo);
+        handler->SetProtoCell(thread, JSHClass::EnableGlobalChangeMarker(thread, hclass));
+        return JSHandle<JSTaggedValue>::Cast(handler);
+    }
+
+    // a new own property of the global object does not transition its hclass, so the ics of the global object check
+    // the marker of the global object itself instead of the one of its prototype
+    static inline JSHandle<JSTaggedValue> EnableChangeMarker(const JSThread *thread, const JSHandle<JSHClass> &hclass)
+    {
+        if (hclass->IsJSGlobalObject()) {
+            return JSHClass::EnableGlobalChangeMarker(thread, hclass);
+        }
+        return JSHClass::EnableProtoChangeMarker(thread, hclass);
+    }
+
     static constexpr size_t HANDLER_INFO_OFFSET = TaggedObjectSize();
 
     ACCESSORS(HandlerInfo, HANDLER_INFO_OFFSET, PROTO_CELL_OFFSET)
@@ -17,6 +17,7 @@
 #include "ecmascript/global_dictionary-inl.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/ic/ic_handler.h"
+#include "ecmascript/ic/megamorphic_cache.h"
 #include "ecmascript/ic/profile_type_info.h"
 #include "ecmascript/interpreter/slow_runtime_stub.h"
 #include "ecmascript/js_function.h"
@@ -32,9 +33,12 @@ namespace panda::ecmascript {
 void ICRuntime::UpdateLoadHandler(const ObjectOperator &op, JSHandle<JSTaggedValue> key,
                                   JSHandle<JSTaggedValue> receiver)
 {
-    if (icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA) {
+    bool isMega = icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA;
+    // only the named properties of the megamorphic named load sites go to the megamorphic cache
+    if (isMega && (GetICKind() != ICKind::NamedLoadIC || op.IsElement())) {
         return;
     }
+    JSHandle<JSTaggedValue> propKey = key;
     if (IsNamedIC(GetICKind())) {
         key = JSHandle<JSTaggedValue>();
     }
@@ -56,19 +60,21 @@ void ICRuntime::UpdateLoadHandler(const ObjectOperator &op, JSHandle<JSTaggedVal
         } else if (!op.IsOnPrototype()) {
             handlerValue = LoadHandler::LoadProperty(thread_, op);
         } else {
-            // do not support global prototype ic
-            if (IsGlobalLoadIC(GetICKind())) {
-                return;
-            }
+            // the handler of a global ic checks the marker of the global object, see JSHClass::EnableGlobalChangeMarker
             handlerValue = PrototypeHandler::LoadPrototype(thread_, op, hclass);
         }
     }
 
-    if (key.IsEmpty()) {
+    if (isMega) {
+        thread_->GetMegamorphicCache()->SetLoadHandler(*hclass, propKey.GetTaggedValue(),
+                                                       handlerValue.GetTaggedValue());
+    } else if (key.IsEmpty()) {
         icAccessor_.AddHandlerWithoutKey(JSHandle<JSTaggedValue>::Cast(hclass), handlerValue);
     } else if (op.IsElement()) {
-        // do not support global element ic
         if (IsGlobalLoadIC(GetICKind())) {
+            // the slot of a global ic keeps no hclass, the marker of the global object guards the elements instead
+            handlerValue = PrototypeHandler::GlobalElement(thread_, handlerValue, hclass);
+            icAccessor_.AddHandlerWithKey(key, JSHandle<JSTaggedValue>::Cast(hclass), handlerValue);
             return;
         }
         icAccessor_.AddElementHandler(JSHandle<JSTaggedValue>::Cast(hclass), handlerValue);
@@ -80,19 +86,18 @@ void ICRuntime::UpdateLoadHandler(const ObjectOperator &op, JSHandle<JSTaggedVal
 void ICRuntime::UpdateStoreHandler(const ObjectOperator &op, JSHandle<JSTaggedValue> key,
                                    JSHandle<JSTaggedValue> receiver)
 {
-    if (icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA) {
+    bool isMega = icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA;
+    // only the named properties of the megamorphic named store sites go to the megamorphic cache
+    if (isMega && (GetICKind() != ICKind::NamedStoreIC || op.IsElement())) {
         return;
     }
+    JSHandle<JSTaggedValue> propKey = key;
     if (IsNamedIC(GetICKind())) {
         key = JSHandle<JSTaggedValue>();
     }
     JSHandle<JSTaggedValue> handlerValue;
     ASSERT(op.IsFound());
     if (op.IsOnPrototype()) {
-        // do not support global prototype ic
-        if (IsGlobalStoreIC(GetICKind())) {
-            return;
-        }
         JSHandle<JSHClass> hclass(thread_, JSHandle<JSObject>::Cast(receiver)->GetClass());
         handlerValue = PrototypeHandler::StorePrototype(thread_, op, hclass);
     } else if (op.IsTransition()) {
@@ -102,11 +107,19 @@ void ICRuntime::UpdateStoreHandler(const ObjectOperator &op, JSHandle<JSTaggedVa
         handlerValue = StoreHandler::StoreProperty(thread_, op);
     }
 
-    if (key.IsEmpty()) {
+    if (isMega) {
+        thread_->GetMegamorphicCache()->SetStoreHandler(JSHClass::Cast(receiverHClass_->GetTaggedObject()),
+                                                        propKey.GetTaggedValue(), handlerValue.GetTaggedValue());
+    } else if (key.IsEmpty()) {
         icAccessor_.AddHandlerWithoutKey(receiverHClass_, handlerValue);
     } else if (op.IsElement()) {
-        // do not support global element ic
         if (IsGlobalStoreIC(GetICKind())) {
+            // the slot of a global ic keeps no hclass, the marker of the global object guards the elements instead
+            JSHandle<JSHClass> hclass(receiverHClass_);
+            if (!handlerValue->IsPrototypeHandler()) {
+                handlerValue = PrototypeHandler::GlobalElement(thread_, handlerValue, hclass);
+            }
+            icAccessor_.AddHandlerWithKey(key, receiverHClass_, handlerValue);
             return;
         }
         icAccessor_.AddElementHandler(receiverHClass_, handlerValue);
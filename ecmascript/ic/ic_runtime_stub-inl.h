@@ -30,7 +30,9 @@
 #include "ecmascript/object_factory-inl.h"
 #include "ecmascript/js_handle.h"
 #include "ecmascript/interpreter/fast_runtime_stub-inl.h"
+#include "ecmascript/ic/megamorphic_cache.h"
 #include "ecmascript/ic/proto_change_details.h"
+#include "ecmascript/pgo_profiler/pgo_profiler.h"
 
 #include "ecmascript/runtime_call_id.h"
 
@@ -41,7 +43,8 @@ JSTaggedValue ICRuntimeStub::LoadGlobalICByName(JSThread *thread, ProfileTypeInf
     INTERPRETER_TRACE(thread, LoadGlobalICByName);
     JSTaggedValue handler = profileTypeInfo->Get(slotId);
     if (handler.IsHeapObject()) {
-        auto result = LoadGlobal(handler);
+        // a property of the prototype chain of the global object
+        auto result = handler.IsPrototypeHandler() ? LoadPrototype(thread, globalValue, handler) : LoadGlobal(handler);
         if (!result.IsHole()) {
             return result;
         }
@@ -56,7 +59,9 @@ JSTaggedValue ICRuntimeStub::StoreGlobalICByName(JSThread *thread, ProfileTypeIn
     INTERPRETER_TRACE(thread, StoreGlobalICByName);
     JSTaggedValue handler = profileTypeInfo->Get(slotId);
     if (handler.IsHeapObject()) {
-        auto result = StoreGlobal(thread, value, handler);
+        // a setter of the prototype chain of the global object
+        auto result = handler.IsPrototypeHandler() ? StorePrototype(thread, globalValue, value, handler) :
+            StoreGlobal(thread, value, handler);
         if (!result.IsHole()) {
             return result;
         }
@@ -188,6 +193,53 @@ ARK_NOINLINE JSTaggedValue ICRuntimeStub::StoreICByName(JSThread *thread, Profil
     return StoreMiss(thread, profileTypeInfo, receiver, key, value, slotId, ICKind::NamedStoreIC);
 }
 
+ARK_INLINE bool ICRuntimeStub::IsMegaICReceiver(JSTaggedValue receiver)
+{
+    // a dictionary or typed array receiver never gets a handler, so a miss would only slow its generic path down
+    if (!receiver.IsJSObject() || receiver.IsTypedArray()) {
+        return false;
+    }
+    return !receiver.GetTaggedObject()->GetClass()->IsDictionaryMode();
+}
+
+ARK_INLINE JSTaggedValue ICRuntimeStub::LoadMegaICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
+                                                         JSTaggedValue receiver, JSTaggedValue key, uint32_t slotId)
+{
+    INTERPRETER_TRACE(thread, LoadMegaICByName);
+    if (!IsMegaICReceiver(receiver)) {
+        return JSTaggedValue::Hole();
+    }
+    auto hclass = receiver.GetTaggedObject()->GetClass();
+    JSTaggedValue handler = thread->GetMegamorphicCache()->GetLoadHandler(hclass, key);
+    if (!handler.IsHole()) {
+        JSTaggedValue result = LoadICWithHandler(thread, receiver, receiver, handler);
+        // Hole: the prototype chain of a prototype handler changed
+        if (!result.IsHole()) {
+            return result;
+        }
+    }
+    return LoadMiss(thread, profileTypeInfo, receiver, key, slotId, ICKind::NamedLoadIC);
+}
+
+ARK_INLINE JSTaggedValue ICRuntimeStub::StoreMegaICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
+                                                          JSTaggedValue receiver, JSTaggedValue key,
+                                                          JSTaggedValue value, uint32_t slotId)
+{
+    INTERPRETER_TRACE(thread, StoreMegaICByName);
+    if (!IsMegaICReceiver(receiver)) {
+        return JSTaggedValue::Hole();
+    }
+    auto hclass = receiver.GetTaggedObject()->GetClass();
+    JSTaggedValue handler = thread->GetMegamorphicCache()->GetStoreHandler(hclass, key);
+    if (!handler.IsHole()) {
+        JSTaggedValue result = StoreICWithHandler(thread, receiver, receiver, value, handler);
+        if (!result.IsHole()) {
+            return result;
+        }
+    }
+    return StoreMiss(thread, profileTypeInfo, receiver, key, value, slotId, ICKind::NamedStoreIC);
+}
+
 ARK_INLINE JSTaggedValue ICRuntimeStub::StoreICWithHandler(JSThread *thread, JSTaggedValue receiver,
                                                            JSTaggedValue holder,
                                                            JSTaggedValue value, JSTaggedValue handler)
@@ -385,9 +437,17 @@ JSTaggedValue ICRuntimeStub::StoreElement(JSThread *thread, JSObject *receiver,
     uint32_t elementIndex = static_cast<uint32_t>(index);
     if (handler.IsInt()) {
         auto handlerInfo = static_cast<uint32_t>(handler.GetInt());
+        // a store which generalizes the elements kind takes the slow path to transition the hclass
+        JSHClass *hclass = receiver->GetJSHClass();
+        if (UNLIKELY(!hclass->IsElementsKindCompatible(value))) {
+            return JSTaggedValue::Hole();
+        }
         if (HandlerBase::IsJSArray(handlerInfo)) {
             JSArray *arr = JSArray::Cast(receiver);
             uint32_t oldLength = arr->GetArrayLength();
+            if (elementIndex > oldLength && !IsHoleyElementsKind(hclass->GetElementsKind())) {
+                return JSTaggedValue::Hole();
+            }
             if (elementIndex >= oldLength) {
                 arr->SetArrayLength(thread, elementIndex + 1);
             }
@@ -455,7 +515,12 @@ JSTaggedValue ICRuntimeStub::LoadMiss(JSThread *thread, ProfileTypeInfo *profile
     auto receiverHandle = JSHandle<JSTaggedValue>(thread, receiver);
     auto profileInfoHandle = JSHandle<JSTaggedValue>(thread, profileTypeInfo);
     LoadICRuntime icRuntime(thread, JSHandle<ProfileTypeInfo>::Cast(profileInfoHandle), slotId, kind);
-    return icRuntime.LoadMiss(receiverHandle, keyHandle);
+    JSTaggedValue result = icRuntime.LoadMiss(receiverHandle, keyHandle);
+    PGOProfiler *pgoProfiler = thread->GetEcmaVM()->GetPGOProfiler();
+    if (UNLIKELY(pgoProfiler != nullptr)) {
+        pgoProfiler->ProfileIC(thread, JSHandle<ProfileTypeInfo>::Cast(profileInfoHandle), slotId, kind);
+    }
+    return result;
 }
 
 JSTaggedValue ICRuntimeStub::StoreMiss(JSThread *thread, ProfileTypeInfo *profileTypeInfo, JSTaggedValue receiver,
@@ -467,7 +532,12 @@ JSTaggedValue ICRuntimeStub::StoreMiss(JSThread *thread, ProfileTypeInfo *profil
     auto valueHandle = JSHandle<JSTaggedValue>(thread, value);
     auto profileInfoHandle = JSHandle<JSTaggedValue>(thread, profileTypeInfo);
     StoreICRuntime icRuntime(thread, JSHandle<ProfileTypeInfo>::Cast(profileInfoHandle), slotId, kind);
-    return icRuntime.StoreMiss(receiverHandle, keyHandle, valueHandle);
+    JSTaggedValue result = icRuntime.StoreMiss(receiverHandle, keyHandle, valueHandle);
+    PGOProfiler *pgoProfiler = thread->GetEcmaVM()->GetPGOProfiler();
+    if (UNLIKELY(pgoProfiler != nullptr)) {
+        pgoProfiler->ProfileIC(thread, JSHandle<ProfileTypeInfo>::Cast(profileInfoHandle), slotId, kind);
+    }
+    return result;
 }
 }  // namespace panda::ecmascript
 
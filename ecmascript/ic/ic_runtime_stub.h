@@ -38,6 +38,13 @@ public:
     static inline JSTaggedValue StoreICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
                                               JSTaggedValue receiver, JSTaggedValue key,
                                               JSTaggedValue value, uint32_t slotId);
+    // the named ics in the megamorphic state, Hole if the receiver is left to the generic path
+    static inline JSTaggedValue LoadMegaICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
+                                                 JSTaggedValue receiver, JSTaggedValue key, uint32_t slotId);
+    static inline JSTaggedValue StoreMegaICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
+                                                  JSTaggedValue receiver, JSTaggedValue key,
+                                                  JSTaggedValue value, uint32_t slotId);
+    static inline bool IsMegaICReceiver(JSTaggedValue receiver);
     static inline JSTaggedValue CheckPolyHClass(JSTaggedValue cachedValue, JSHClass* hclass);
     static inline JSTaggedValue LoadICWithHandler(JSThread *thread, JSTaggedValue receiver, JSTaggedValue holder,
                                                   JSTaggedValue handler);
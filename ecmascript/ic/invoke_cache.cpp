@@ -155,7 +155,7 @@ bool InvokeCache::SetPolyInlineCallCacheSlot(JSThread *thread, ProfileTypeInfo *
     return true;
 }
 
-bool InvokeCache::DecideCanBeInlined(JSMethod *method)
+bool InvokeCache::DecideCanBeInlined(const JSMethod *method)
 {
     constexpr uint32_t MAX_INLINED_BYTECODE_SIZE = 128;
     uint32_t bcSize = method->GetBytecodeArraySize();
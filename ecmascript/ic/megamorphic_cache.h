@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_IC_MEGAMORPHIC_CACHE_H
+#define ECMASCRIPT_IC_MEGAMORPHIC_CACHE_H
+
+#include <array>
+
+#include "ecmascript/js_hclass.h"
+#include "ecmascript/js_tagged_value-inl.h"
+#include "ecmascript/ecma_macros.h"
+
+namespace panda::ecmascript {
+// MegamorphicCache is the stub cache of the named load and store ics in the megamorphic state: it maps the receiver
+// hclass and the key to the ic handler, i.e. a field, accessor or not found handler, a prototype handler or a
+// transition handler, shared by all the megamorphic sites of the thread.
+// Like the PropertiesCache it holds raw pointers and is cleared whenever the gc visits the thread roots. A prototype
+// handler checks its ProtoChangeMarker on use, and the cache is cleared when the hclass of a prototype changes, as
+// a store or transition handler of a receiver hclass may be shadowed by a new setter on its prototype chain.
+class MegamorphicCache {
+public:
+    inline JSTaggedValue GetLoadHandler(JSHClass *jsHclass, JSTaggedValue key) const
+    {
+        return Get(loadEntries_, jsHclass, key);
+    }
+
+    inline void SetLoadHandler(JSHClass *jsHclass, JSTaggedValue key, JSTaggedValue handler)
+    {
+        Set(loadEntries_, jsHclass, key, handler);
+    }
+
+    inline JSTaggedValue GetStoreHandler(JSHClass *jsHclass, JSTaggedValue key) const
+    {
+        return Get(storeEntries_, jsHclass, key);
+    }
+
+    inline void SetStoreHandler(JSHClass *jsHclass, JSTaggedValue key, JSTaggedValue handler)
+    {
+        Set(storeEntries_, jsHclass, key, handler);
+    }
+
+    inline void Clear()
+    {
+        if (empty_) {
+            return;
+        }
+        for (auto &entry : loadEntries_) {
+            entry.hclass_ = nullptr;
+        }
+        for (auto &entry : storeEntries_) {
+            entry.hclass_ = nullptr;
+        }
+        empty_ = true;
+    }
+
+private:
+    MegamorphicCache() = default;
+    ~MegamorphicCache() = default;
+
+    struct Entry {
+        JSHClass *hclass_ {nullptr};
+        JSTaggedValue key_ {JSTaggedValue::Hole()};
+        JSTaggedValue handler_ {JSTaggedValue::Hole()};
+    };
+
+    static const uint32_t CACHE_LENGTH_BIT = 10;
+    static const uint32_t CACHE_LENGTH = (1U << CACHE_LENGTH_BIT);
+    static const uint32_t CACHE_LENGTH_MASK = CACHE_LENGTH - 1;
+
+    using Entries = std::array<Entry, CACHE_LENGTH>;
+
+    static inline uint32_t Hash(JSHClass *cls, JSTaggedValue key)
+    {
+        uint32_t clsHash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(cls)) >> 3U;  // skip 8bytes
+        uint32_t keyHash = key.GetKeyHashCode();
+        return (clsHash ^ keyHash) & CACHE_LENGTH_MASK;
+    }
+
+    static inline JSTaggedValue Get(const Entries &entries, JSHClass *jsHclass, JSTaggedValue key)
+    {
+        const Entry &entry = entries[Hash(jsHclass, key)];
+        if ((entry.hclass_ == jsHclass) && (entry.key_ == key)) {
+            return entry.handler_;
+        }
+        return JSTaggedValue::Hole();
+    }
+
+    inline void Set(Entries &entries, JSHClass *jsHclass, JSTaggedValue key, JSTaggedValue handler)
+    {
+        Entry &entry = entries[Hash(jsHclass, key)];
+        entry.hclass_ = jsHclass;
+        entry.key_ = key;
+        entry.handler_ = handler;
+        empty_ = false;
+    }
+
+    Entries loadEntries_ {};
+    Entries storeEntries_ {};
+    bool empty_ {true};
+
+    friend class JSThread;
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_IC_MEGAMORPHIC_CACHE_H
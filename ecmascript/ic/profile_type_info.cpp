@@ -268,7 +268,7 @@ ProfileTypeAccessor::ICState ProfileTypeAccessor::GetICState() const
         }
         case ICKind::NamedGlobalLoadIC:
         case ICKind::NamedGlobalStoreIC:
-            ASSERT(profileData.IsPropertyBox());
+            ASSERT(profileData.IsPropertyBox() || profileData.IsPrototypeHandler());
             return ICState::MONO;
         case ICKind::GlobalLoadIC:
         case ICKind::GlobalStoreIC: {
@@ -17,6 +17,7 @@
 #define ECMASCRIPT_IC_PROPERTIES_CACHE_H
 
 #include <array>
+#include <utility>
 
 #include "ecmascript/js_hclass.h"
 #include "ecmascript/js_tagged_value-inl.h"
@@ -24,24 +25,35 @@
 
 namespace panda::ecmascript {
 class EcmaVM;
+// PropertiesCache maps the hclass and the key to the index of the property in the layout of the hclass. It is 2-way
+// set associative: a set keeps the most recently used entry first, so that two hot hclass and key pairs of the same
+// set, e.g. of an object with many properties, do not evict each other. It counts its hits and misses to measure the
+// lookups of the layouts which miss it.
 class PropertiesCache {
 public:
     inline int Get(JSHClass *jsHclass, JSTaggedValue key)
     {
-        int hash = Hash(jsHclass, key);
-        PropertyKey &prop = keys_[hash];
-        if ((prop.hclass_ == jsHclass) && (prop.key_ == key)) {
-            return keys_[hash].results_;
+        PropertyKey *set = &keys_[SetIndex(jsHclass, key)];
+        if ((set[0].hclass_ == jsHclass) && (set[0].key_ == key)) {
+            hits_++;
+            return set[0].results_;
         }
+        if ((set[1].hclass_ == jsHclass) && (set[1].key_ == key)) {
+            hits_++;
+            std::swap(set[0], set[1]);
+            return set[0].results_;
+        }
+        misses_++;
         return NOT_FOUND;
     }
     inline void Set(JSHClass *jsHclass, JSTaggedValue key, int index)
     {
-        int hash = Hash(jsHclass, key);
-        PropertyKey &prop = keys_[hash];
-        prop.hclass_ = jsHclass;
-        prop.key_ = key;
-        keys_[hash].results_ = index;
+        PropertyKey *set = &keys_[SetIndex(jsHclass, key)];
+        // the least recently used entry is evicted
+        set[1] = set[0];
+        set[0].hclass_ = jsHclass;
+        set[0].key_ = key;
+        set[0].results_ = index;
     }
     inline void Clear()
     {
@@ -50,6 +62,22 @@ public:
         }
     }
 
+    uint64_t GetHitCount() const
+    {
+        return hits_;
+    }
+
+    uint64_t GetMissCount() const
+    {
+        return misses_;
+    }
+
+    void ResetCounters()
+    {
+        hits_ = 0;
+        misses_ = 0;
+    }
+
     static const int NOT_FOUND = -1;
 
 private:
@@ -69,18 +97,22 @@ private:
         int results_{NOT_FOUND};
     };
 
-    static inline int Hash(JSHClass *cls, JSTaggedValue key)
+    // the index of the first entry of the set
+    static inline uint32_t SetIndex(JSHClass *cls, JSTaggedValue key)
     {
         uint32_t clsHash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(cls)) >> 3U;  // skip 8bytes
         uint32_t keyHash = key.GetKeyHashCode();
-        return static_cast<int>((clsHash ^ keyHash) & CACHE_LENGTH_MASK);
+        return ((clsHash ^ keyHash) & SET_COUNT_MASK) * CACHE_WAYS;
     }
 
     static const uint32_t CACHE_LENGTH_BIT = 10;
     static const uint32_t CACHE_LENGTH = (1U << CACHE_LENGTH_BIT);
-    static const uint32_t CACHE_LENGTH_MASK = CACHE_LENGTH - 1;
+    static const uint32_t CACHE_WAYS = 2;
+    static const uint32_t SET_COUNT_MASK = CACHE_LENGTH / CACHE_WAYS - 1;
 
     std::array<PropertyKey, CACHE_LENGTH> keys_{};
+    uint64_t hits_ {0};
+    uint64_t misses_ {0};
 
     friend class JSThread;
 };
@@ -272,4 +272,35 @@ HWTEST_F_L0(ICHandlerTest, StorePrototype)
     EXPECT_TRUE(resultMarker->IsProtoChangeMarker());
     EXPECT_TRUE(handler->GetHolder().IsJSGlobalObject());
 }
+
+/**
+ * @tc.name: GlobalPrototype
+ * @tc.desc: Call LoadPrototype function with the hclass of the global object,check whether the handler checks the
+ *           marker of the global object and whether a new property of the global object changes the marker.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(ICHandlerTest, GlobalPrototype)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+
+    JSHandle<JSTaggedValue> globalObj(thread, env->GetGlobalObject());
+    JSHandle<JSTaggedValue> handleKey(factory->NewFromASCII("valueOf"));
+    JSHandle<JSTaggedValue> handleValue(thread, JSTaggedValue(1));
+    JSHandle<JSHClass> globalDynclass(thread, JSHandle<JSObject>::Cast(globalObj)->GetJSHClass());
+
+    ObjectOperator handleOp(thread, globalObj, handleKey);
+    EXPECT_TRUE(handleOp.IsFound());
+    EXPECT_TRUE(handleOp.IsOnPrototype());
+    JSHandle<JSTaggedValue> handlerValue = PrototypeHandler::LoadPrototype(thread, handleOp, globalDynclass);
+    JSHandle<PrototypeHandler> handler = JSHandle<PrototypeHandler>::Cast(handlerValue);
+    JSHandle<JSTaggedValue> resultMarker(thread, handler->GetProtoCell());
+    EXPECT_TRUE(resultMarker->IsProtoChangeMarker());
+    EXPECT_EQ(globalDynclass->GetProtoChangeMarker(), resultMarker.GetTaggedValue());
+    EXPECT_FALSE(ProtoChangeMarker::Cast(resultMarker->GetTaggedObject())->GetHasChanged());
+    // the new property shadows the one of the prototype
+    JSObject::SetProperty(thread, globalObj, handleKey, handleValue);
+    EXPECT_TRUE(ProtoChangeMarker::Cast(resultMarker->GetTaggedObject())->GetHasChanged());
+}
 } // namespace panda::test
@@ -17,6 +17,7 @@
 #include "ecmascript/interpreter/slow_runtime_stub.h"
 #include "ecmascript/base/builtins_base.h"
 #include "ecmascript/ic/ic_handler.h"
+#include "ecmascript/ic/megamorphic_cache.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/js_array.h"
 #include "ecmascript/js_object.h"
@@ -176,6 +177,60 @@ HWTEST_F_L0(ICRuntimeStubTest,  StoreICAndLoadIC_ByName)
     EXPECT_EQ(resultValue.GetInt(), 2);
 }
 
+HWTEST_F_L0(ICRuntimeStubTest, StoreAndLoadMegaIC_ByName)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    MegamorphicCache *cache = thread->GetMegamorphicCache();
+
+    JSHandle<JSTaggedValue> objFun = env->GetObjectFunction();
+    JSHandle<JSObject> handleObj = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFun), objFun);
+    JSHandle<JSTaggedValue> handleKey(factory->NewFromASCII("key"));
+    // 2: the two values of the ic slot, both hole in the megamorphic state
+    JSHandle<TaggedArray> handleTaggedArray = factory->NewTaggedArray(2);
+    handleTaggedArray->Set(thread, 0, JSTaggedValue::Hole());
+    handleTaggedArray->Set(thread, 1, JSTaggedValue::Hole());
+    JSHandle<ProfileTypeInfo> handleProfileTypeInfo = JSHandle<ProfileTypeInfo>::Cast(handleTaggedArray);
+
+    // adding the property caches the transition of the old hclass
+    JSHandle<JSHClass> oldHClass(thread, handleObj->GetJSHClass());
+    JSTaggedValue resultValue = ICRuntimeStub::StoreMegaICByName(thread, *handleProfileTypeInfo,
+        handleObj.GetTaggedValue(), handleKey.GetTaggedValue(), JSTaggedValue(1), 0);
+    EXPECT_TRUE(resultValue.IsUndefined());
+    EXPECT_TRUE(cache->GetStoreHandler(*oldHClass, handleKey.GetTaggedValue()).IsTransitionHandler());
+
+    JSHandle<JSHClass> newHClass(thread, handleObj->GetJSHClass());
+    EXPECT_NE(*oldHClass, *newHClass);
+    ICRuntimeStub::StoreMegaICByName(thread, *handleProfileTypeInfo, handleObj.GetTaggedValue(),
+                                     handleKey.GetTaggedValue(), JSTaggedValue(2), 0);
+    EXPECT_TRUE(cache->GetStoreHandler(*newHClass, handleKey.GetTaggedValue()).IsInt());
+    resultValue = ICRuntimeStub::LoadMegaICByName(thread, *handleProfileTypeInfo, handleObj.GetTaggedValue(),
+                                                  handleKey.GetTaggedValue(), 0);
+    EXPECT_EQ(resultValue.GetInt(), 2);
+    EXPECT_TRUE(cache->GetLoadHandler(*newHClass, handleKey.GetTaggedValue()).IsInt());
+    // served by the cached handler
+    resultValue = ICRuntimeStub::LoadMegaICByName(thread, *handleProfileTypeInfo, handleObj.GetTaggedValue(),
+                                                  handleKey.GetTaggedValue(), 0);
+    EXPECT_EQ(resultValue.GetInt(), 2);
+    // the site stays megamorphic
+    EXPECT_TRUE(handleTaggedArray->Get(0).IsHole());
+
+    // a change of a prototype clears the cache
+    JSHandle<JSObject> handleProto(thread, newHClass->GetPrototype());
+    JSHandle<JSHClass> protoHClass(thread, handleProto->GetJSHClass());
+    protoHClass->SetIsPrototype(true);
+    JSHClass::NoticeThroughChain(thread, protoHClass);
+    EXPECT_TRUE(cache->GetLoadHandler(*newHClass, handleKey.GetTaggedValue()).IsHole());
+    EXPECT_TRUE(cache->GetStoreHandler(*newHClass, handleKey.GetTaggedValue()).IsHole());
+
+    // a dictionary receiver is left to the generic path
+    JSHandle<JSObject> handleDictObj = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFun), objFun);
+    JSObject::TransitionToDictionary(thread, handleDictObj);
+    resultValue = ICRuntimeStub::LoadMegaICByName(thread, *handleProfileTypeInfo, handleDictObj.GetTaggedValue(),
+                                                  handleKey.GetTaggedValue(), 0);
+    EXPECT_TRUE(resultValue.IsHole());
+}
+
 HWTEST_F_L0(ICRuntimeStubTest,  StoreICAndLoadIC_ByValue)
 {
     ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
@@ -106,4 +106,27 @@ HWTEST_F_L0(PropertiesCacheTest, Clear)
     handleProCache->Clear();
     EXPECT_EQ(handleProCache->Get(FuncClass, handleKey.GetTaggedValue()), -1); // PropertiesCache::NOT_FOUND
 }
+
+HWTEST_F_L0(PropertiesCacheTest, HitAndMissCount)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+
+    JSHandle<JSTaggedValue> handleKey(factory->NewFromASCII("10"));
+    JSHandle<JSTaggedValue> handleFunction(factory->NewJSFunction(env));
+    JSHClass *FuncClass = JSObject::Cast(handleFunction->GetHeapObject())->GetJSHClass();
+    PropertiesCache *handleProCache = thread->GetPropertiesCache();
+
+    handleProCache->Clear();
+    handleProCache->ResetCounters();
+    EXPECT_EQ(handleProCache->Get(FuncClass, handleKey.GetTaggedValue()), -1); // PropertiesCache::NOT_FOUND
+    EXPECT_EQ(handleProCache->GetMissCount(), 1U);
+    handleProCache->Set(FuncClass, handleKey.GetTaggedValue(), 10);
+    EXPECT_EQ(handleProCache->Get(FuncClass, handleKey.GetTaggedValue()), 10);
+    EXPECT_EQ(handleProCache->GetHitCount(), 1U);
+    EXPECT_EQ(handleProCache->GetMissCount(), 1U);
+    handleProCache->ResetCounters();
+    EXPECT_EQ(handleProCache->GetHitCount(), 0U);
+    EXPECT_EQ(handleProCache->GetMissCount(), 0U);
+}
 } // namespace panda::test
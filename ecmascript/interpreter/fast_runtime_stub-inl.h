@@ -276,17 +276,18 @@ PropertyAttributes FastRuntimeStub::AddPropertyByName(JSThread *thread, JSHandle
 
         uint32_t nonInlinedProps = static_cast<uint32_t>(objHandle->GetJSHClass()->GetNextNonInlinedPropsIndex());
         ASSERT(length >= nonInlinedProps);
-        // if array is full, grow array or change to dictionary mode
+        // the offsets of the in-object and out-of-object properties together must fit in their bitfield
+        if (UNLIKELY(objHandle->GetJSHClass()->NumberOfProps() == PropertyAttributes::MAX_CAPACITY_OF_PROPERTIES)) {
+            // change to dictionary and add one.
+            JSHandle<NameDictionary> dict(JSObject::TransitionToDictionary(thread, objHandle));
+            JSHandle<NameDictionary> newDict =
+                NameDictionary::PutIfAbsent(thread, dict, keyHandle, valueHandle, attr);
+            objHandle->SetProperties(thread, newDict);
+            // index is not essential when fastMode is false;
+            return attr;
+        }
+        // if array is full, grow array
         if (length == nonInlinedProps) {
-            if (UNLIKELY(length == JSHClass::MAX_CAPACITY_OF_OUT_OBJECTS)) {
-                // change to dictionary and add one.
-                JSHandle<NameDictionary> dict(JSObject::TransitionToDictionary(thread, objHandle));
-                JSHandle<NameDictionary> newDict =
-                    NameDictionary::PutIfAbsent(thread, dict, keyHandle, valueHandle, attr);
-                objHandle->SetProperties(thread, newDict);
-                // index is not essential when fastMode is false;
-                return attr;
-            }
             // Grow properties array size
             uint32_t capacity = JSObject::ComputePropertyCapacity(length);
             ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
@@ -320,6 +321,17 @@ JSTaggedValue FastRuntimeStub::AddPropertyByIndex(JSThread *thread, JSTaggedValu
     return success ? JSTaggedValue::Undefined() : JSTaggedValue::Exception();
 }
 
+void FastRuntimeStub::SetElementWithKindTransition(JSThread *thread, JSTaggedValue receiver, uint32_t index,
+                                                   JSTaggedValue value)
+{
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    JSHandle<JSObject> objHandle(thread, receiver);
+    JSHandle<JSTaggedValue> valueHandle(thread, value);
+    JSHClass::UpdateElementsKind(thread, objHandle, TaggedToElementsKind(valueHandle.GetTaggedValue()));
+    TaggedArray *elements = TaggedArray::Cast(objHandle->GetElements().GetTaggedObject());
+    elements->Set(thread, index, valueHandle.GetTaggedValue());
+}
+
 template<bool UseOwn>
 JSTaggedValue FastRuntimeStub::GetPropertyByIndex(JSThread *thread, JSTaggedValue receiver, uint32_t index)
 {
@@ -558,6 +570,10 @@ JSTaggedValue FastRuntimeStub::SetPropertyByIndex(JSThread *thread, JSTaggedValu
             }
             if (index < elements->GetLength()) {
                 if (!elements->Get(index).IsHole()) {
+                    if (UNLIKELY(!hclass->IsElementsKindCompatible(value))) {
+                        SetElementWithKindTransition(thread, receiver, index, value);
+                        return JSTaggedValue::Undefined();
+                    }
                     elements->Set(thread, index, value);
                     return JSTaggedValue::Undefined();
                 }
@@ -845,8 +861,11 @@ bool FastRuntimeStub::SetElement(JSThread *thread, JSTaggedValue receiver, uint3
                 if (attr.IsWritable()) {
                     elements = TaggedArray::Cast(JSObject::Cast(receiver)->GetElements().GetHeapObject());
                     if (!isDict) {
+                        if (UNLIKELY(!JSObject::Cast(receiver)->GetJSHClass()->IsElementsKindCompatible(value))) {
+                            SetElementWithKindTransition(thread, receiver, indexOrEntry, value);
+                            return true;
+                        }
                         elements->Set(thread, indexOrEntry, value);
-                        JSObject::Cast(receiver)->GetJSHClass()->UpdateRepresentation(value);
                         return true;
                     }
                     NumberDictionary::Cast(elements)->UpdateValueAndAttributes(thread, indexOrEntry, value, attr);
@@ -1039,6 +1058,7 @@ bool FastRuntimeStub::SetGlobalOwnProperty(JSThread *thread, JSTaggedValue recei
         JSHandle<GlobalDictionary> properties =
             GlobalDictionary::PutIfAbsent(thread, dictHandle, keyHandle, JSHandle<JSTaggedValue>(boxHandle), attr);
         objHandle->SetProperties(thread, properties);
+        JSHClass::NotifyGlobalBindingAdded(thread, objHandle.GetTaggedValue());
         return true;
     }
 
@@ -1090,6 +1110,7 @@ bool FastRuntimeStub::SetGlobalOwnProperty(JSThread *thread, JSTaggedValue recei
     JSHandle<GlobalDictionary> properties =
         GlobalDictionary::PutIfAbsent(thread, dictHandle, keyHandle, JSHandle<JSTaggedValue>(boxHandle), attr);
     objHandle->SetProperties(thread, properties);
+    JSHClass::NotifyGlobalBindingAdded(thread, objHandle.GetTaggedValue());
     return true;
 }
 
@@ -1141,8 +1162,11 @@ bool FastRuntimeStub::SetOwnElement(JSThread *thread, JSTaggedValue receiver, ui
     if (!val.IsHole()) {
         ASSERT(!attr.IsAccessor() && attr.IsWritable());
         if (!isDict) {
+            if (UNLIKELY(!JSObject::Cast(receiver)->GetJSHClass()->IsElementsKindCompatible(value))) {
+                SetElementWithKindTransition(thread, receiver, indexOrEntry, value);
+                return true;
+            }
             elements->Set(thread, indexOrEntry, value);
-            JSObject::Cast(receiver)->GetJSHClass()->UpdateRepresentation(value);
             return true;
         }
         NumberDictionary::Cast(elements)->UpdateValueAndAttributes(thread, indexOrEntry, value, attr);
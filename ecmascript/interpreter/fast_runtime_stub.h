@@ -116,6 +116,10 @@ private:
                                         PropertyAttributes attr);
     static inline JSTaggedValue AddPropertyByIndex(JSThread *thread, JSTaggedValue receiver, uint32_t index,
                                                    JSTaggedValue value);
+    // slow path of an element store which generalizes the elements kind of receiver; the hclass transition may
+    // allocate, so receiver and value are held in handles across it
+    static inline void SetElementWithKindTransition(JSThread *thread, JSTaggedValue receiver, uint32_t index,
+                                                    JSTaggedValue value);
 
     // non ECMA standard jsapi container
     static inline bool IsSpecialContainer(JSType jsType);
@@ -34,6 +34,7 @@
 #include "ecmascript/js_tagged_value.h"
 #include "ecmascript/mem/concurrent_marker.h"
 #include "ecmascript/module/js_module_manager.h"
+#include "ecmascript/pgo_profiler/pgo_profiler.h"
 #include "ecmascript/runtime_call_id.h"
 #include "ecmascript/template_string.h"
 #include "ecmascript/tooling/interface/js_debugger_manager.h"
@@ -347,6 +348,15 @@ using CommonStubCSigns = kungfu::CommonStubCSigns;
 #define UPDATE_HOTNESS_COUNTER_NON_ACC(offset) static_cast<void>(0)
 #endif
 
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define PROFILE_BRANCH(taken)                                                                     \
+    do {                                                                                          \
+        if (UNLIKELY(pgoProfiler != nullptr)) {                                                   \
+            JSFunction *branchFunc = JSFunction::Cast(GET_FRAME(sp)->function.GetTaggedObject()); \
+            pgoProfiler->ProfileBranch(branchFunc->GetMethod(), pc, taken);                       \
+        }                                                                                         \
+    } while (false)
+
 #define READ_INST_OP() READ_INST_8(0)               // NOLINT(hicpp-signed-bitwise, cppcoreguidelines-macro-usage)
 #define READ_INST_4_0() (READ_INST_8(1) & 0xf)      // NOLINT(hicpp-signed-bitwise, cppcoreguidelines-macro-usage)
 #define READ_INST_4_1() (READ_INST_8(1) >> 4 & 0xf) // NOLINT(hicpp-signed-bitwise, cppcoreguidelines-macro-usage)
@@ -754,6 +764,7 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
     JSHandle<GlobalEnv> globalEnv = ecmaVm->GetGlobalEnv();
     JSTaggedValue globalObj = globalEnv->GetGlobalObject();
     ObjectFactory *factory = ecmaVm->GetFactory();
+    PGOProfiler *pgoProfiler = ecmaVm->GetPGOProfiler();
 
     constexpr size_t numOps = 0x100;
     static std::array<const void *, numOps> instDispatchTable {
@@ -823,9 +834,11 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
                    << "cond jmpz " << std::hex << static_cast<int32_t>(offset);
         if (GET_ACC() == JSTaggedValue::False() || (GET_ACC().IsInt() && GET_ACC().GetInt() == 0) ||
             (GET_ACC().IsDouble() && GET_ACC().GetDouble() == 0)) {
+            PROFILE_BRANCH(true);
             UPDATE_HOTNESS_COUNTER(offset);
             DISPATCH_OFFSET(offset);
         } else {
+            PROFILE_BRANCH(false);
             DISPATCH(BytecodeInstruction::Format::PREF_NONE);
         }
     }
@@ -835,9 +848,11 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
                    << "cond jmpz " << std::hex << static_cast<int32_t>(offset);
         if (GET_ACC() == JSTaggedValue::False() || (GET_ACC().IsInt() && GET_ACC().GetInt() == 0) ||
             (GET_ACC().IsDouble() && GET_ACC().GetDouble() == 0)) {
+            PROFILE_BRANCH(true);
             UPDATE_HOTNESS_COUNTER(offset);
             DISPATCH_OFFSET(offset);
         } else {
+            PROFILE_BRANCH(false);
             DISPATCH(BytecodeInstruction::Format::IMM16);
         }
     }
@@ -847,9 +862,11 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
                    << "cond jmpz " << std::hex << static_cast<int32_t>(offset);
         if (GET_ACC() == JSTaggedValue::True() || (GET_ACC().IsInt() && GET_ACC().GetInt() != 0) ||
             (GET_ACC().IsDouble() && GET_ACC().GetDouble() != 0)) {
+            PROFILE_BRANCH(true);
             UPDATE_HOTNESS_COUNTER(offset);
             DISPATCH_OFFSET(offset);
         } else {
+            PROFILE_BRANCH(false);
             DISPATCH(BytecodeInstruction::Format::PREF_NONE);
         }
     }
@@ -859,9 +876,11 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
                    << "cond jmpz " << std::hex << static_cast<int32_t>(offset);
         if (GET_ACC() == JSTaggedValue::True() || (GET_ACC().IsInt() && GET_ACC().GetInt() != 0) ||
             (GET_ACC().IsDouble() && GET_ACC().GetDouble() != 0)) {
+            PROFILE_BRANCH(true);
             UPDATE_HOTNESS_COUNTER(offset);
             DISPATCH_OFFSET(offset);
         } else {
+            PROFILE_BRANCH(false);
             DISPATCH(BytecodeInstruction::Format::IMM16);
         }
     }
@@ -1011,6 +1030,11 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
                 }
                 INTERPRETER_GOTO_EXCEPTION_HANDLER();
             }
+            if (UNLIKELY(pgoProfiler != nullptr)) {
+                // pc still points to the call bytecode of the caller
+                JSMethod *caller = JSFunction::Cast(GET_FRAME(sp)->function.GetTaggedObject())->GetMethod();
+                pgoProfiler->ProfileCall(caller, pc, method);
+            }
             uint64_t callField = method->GetCallField();
             if ((callField & CALL_TYPE_MASK) != 0) {
                 // not normal call type, setting func/newTarget/this cannot be skipped
@@ -2550,7 +2574,7 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
         JSObject *result = JSObject::Cast(constpool->GetObjectFromCache(imm).GetTaggedObject());
 
         SAVE_PC();
-        JSTaggedValue res = SlowRuntimeStub::CreateObjectWithBuffer(thread, factory, result);
+        JSTaggedValue res = SlowRuntimeStub::CreateObjectWithBuffer(thread, factory, result, ToUintPtr(pc));
         INTERPRETER_RETURN_IF_ABRUPT(res);
         SET_ACC(res);
         DISPATCH(BytecodeInstruction::Format::PREF_IMM16);
@@ -2575,7 +2599,7 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
                    << " imm:" << imm;
         JSArray *result = JSArray::Cast(constpool->GetObjectFromCache(imm).GetTaggedObject());
         SAVE_PC();
-        JSTaggedValue res = SlowRuntimeStub::CreateArrayWithBuffer(thread, factory, result);
+        JSTaggedValue res = SlowRuntimeStub::CreateArrayWithBuffer(thread, factory, result, ToUintPtr(pc));
         INTERPRETER_RETURN_IF_ABRUPT(res);
         SET_ACC(res);
         DISPATCH(BytecodeInstruction::Format::PREF_IMM16);
@@ -3307,6 +3331,15 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 SET_ACC(res);
                 DISPATCH(BytecodeInstruction::Format::PREF_ID32_V8);
+            } else {  // megamorphic, look the handler up in the cache of the thread
+                uint32_t stringId = READ_INST_32_1();
+                JSTaggedValue propKey = constpool->GetObjectFromCache(stringId);
+                res = ICRuntimeStub::LoadMegaICByName(thread, profileTypeArray, receiver, propKey, slotId);
+                if (!res.IsHole()) {
+                    INTERPRETER_RETURN_IF_ABRUPT(res);
+                    SET_ACC(res);
+                    DISPATCH(BytecodeInstruction::Format::PREF_ID32_V8);
+                }
             }
         }
 #endif
@@ -3364,6 +3397,15 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, ConstantPool
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 RESTORE_ACC();
                 DISPATCH(BytecodeInstruction::Format::PREF_ID32_V8);
+            } else {  // megamorphic, look the handler up in the cache of the thread
+                uint32_t stringId = READ_INST_32_1();
+                JSTaggedValue propKey = constpool->GetObjectFromCache(stringId);
+                res = ICRuntimeStub::StoreMegaICByName(thread, profileTypeArray, receiver, propKey, value, slotId);
+                if (!res.IsHole()) {
+                    INTERPRETER_RETURN_IF_ABRUPT(res);
+                    RESTORE_ACC();
+                    DISPATCH(BytecodeInstruction::Format::PREF_ID32_V8);
+                }
             }
         }
 #endif
@@ -4068,6 +4110,7 @@ std::string GetEcmaOpcodeStr(EcmaOpcode opcode)
 #undef CALL_PUSH_ARGS
 #undef UPDATE_HOTNESS_COUNTER_NON_ACC
 #undef UPDATE_HOTNESS_COUNTER
+#undef PROFILE_BRANCH
 #undef GET_VREG
 #undef GET_VREG_VALUE
 #undef SET_VREG
@@ -2823,7 +2823,7 @@ void InterpreterAssembly::HandleCreateObjectWithBufferPrefImm16(
         ConstantPool::Cast(constpool.GetTaggedObject())->GetObjectFromCache(imm).GetTaggedObject());
     EcmaVM *ecmaVm = thread->GetEcmaVM();
     ObjectFactory *factory = ecmaVm->GetFactory();
-    JSTaggedValue res = SlowRuntimeStub::CreateObjectWithBuffer(thread, factory, result);
+    JSTaggedValue res = SlowRuntimeStub::CreateObjectWithBuffer(thread, factory, result, ToUintPtr(pc));
     INTERPRETER_RETURN_IF_ABRUPT(res);
     SET_ACC(res);
     DISPATCH(BytecodeInstruction::Format::PREF_IMM16);
@@ -2857,7 +2857,7 @@ void InterpreterAssembly::HandleCreateArrayWithBufferPrefImm16(
         ConstantPool::Cast(constpool.GetTaggedObject())->GetObjectFromCache(imm).GetTaggedObject());
     EcmaVM *ecmaVm = thread->GetEcmaVM();
     ObjectFactory *factory = ecmaVm->GetFactory();
-    JSTaggedValue res = SlowRuntimeStub::CreateArrayWithBuffer(thread, factory, result);
+    JSTaggedValue res = SlowRuntimeStub::CreateArrayWithBuffer(thread, factory, result, ToUintPtr(pc));
     INTERPRETER_RETURN_IF_ABRUPT(res);
     SET_ACC(res);
     DISPATCH(BytecodeInstruction::Format::PREF_IMM16);
@@ -3683,6 +3683,10 @@ void InterpreterAssembly::HandleLdObjByNamePrefId32V8(
             uint32_t stringId = READ_INST_32_1();
             JSTaggedValue propKey = ConstantPool::Cast(constpool.GetTaggedObject())->GetObjectFromCache(stringId);
             res = ICRuntimeStub::LoadICByName(thread, profileTypeArray, receiver, propKey, slotId);
+        } else if (firstValue.IsHole()) {  // megamorphic, look the handler up in the cache of the thread
+            uint32_t stringId = READ_INST_32_1();
+            JSTaggedValue propKey = ConstantPool::Cast(constpool.GetTaggedObject())->GetObjectFromCache(stringId);
+            res = ICRuntimeStub::LoadMegaICByName(thread, profileTypeArray, receiver, propKey, slotId);
         }
 
         if (LIKELY(!res.IsHole())) {
@@ -3740,6 +3744,10 @@ void InterpreterAssembly::HandleStObjByNamePrefId32V8(
             uint32_t stringId = READ_INST_32_1();
             JSTaggedValue propKey = ConstantPool::Cast(constpool.GetTaggedObject())->GetObjectFromCache(stringId);
             res = ICRuntimeStub::StoreICByName(thread, profileTypeArray, receiver, propKey, value, slotId);
+        } else if (firstValue.IsHole()) {  // megamorphic, look the handler up in the cache of the thread
+            uint32_t stringId = READ_INST_32_1();
+            JSTaggedValue propKey = ConstantPool::Cast(constpool.GetTaggedObject())->GetObjectFromCache(stringId);
+            res = ICRuntimeStub::StoreMegaICByName(thread, profileTypeArray, receiver, propKey, value, slotId);
         }
 
         if (LIKELY(!res.IsHole())) {
@@ -37,6 +37,7 @@
 #include "ecmascript/js_proxy.h"
 #include "ecmascript/js_tagged_value-inl.h"
 #include "ecmascript/js_thread.h"
+#include "ecmascript/mem/allocation_site_tracker.h"
 #include "ecmascript/module/js_module_manager.h"
 #include "ecmascript/tagged_dictionary.h"
 #include "ecmascript/runtime_call_id.h"
@@ -1107,6 +1108,7 @@ JSTaggedValue SlowRuntimeStub::CreateEmptyArray(JSThread *thread, ObjectFactory
 
     JSHandle<JSFunction> builtinObj(globalEnv->GetArrayFunction());
     JSHandle<JSObject> arr = factory->NewJSObjectByConstructor(builtinObj, JSHandle<JSTaggedValue>(builtinObj));
+    JSHClass::TransitionElementsKind(thread, arr, ElementsKind::PACKED_INT);
     return arr.GetTaggedValue();
 }
 
@@ -1121,14 +1123,20 @@ JSTaggedValue SlowRuntimeStub::CreateEmptyObject(JSThread *thread, ObjectFactory
     return obj.GetTaggedValue();
 }
 
-JSTaggedValue SlowRuntimeStub::CreateObjectWithBuffer(JSThread *thread, ObjectFactory *factory, JSObject *literal)
+JSTaggedValue SlowRuntimeStub::CreateObjectWithBuffer(JSThread *thread, ObjectFactory *factory, JSObject *literal,
+                                                      uintptr_t site)
 {
     INTERPRETER_TRACE(thread, CreateObjectWithBuffer);
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
 
     JSHandle<JSObject> obj(thread, literal);
-    JSHandle<JSObject> objLiteral = factory->CloneObjectLiteral(obj);
+    AllocationSiteTracker *tracker = thread->GetEcmaVM()->GetHeap()->GetAllocationSiteTracker();
+    MemSpaceType spaceType = tracker->GetAllocationSpace(site);
+    JSHandle<JSObject> objLiteral = factory->CloneObjectLiteral(obj, spaceType);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    if (spaceType == MemSpaceType::SEMI_SPACE) {
+        tracker->RecordAllocation(site, *objLiteral);
+    }
 
     return objLiteral.GetTaggedValue();
 }
@@ -1230,14 +1238,20 @@ JSTaggedValue SlowRuntimeStub::CreateRegExpWithLiteral(JSThread *thread, JSTagge
     return builtins::BuiltinsRegExp::RegExpCreate(thread, patternHandle, flagsHandle);
 }
 
-JSTaggedValue SlowRuntimeStub::CreateArrayWithBuffer(JSThread *thread, ObjectFactory *factory, JSArray *literal)
+JSTaggedValue SlowRuntimeStub::CreateArrayWithBuffer(JSThread *thread, ObjectFactory *factory, JSArray *literal,
+                                                     uintptr_t site)
 {
     INTERPRETER_TRACE(thread, CreateArrayWithBuffer);
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
 
     JSHandle<JSArray> array(thread, literal);
-    JSHandle<JSArray> arrLiteral = factory->CloneArrayLiteral(array);
+    AllocationSiteTracker *tracker = thread->GetEcmaVM()->GetHeap()->GetAllocationSiteTracker();
+    MemSpaceType spaceType = tracker->GetAllocationSpace(site);
+    JSHandle<JSArray> arrLiteral = factory->CloneArrayLiteral(array, spaceType);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    if (spaceType == MemSpaceType::SEMI_SPACE) {
+        tracker->RecordAllocation(site, *arrLiteral);
+    }
 
     return arrLiteral.GetTaggedValue();
 }
@@ -1665,6 +1679,8 @@ JSTaggedValue SlowRuntimeStub::StGlobalRecord(JSThread *thread, JSTaggedValue pr
     dict = *GlobalDictionary::PutIfAbsent(thread, dictHandle, propHandle, JSHandle<JSTaggedValue>(box), attributes);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
     env->SetGlobalRecord(thread, JSTaggedValue(dict));
+    // the binding shadows a property of the prototype chain of the global object
+    JSHClass::NotifyGlobalBindingAdded(thread, env->GetGlobalObject());
     return JSTaggedValue::True();
 }
 
@@ -95,11 +95,14 @@ public:
                                                  JSTaggedValue value);
     static JSTaggedValue CreateEmptyArray(JSThread *thread, ObjectFactory *factory, JSHandle<GlobalEnv> globalEnv);
     static JSTaggedValue CreateEmptyObject(JSThread *thread, ObjectFactory *factory, JSHandle<GlobalEnv> globalEnv);
-    static JSTaggedValue CreateObjectWithBuffer(JSThread *thread, ObjectFactory *factory, JSObject *literal);
+    // site: the pc of the bytecode, the allocation site whose pretenuring decision applies
+    static JSTaggedValue CreateObjectWithBuffer(JSThread *thread, ObjectFactory *factory, JSObject *literal,
+                                                uintptr_t site);
     static JSTaggedValue CreateObjectHavingMethod(JSThread *thread, ObjectFactory *factory, JSObject *literal,
                                                   JSTaggedValue env, ConstantPool *constpool);
     static JSTaggedValue SetObjectWithProto(JSThread *thread, JSTaggedValue proto, JSTaggedValue obj);
-    static JSTaggedValue CreateArrayWithBuffer(JSThread *thread, ObjectFactory *factory, JSArray *literal);
+    static JSTaggedValue CreateArrayWithBuffer(JSThread *thread, ObjectFactory *factory, JSArray *literal,
+                                               uintptr_t site);
 
     static JSTaggedValue GetTemplateObject(JSThread *thread, JSTaggedValue literal);
     static JSTaggedValue GetNextPropName(JSThread *thread, JSTaggedValue iter);
@@ -18,6 +18,7 @@
 #include "ecmascript/base/array_helper.h"
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/global_env.h"
+#include "ecmascript/js_stable_array.h"
 #include "ecmascript/js_tagged_value-inl.h"
 #include "ecmascript/object_factory.h"
 #include "interpreter/fast_runtime_stub-inl.h"
@@ -215,6 +216,10 @@ void JSArray::SetCapacity(JSThread *thread, const JSHandle<JSObject> &array, uin
     } else if (newLen > capacity) {
         JSObject::GrowElementsCapacity(thread, array, newLen);
     }
+    if (newLen > oldLen) {
+        // the elements from the old length on are holes
+        JSHClass::UpdateElementsKind(thread, array, ElementsKind::HOLEY_INT);
+    }
     JSArray::Cast(*array)->SetArrayLength(thread, newLen);
 }
 
@@ -383,6 +388,12 @@ void JSArray::Sort(JSThread *thread, const JSHandle<JSObject> &obj, const JSHand
         THROW_TYPE_ERROR(thread, "Callable is false");
     }
 
+    JSHandle<JSTaggedValue> objValue(obj);
+    if (objValue->IsStableJSArray(thread)) {
+        JSStableArray::Sort(thread, JSHandle<JSArray>::Cast(obj), fn);
+        return;
+    }
+
     // 2. Let len be ToLength(Get(obj, "length")).
     double len = base::ArrayHelper::GetArrayLength(thread, JSHandle<JSTaggedValue>(obj));
     // 3. ReturnIfAbrupt(len).
@@ -15,6 +15,8 @@
 
 #include "js_function.h"
 
+#include <algorithm>
+
 #include "ecmascript/base/error_type.h"
 #include "ecmascript/ecma_macros.h"
 #include "ecmascript/ecma_runtime_call_info.h"
@@ -105,11 +107,42 @@ JSHClass *JSFunction::GetOrCreateInitialJSHClass(JSThread *thread, const JSHandl
         proto = JSHandle<JSTaggedValue>(thread, fun->GetProtoOrDynClass());
     }
 
-    JSHandle<JSHClass> dynclass = factory->NewEcmaDynClass(JSObject::SIZE, JSType::JS_OBJECT, proto);
+    JSHandle<JSHClass> dynclass = factory->NewEcmaDynClass(JSObject::SIZE, JSType::JS_OBJECT, proto,
+                                                           JSHClass::SLACK_TRACKING_CAPACITY_OF_IN_OBJECTS);
+    dynclass->SetConstructionCounter(JSHClass::SLACK_TRACKING_CONSTRUCTIONS);
     fun->SetProtoOrDynClass(thread, dynclass);
     return *dynclass;
 }
 
+JSHandle<JSHClass> JSFunction::TrackSlack(JSThread *thread, const JSHandle<JSFunction> &fun,
+                                          const JSHandle<JSHClass> &dynclass)
+{
+    if (!dynclass->IsSlackTracking()) {
+        return dynclass;
+    }
+    uint32_t counter = dynclass->GetConstructionCounter() - 1;
+    dynclass->SetConstructionCounter(counter);
+    if (counter != 0) {
+        return dynclass;
+    }
+
+    // The instances built so far keep the slack, their hclasses are not shrunk in place as the gc and the heap
+    // verifier walk the objects by the size in their hclass. Later instances start from a new initial hclass which
+    // has room in-object for as many properties as any instance got, and which builds its own transitions.
+    uint32_t usedInlinedProps = std::min(JSHClass::GetMaxNumberOfPropsInTransitions(*dynclass),
+                                         dynclass->GetInlinedProperties());
+    if (usedInlinedProps == dynclass->GetInlinedProperties()) {
+        return dynclass;
+    }
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<JSTaggedValue> proto(thread, dynclass->GetPrototype());
+    JSHandle<JSHClass> newDynclass = factory->NewEcmaDynClass(dynclass->GetInlinedPropsStartSize(),
+                                                              dynclass->GetObjectType(), proto, usedInlinedProps);
+    newDynclass->SetBitField(dynclass->GetBitField());
+    fun->SetProtoOrDynClass(thread, newDynclass);
+    return newDynclass;
+}
+
 JSTaggedValue JSFunction::PrototypeGetter(JSThread *thread, const JSHandle<JSObject> &self)
 {
     JSHandle<JSFunction> func = JSHandle<JSFunction>::Cast(self);
@@ -129,6 +162,7 @@ bool JSFunction::PrototypeSetter(JSThread *thread, const JSHandle<JSObject> &sel
         // need transition
         JSHandle<JSHClass> dynclass(thread, protoOrDyn);
         JSHandle<JSHClass> newDynclass = JSHClass::TransitionProto(thread, dynclass, value);
+        newDynclass->SetConstructionCounter(dynclass->GetConstructionCounter());
         if (value->IsECMAObject()) {
             JSObject::Cast(value->GetTaggedObject())->GetJSHClass()->SetIsPrototype(true);
         }
@@ -514,7 +548,7 @@ JSHandle<JSHClass> JSFunction::GetInstanceJSHClass(JSThread *thread, JSHandle<JS
     JSHandle<JSHClass> ctorInitialJSHClass(thread, JSFunction::GetOrCreateInitialJSHClass(thread, constructor));
     // newTarget is construct itself
     if (newTarget.GetTaggedValue() == constructor.GetTaggedValue()) {
-        return ctorInitialJSHClass;
+        return TrackSlack(thread, constructor, ctorInitialJSHClass);
     }
 
     // newTarget is derived-class of constructor
@@ -523,7 +557,8 @@ JSHandle<JSHClass> JSFunction::GetInstanceJSHClass(JSThread *thread, JSHandle<JS
         if (newTargetFunc->IsDerivedConstructor()) {
             JSTaggedValue newTargetProto = JSTaggedValue::GetPrototype(thread, newTarget);
             if (newTargetProto == constructor.GetTaggedValue()) {
-                return GetOrCreateDerivedJSHClass(thread, newTargetFunc, ctorInitialJSHClass);
+                return TrackSlack(thread, newTargetFunc,
+                                  GetOrCreateDerivedJSHClass(thread, newTargetFunc, ctorInitialJSHClass));
             }
         }
     }
@@ -566,11 +601,20 @@ JSHandle<JSHClass> JSFunction::GetOrCreateDerivedJSHClass(JSThread *thread, JSHa
         return JSHandle<JSHClass>(thread, protoOrDyn);
     }
 
-    JSHandle<JSHClass> newJSHClass = JSHClass::Clone(thread, ctorInitialJSHClass);
     // guarante derived has function prototype
     JSHandle<JSTaggedValue> prototype(thread, derived->GetProtoOrDynClass());
     ASSERT(!prototype->IsHole());
-    newJSHClass->SetPrototype(thread, prototype);
+    JSHandle<JSHClass> newJSHClass;
+    if (ctorInitialJSHClass->GetObjectType() == JSType::JS_OBJECT && ctorInitialJSHClass->NumberOfProps() == 0) {
+        // the instances of derived get the properties of both classes, track their slack from the start again
+        ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+        newJSHClass = factory->NewEcmaDynClass(JSObject::SIZE, JSType::JS_OBJECT, prototype,
+                                               JSHClass::SLACK_TRACKING_CAPACITY_OF_IN_OBJECTS);
+        newJSHClass->SetConstructionCounter(JSHClass::SLACK_TRACKING_CONSTRUCTIONS);
+    } else {
+        newJSHClass = JSHClass::Clone(thread, ctorInitialJSHClass);
+        newJSHClass->SetPrototype(thread, prototype);
+    }
     derived->SetProtoOrDynClass(thread, newJSHClass);
     return newJSHClass;
 }
@@ -228,6 +228,10 @@ public:
 private:
     static JSHandle<JSHClass> GetOrCreateDerivedJSHClass(JSThread *thread, JSHandle<JSFunction> derived,
                                                          JSHandle<JSHClass> ctorInitialDynClass);
+    // count one construction with the initial dynclass of fun, and shrink the in-object space of the later
+    // instances to the observed need once the slack tracking finishes
+    static JSHandle<JSHClass> TrackSlack(JSThread *thread, const JSHandle<JSFunction> &fun,
+                                         const JSHandle<JSHClass> &dynclass);
 };
 
 class JSGeneratorFunction : public JSFunction {
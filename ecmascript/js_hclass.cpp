@@ -19,6 +19,7 @@
 
 #include "ecmascript/base/config.h"
 #include "ecmascript/global_env.h"
+#include "ecmascript/ic/megamorphic_cache.h"
 #include "ecmascript/ic/proto_change_details.h"
 #include "ecmascript/js_object-inl.h"
 #include "ecmascript/js_symbol.h"
@@ -137,7 +138,7 @@ void JSHClass::Initialize(const JSThread *thread, uint32_t size, JSType type, ui
     SetObjectType(type);
     SetExtensible(true);
     SetIsPrototype(false);
-    SetElementRepresentation(Representation::NONE);
+    SetElementsKind(ElementsKind::HOLEY_ELEMENTS);
     SetTransitions(thread, JSTaggedValue::Undefined());
     SetProtoChangeMarker(thread, JSTaggedValue::Null());
     SetProtoChangeDetails(thread, JSTaggedValue::Null());
@@ -156,6 +157,8 @@ JSHandle<JSHClass> JSHClass::Clone(const JSThread *thread, const JSHandle<JSHCla
     newJshclass->SetTransitions(thread, JSTaggedValue::Undefined());
     newJshclass->SetProtoChangeDetails(thread, JSTaggedValue::Null());
     newJshclass->SetEnumCache(thread, JSTaggedValue::Null());
+    // only the initial hclass of a constructor tracks its slack
+    newJshclass->SetConstructionCounter(0);
     // reuse Attributes first.
     newJshclass->SetLayout(thread, jshclass->GetLayout());
 
@@ -173,9 +176,94 @@ void JSHClass::TransitionElementsToDictionary(const JSThread *thread, const JSHa
     // property transition to slow first
     if (!obj->GetJSHClass()->IsDictionaryMode()) {
         JSObject::TransitionToDictionary(thread, obj);
+    } else {
+        // a dictionary hclass is not shared, while the element ics of the object, e.g. the global object, cached it
+        // together with a handler of the fast elements
+        JSHandle<JSHClass> jshclass(thread, obj->GetJSHClass());
+        JSHandle<JSHClass> newJshclass = JSHClass::Clone(thread, jshclass);
+#if ECMASCRIPT_ENABLE_IC
+        JSHClass::NotifyHclassChanged(thread, jshclass, newJshclass);
+#endif
+        obj->SetClass(newJshclass);
     }
     obj->GetJSHClass()->SetIsDictionaryElement(true);
     obj->GetJSHClass()->SetIsStableElements(false);
+    obj->GetJSHClass()->SetElementsKind(ElementsKind::HOLEY_ELEMENTS);
+}
+
+void JSHClass::TransitionElementsKind(const JSThread *thread, const JSHandle<JSObject> &obj, ElementsKind kind)
+{
+    JSHandle<JSHClass> jshclass(thread, obj->GetJSHClass());
+    if (jshclass->GetElementsKind() == kind) {
+        return;
+    }
+    // a dictionary hclass is not shared
+    if (jshclass->IsDictionaryMode()) {
+        jshclass->SetElementsKind(kind);
+        return;
+    }
+
+    JSHandle<JSTaggedValue> key = thread->GetEcmaVM()->GetGlobalEnv()->GetElementsKindSymbol();
+    JSHandle<JSTaggedValue> metaData(thread, JSTaggedValue(static_cast<int32_t>(kind)));
+    JSHandle<JSHClass> newJshclass;
+    JSHClass *newDyn = jshclass->FindProtoTransitions(key.GetTaggedValue(), metaData.GetTaggedValue());
+    if (newDyn != nullptr) {
+        newJshclass = JSHandle<JSHClass>(thread, newDyn);
+    } else {
+        ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+        newJshclass = JSHClass::Clone(thread, jshclass);
+        newJshclass->SetElementsKind(kind);
+        {
+            JSMutableHandle<LayoutInfo> layoutInfoHandle(thread, newJshclass->GetLayout());
+            layoutInfoHandle.Update(factory->CopyLayoutInfo(layoutInfoHandle).GetTaggedValue());
+            newJshclass->SetLayout(thread, layoutInfoHandle);
+        }
+        AddProtoTransitions(thread, jshclass, newJshclass, key, metaData);
+    }
+
+#if ECMASCRIPT_ENABLE_IC
+    JSHClass::NotifyHclassChanged(thread, jshclass, newJshclass);
+#endif
+    obj->SetClass(*newJshclass);
+}
+
+void JSHClass::UpdateElementsKind(const JSThread *thread, const JSHandle<JSObject> &obj, ElementsKind kind)
+{
+    ElementsKind oldKind = obj->GetJSHClass()->GetElementsKind();
+    ElementsKind newKind = MergeElementsKind(oldKind, kind);
+    if (newKind != oldKind) {
+        TransitionElementsKind(thread, obj, newKind);
+    }
+}
+
+uint32_t JSHClass::GetMaxNumberOfPropsInTransitions(const JSHClass *jshclass)
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    uint32_t maxNumberOfProps = 0;
+    CVector<const JSHClass *> worklist {jshclass};
+    while (!worklist.empty()) {
+        const JSHClass *current = worklist.back();
+        worklist.pop_back();
+        maxNumberOfProps = std::max(maxNumberOfProps, current->NumberOfProps());
+        JSTaggedValue transitions = current->GetTransitions();
+        if (transitions.IsUndefined()) {
+            continue;
+        }
+        if (transitions.IsWeak()) {
+            worklist.emplace_back(JSHClass::Cast(transitions.GetTaggedWeakRef()));
+            continue;
+        }
+        TransitionsDictionary *dict = TransitionsDictionary::Cast(transitions.GetTaggedObject());
+        int size = dict->Size();
+        for (int entry = 0; entry < size; entry++) {
+            JSTaggedValue child = dict->GetValue(entry);
+            // the gc clears the entries of the dead hclasses
+            if (dict->IsKey(dict->GetKey(entry)) && child.IsWeak()) {
+                worklist.emplace_back(JSHClass::Cast(child.GetTaggedWeakRef()));
+            }
+        }
+    }
+    return maxNumberOfProps;
 }
 
 JSHandle<JSHClass> JSHClass::SetPropertyOfObjHClass(const JSThread *thread, JSHandle<JSHClass> &jshclass,
@@ -354,7 +442,22 @@ JSHandle<JSTaggedValue> JSHClass::EnableProtoChangeMarker(const JSThread *thread
     JSHandle<JSObject> protoHandle(thread, proto);
     JSHandle<JSHClass> protoDyncalss(thread, protoHandle->GetJSHClass());
     RegisterOnProtoChain(thread, protoDyncalss);
-    JSTaggedValue protoChangeMarker = protoDyncalss->GetProtoChangeMarker();
+    return GetOrCreateProtoChangeMarker(thread, protoDyncalss);
+}
+
+JSHandle<JSTaggedValue> JSHClass::EnableGlobalChangeMarker(const JSThread *thread, const JSHandle<JSHClass> &jshclass)
+{
+    ASSERT(jshclass->IsJSGlobalObject());
+    // the hclass of the global object is not a prototype one unless some object inherits from the global object
+    jshclass->SetIsPrototype(true);
+    RegisterOnProtoChain(thread, jshclass);
+    return GetOrCreateProtoChangeMarker(thread, jshclass);
+}
+
+JSHandle<JSTaggedValue> JSHClass::GetOrCreateProtoChangeMarker(const JSThread *thread,
+                                                               const JSHandle<JSHClass> &jshclass)
+{
+    JSTaggedValue protoChangeMarker = jshclass->GetProtoChangeMarker();
     if (protoChangeMarker.IsProtoChangeMarker()) {
         JSHandle<ProtoChangeMarker> markerHandle(thread, ProtoChangeMarker::Cast(protoChangeMarker.GetTaggedObject()));
         if (!markerHandle->GetHasChanged()) {
@@ -363,10 +466,21 @@ JSHandle<JSTaggedValue> JSHClass::EnableProtoChangeMarker(const JSThread *thread
     }
     JSHandle<ProtoChangeMarker> markerHandle = thread->GetEcmaVM()->GetFactory()->NewProtoChangeMarker();
     markerHandle->SetHasChanged(false);
-    protoDyncalss->SetProtoChangeMarker(thread, markerHandle.GetTaggedValue());
+    jshclass->SetProtoChangeMarker(thread, markerHandle.GetTaggedValue());
     return JSHandle<JSTaggedValue>(markerHandle);
 }
 
+void JSHClass::NotifyGlobalBindingAdded(const JSThread *thread, JSTaggedValue globalObject)
+{
+#if ECMASCRIPT_ENABLE_IC
+    JSHClass *jshclass = JSObject::Cast(globalObject.GetTaggedObject())->GetJSHClass();
+    if (!jshclass->IsPrototype()) {
+        return;
+    }
+    NoticeThroughChain(thread, JSHandle<JSHClass>(thread, jshclass));
+#endif
+}
+
 void JSHClass::NotifyHclassChanged(const JSThread *thread, JSHandle<JSHClass> oldHclass, JSHandle<JSHClass> newHclass)
 {
     if (!oldHclass->IsPrototype()) {
@@ -477,6 +591,8 @@ void JSHClass::NoticeRegisteredUser([[maybe_unused]] const JSThread *thread, con
 
 void JSHClass::NoticeThroughChain(const JSThread *thread, const JSHandle<JSHClass> &jshclass)
 {
+    // the handlers of the megamorphic sites are not registered on the prototype chain
+    thread->GetMegamorphicCache()->Clear();
     NoticeRegisteredUser(thread, jshclass);
     JSTaggedValue protoDetailsValue = jshclass->GetProtoChangeDetails();
     if (!protoDetailsValue.IsProtoChangeDetails()) {
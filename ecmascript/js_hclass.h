@@ -17,6 +17,7 @@
 #define ECMASCRIPT_JS_HCLASS_H
 
 #include "ecmascript/ecma_macros.h"
+#include "ecmascript/elements_kind.h"
 #include "ecmascript/mem/tagged_object.h"
 #include "ecmascript/js_tagged_value.h"
 #include "ecmascript/property_attributes.h"
@@ -234,18 +235,22 @@ public:
     using BuiltinsCtorBit = ConstrutorBit::NextFlag;  // 10
     using ExtensibleBit = BuiltinsCtorBit::NextFlag;
     using IsPrototypeBit = ExtensibleBit::NextFlag;
-    using ElementRepresentationBits = IsPrototypeBit::NextField<Representation, 3>;        // 3 means next 3 bit
-    using DictionaryElementBits = ElementRepresentationBits::NextFlag;                     // 16
+    using ElementsKindBits = IsPrototypeBit::NextField<ElementsKind, ELEMENTS_KIND_BITFIELD_NUM>;  // 15
+    using DictionaryElementBits = ElementsKindBits::NextFlag;                              // 16
     using IsDictionaryBit = DictionaryElementBits::NextFlag;                               // 17
     using IsStableElementsBit = IsDictionaryBit::NextFlag;                                 // 18
     using HasConstructorBits = IsStableElementsBit::NextFlag;                              // 19
     using IsLiteralBit = HasConstructorBits::NextFlag;                                     // 20
     using ClassConstructorBit = IsLiteralBit::NextFlag;                                    // 21
     using ClassPrototypeBit = ClassConstructorBit::NextFlag;                               // 22
+    static constexpr int CONSTRUCTION_COUNTER_BITFIELD_NUM = 3;
+    using ConstructionCounterBits = ClassPrototypeBit::NextField<uint32_t, CONSTRUCTION_COUNTER_BITFIELD_NUM>; // 25
 
     static constexpr int DEFAULT_CAPACITY_OF_IN_OBJECTS = 4;
-    static constexpr int MAX_CAPACITY_OF_OUT_OBJECTS =
-        PropertyAttributes::MAX_CAPACITY_OF_PROPERTIES - DEFAULT_CAPACITY_OF_IN_OBJECTS;
+    // in-object capacity of the initial hclass of a constructor while its slack is tracked
+    static constexpr int SLACK_TRACKING_CAPACITY_OF_IN_OBJECTS = 16;
+    // the construction which finishes the slack tracking, the ones before it get the slack
+    static constexpr uint32_t SLACK_TRACKING_CONSTRUCTIONS = (1U << CONSTRUCTION_COUNTER_BITFIELD_NUM) - 1;
     static constexpr int OFFSET_MAX_OBJECT_SIZE_IN_WORDS_WITHOUT_INLINED = 5;
     static constexpr int OFFSET_MAX_OBJECT_SIZE_IN_WORDS =
         PropertyAttributes::OFFSET_BITFIELD_NUM + OFFSET_MAX_OBJECT_SIZE_IN_WORDS_WITHOUT_INLINED;
@@ -269,6 +274,12 @@ public:
     static JSHandle<JSHClass> CloneWithoutInlinedProperties(const JSThread *thread, const JSHandle<JSHClass> &jshclass);
 
     static void TransitionElementsToDictionary(const JSThread *thread, const JSHandle<JSObject> &obj);
+    // move obj to the hclass of kind, which must be more general than the current one for a non-empty array
+    static void TransitionElementsKind(const JSThread *thread, const JSHandle<JSObject> &obj, ElementsKind kind);
+    // the largest number of properties of jshclass and the hclasses it transitioned to
+    static uint32_t GetMaxNumberOfPropsInTransitions(const JSHClass *jshclass);
+    // generalize the elements kind of obj so that it holds the elements of kind
+    static void UpdateElementsKind(const JSThread *thread, const JSHandle<JSObject> &obj, ElementsKind kind);
     static JSHandle<JSHClass> SetPropertyOfObjHClass(const JSThread *thread, JSHandle<JSHClass> &jshclass,
                                                      const JSHandle<JSTaggedValue> &key,
                                                      const PropertyAttributes &attr);
@@ -282,6 +293,17 @@ public:
 
     static JSHandle<JSTaggedValue> EnableProtoChangeMarker(const JSThread *thread, const JSHandle<JSHClass> &jshclass);
 
+    // the marker of the ics which find a property on the prototype chain of the global object, see
+    // NotifyGlobalBindingAdded
+    static JSHandle<JSTaggedValue> EnableGlobalChangeMarker(const JSThread *thread,
+                                                            const JSHandle<JSHClass> &jshclass);
+
+    // A new binding of the global object or of the global record is added to a GlobalDictionary and does not
+    // transition the hclass of the global object, while it may shadow a property which an ic found on the prototype
+    // chain of the global object; so the global object registers its hclass on its prototype chain like a prototype
+    // and the new binding changes its marker.
+    static void NotifyGlobalBindingAdded(const JSThread *thread, JSTaggedValue globalObject);
+
     static void NotifyHclassChanged(const JSThread *thread, JSHandle<JSHClass> oldHclass, JSHandle<JSHClass> newHclass);
 
     static void RegisterOnProtoChain(const JSThread *thread, const JSHandle<JSHClass> &jshclass);
@@ -362,6 +384,13 @@ public:
         ClassPrototypeBit::Set<uint32_t>(flag, GetBitFieldAddr());
     }
 
+    inline void SetConstructionCounter(uint32_t counter)
+    {
+        uint32_t bits = GetBitField();
+        uint32_t newVal = ConstructionCounterBits::Update(bits, counter);
+        SetBitField(newVal);
+    }
+
     inline void SetIsDictionaryMode(bool flag) const
     {
         IsDictionaryBit::Set<uint32_t>(flag, GetBitFieldAddr());
@@ -888,6 +917,18 @@ public:
         return IsDictionaryBit::Decode(bits);
     }
 
+    inline uint32_t GetConstructionCounter() const
+    {
+        uint32_t bits = GetBitField();
+        return ConstructionCounterBits::Decode(bits);
+    }
+
+    // the initial hclass of a constructor gives its instances slack in-object space until the counter runs out
+    inline bool IsSlackTracking() const
+    {
+        return GetConstructionCounter() != 0;
+    }
+
     inline bool IsGeneratorFunction() const
     {
         return GetObjectType() == JSType::JS_GENERATOR_FUNCTION;
@@ -1069,23 +1110,23 @@ public:
         return GetObjectType() == JSType::JS_MODULE_NAMESPACE;
     }
 
-    inline void SetElementRepresentation(Representation representation)
+    inline void SetElementsKind(ElementsKind kind)
     {
         uint32_t bits = GetBitField();
-        uint32_t newVal = ElementRepresentationBits::Update(bits, representation);
+        uint32_t newVal = ElementsKindBits::Update(bits, kind);
         SetBitField(newVal);
     }
 
-    inline Representation GetElementRepresentation() const
+    inline ElementsKind GetElementsKind() const
     {
         uint32_t bits = GetBitField();
-        return ElementRepresentationBits::Decode(bits);
+        return ElementsKindBits::Decode(bits);
     }
 
-    inline void UpdateRepresentation(JSTaggedValue value)
+    // whether value can be stored as an element without a transition of the elements kind
+    inline bool IsElementsKindCompatible(JSTaggedValue value) const
     {
-        Representation rep = PropertyAttributes::UpdateRepresentation(GetElementRepresentation(), value);
-        SetElementRepresentation(rep);
+        return IsMoreGeneralElementsKind(GetElementsKind(), TaggedToElementsKind(value));
     }
 
     inline void SetIsDictionaryElement(bool value)
@@ -1256,6 +1297,9 @@ private:
                                            const JSHandle<JSHClass> &child, const JSHandle<JSTaggedValue> &key,
                                            const JSHandle<JSTaggedValue> &proto);
     inline JSHClass *FindProtoTransitions(const JSTaggedValue &key, const JSTaggedValue &proto);
+    // the marker of the hclass, a new one if there was none or it has changed
+    static JSHandle<JSTaggedValue> GetOrCreateProtoChangeMarker(const JSThread *thread,
+                                                                const JSHandle<JSHClass> &jshclass);
 
     inline void Copy(const JSThread *thread, const JSHClass *jshclass);
 
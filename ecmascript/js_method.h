@@ -161,6 +161,11 @@ struct PUBLIC_API JSMethod : public base::AlignedStruct<sizeof(uint64_t),
         return jsPandaFile_;
     }
 
+    static size_t GetJSPandaFileOffset(bool isArch32)
+    {
+        return GetOffset<static_cast<size_t>(Index::JS_PANDA_FILE_INDEX)>(isArch32);
+    }
+
     const char * PUBLIC_API GetMethodName() const;
 
     static constexpr size_t METHOD_ARGS_NUM_BYTES = 8;
@@ -249,6 +254,11 @@ struct PUBLIC_API JSMethod : public base::AlignedStruct<sizeof(uint64_t),
         return literalInfo_;
     }
 
+    static size_t GetLiteralInfoOffset(bool isArch32)
+    {
+        return GetOffset<static_cast<size_t>(Index::LITERAL_INFO_INDEX)>(isArch32);
+    }
+
     alignas(EAS) uint64_t callField_ {0};
     // Native method decides this filed is NativePointer or BytecodeArray pointer.
     alignas(EAS) const void *nativePointerOrBytecodeArray_ {nullptr};
@@ -273,8 +273,8 @@ inline uint32_t JSObject::ComputeElementCapacity(uint32_t oldCapacity)
 inline uint32_t JSObject::ComputePropertyCapacity(uint32_t oldCapacity)
 {
     uint32_t newCapacity = static_cast<uint32_t>(oldCapacity + PROPERTIES_GROW_SIZE);
-    return newCapacity > JSHClass::MAX_CAPACITY_OF_OUT_OBJECTS ? JSHClass::MAX_CAPACITY_OF_OUT_OBJECTS
-                                                               : newCapacity;
+    // an object holds at most MAX_CAPACITY_OF_PROPERTIES fast properties, in-object or not
+    return std::min(newCapacity, PropertyAttributes::MAX_CAPACITY_OF_PROPERTIES);
 }
 
 // static
@@ -183,6 +183,7 @@ bool JSObject::AddElementInternal(JSThread *thread, const JSHandle<JSObject> &re
                                   const JSHandle<JSTaggedValue> &value, PropertyAttributes attr)
 {
     bool isDictionary = receiver->GetJSHClass()->IsDictionaryElement();
+    ElementsKind kind = TaggedToElementsKind(value.GetTaggedValue());
     if (receiver->IsJSArray()) {
         DISALLOW_GARBAGE_COLLECTION;
         JSArray *arr = JSArray::Cast(*receiver);
@@ -193,6 +194,10 @@ bool JSObject::AddElementInternal(JSThread *thread, const JSHandle<JSObject> &re
             }
             arr->SetArrayLength(thread, index + 1);
         }
+        // the elements between the old length and index are holes
+        if (index > oldLength) {
+            kind = GetHoleyElementsKind(kind);
+        }
     }
     thread->NotifyStableArrayElementsGuardians(receiver);
 
@@ -219,7 +224,7 @@ bool JSObject::AddElementInternal(JSThread *thread, const JSHandle<JSObject> &re
         elements = *JSObject::GrowElementsCapacity(thread, receiver, index + 1);
     }
     elements->Set(thread, index, value);
-    receiver->GetJSHClass()->UpdateRepresentation(value.GetTaggedValue());
+    JSHClass::UpdateElementsKind(thread, receiver, kind);
     return true;
 }
 
@@ -30,6 +30,8 @@ enum ArkProperties {
     CONCURRENT_SWEEP = 1 << 4,
     THREAD_CHECK = 1 << 5,
     ENABLE_ARKTOOLS = 1 << 6,
+    // opt-in: replaces concurrent marking when the taskpool has no thread besides the js thread
+    INCREMENTAL_MARK = 1 << 7,
 };
 
 // asm interpreter control parsed option
@@ -56,10 +58,20 @@ public:
         parser->Add(&arkProperties_);
         parser->Add(&enableTSAot_);
         parser->Add(&maxNonmovableSpaceCapacity_);
+        parser->Add(&regionDecommitAge_);
+        parser->Add(&heapGrowingPolicy_);
+        parser->Add(&gcCpuRatio_);
+        parser->Add(&minHeapGrowingFactor_);
+        parser->Add(&maxHeapGrowingFactor_);
         parser->Add(&asmInter_);
         parser->Add(&aotOutputFile_);
+        parser->Add(&aotCacheDir_);
+        parser->Add(&aotCacheMaxSize_);
         parser->Add(&targetTriple_);
         parser->Add(&asmOptLevel_);
+        parser->Add(&compilerThreads_);
+        parser->Add(&enablePGOProfiler_);
+        parser->Add(&pgoProfileFile_);
         parser->Add(&logCompiledMethods);
         parser->Add(&internal_memory_size_limit_);
         parser->Add(&heap_size_limit_);
@@ -162,6 +174,26 @@ public:
         aotOutputFile_.SetValue(std::move(value));
     }
 
+    std::string GetAOTCacheDir() const
+    {
+        return aotCacheDir_.GetValue();
+    }
+
+    void SetAOTCacheDir(std::string value)
+    {
+        aotCacheDir_.SetValue(std::move(value));
+    }
+
+    uint32_t GetAOTCacheMaxSize() const
+    {
+        return aotCacheMaxSize_.GetValue();
+    }
+
+    void SetAOTCacheMaxSize(uint32_t value)
+    {
+        aotCacheMaxSize_.SetValue(value);
+    }
+
     std::string GetTargetTriple() const
     {
         return targetTriple_.GetValue();
@@ -182,6 +214,36 @@ public:
         asmOptLevel_.SetValue(value);
     }
 
+    uint32_t GetCompilerThreads() const
+    {
+        return compilerThreads_.GetValue();
+    }
+
+    void SetCompilerThreads(uint32_t value)
+    {
+        compilerThreads_.SetValue(value);
+    }
+
+    bool IsEnablePGOProfiler() const
+    {
+        return enablePGOProfiler_.GetValue();
+    }
+
+    void SetEnablePGOProfiler(bool value)
+    {
+        enablePGOProfiler_.SetValue(value);
+    }
+
+    std::string GetPGOProfileFile() const
+    {
+        return pgoProfileFile_.GetValue();
+    }
+
+    void SetPGOProfileFile(std::string value)
+    {
+        pgoProfileFile_.SetValue(std::move(value));
+    }
+
     bool IsEnableForceGC() const
     {
         return enableForceGc_.GetValue();
@@ -259,6 +321,11 @@ public:
         return (static_cast<uint32_t>(arkProperties_.GetValue()) & ArkProperties::CONCURRENT_MARK) != 0;
     }
 
+    bool IsEnableIncrementalMark() const
+    {
+        return (static_cast<uint32_t>(arkProperties_.GetValue()) & ArkProperties::INCREMENTAL_MARK) != 0;
+    }
+
     bool IsEnableConcurrentSweep() const
     {
         return (static_cast<uint32_t>(arkProperties_.GetValue()) & ArkProperties::CONCURRENT_SWEEP) != 0;
@@ -309,6 +376,56 @@ public:
         return defaultSnapshotSpaceCapacity_.GetValue();
     }
 
+    uint32_t GetRegionDecommitAge() const
+    {
+        return regionDecommitAge_.GetValue();
+    }
+
+    void SetRegionDecommitAge(uint32_t value)
+    {
+        regionDecommitAge_.SetValue(value);
+    }
+
+    std::string GetHeapGrowingPolicy() const
+    {
+        return heapGrowingPolicy_.GetValue();
+    }
+
+    void SetHeapGrowingPolicy(std::string value)
+    {
+        heapGrowingPolicy_.SetValue(std::move(value));
+    }
+
+    double GetGCCpuRatio() const
+    {
+        return gcCpuRatio_.GetValue();
+    }
+
+    void SetGCCpuRatio(double value)
+    {
+        gcCpuRatio_.SetValue(value);
+    }
+
+    double GetMinHeapGrowingFactor() const
+    {
+        return minHeapGrowingFactor_.GetValue();
+    }
+
+    void SetMinHeapGrowingFactor(double value)
+    {
+        minHeapGrowingFactor_.SetValue(value);
+    }
+
+    double GetMaxHeapGrowingFactor() const
+    {
+        return maxHeapGrowingFactor_.GetValue();
+    }
+
+    void SetMaxHeapGrowingFactor(double value)
+    {
+        maxHeapGrowingFactor_.SetValue(value);
+    }
+
     void SetAsmInterOption(std::string value)
     {
         asmInter_.SetValue(std::move(value));
@@ -579,12 +696,26 @@ private:
     PandArg<std::string> aotOutputFile_ {"aot-output-file",
         R"(aot_output_file.m)",
         R"(Path to AOT output file. Default: "aot_output_file.m")"};
+    PandArg<std::string> aotCacheDir_ {"aot-cache-dir", "",
+        R"(Directory of the aot compilation cache, empty disables the cache. Default: "")"};
+    PandArg<uint32_t> aotCacheMaxSize_ {"aot-cache-max-size", 256,
+        R"(Size limit of the aot compilation cache in MB, the least recently used entries are evicted beyond it.
+        Default: 256)"};
     PandArg<std::string> targetTriple_ {"target-triple", R"(x86_64-unknown-linux-gnu)",
         R"(target triple for aot compiler or stub compiler.
         Possible values: ["x86_64-unknown-linux-gnu", "arm-unknown-linux-gnu", "aarch64-unknown-linux-gnu"].
         Default: "x86_64-unknown-linux-gnu")"};
     PandArg<size_t> asmOptLevel_ {"opt-level", 3,
         R"(Optimization level configuration on llvm back end. Default: "3")"};
+    PandArg<uint32_t> compilerThreads_ {"compiler-threads", 0,
+        R"(Number of threads the aot compiler compiles methods on, 0 means the main thread plus every taskpool thread.
+        Default: 0)"};
+    PandArg<bool> enablePGOProfiler_ {"enable-pgo-profiler", false,
+        R"(Record the call targets, ic states and branch counts of the interpreter into --pgo-profile-file at exit
+        and on SIGUSR2. Default: false)"};
+    PandArg<std::string> pgoProfileFile_ {"pgo-profile-file", "",
+        R"(Path of the pgo profile the runtime writes and the aot compiler reads, empty disables profile-guided
+        optimizations. Default: "")"};
     PandArg<size_t> totalSpaceCapacity_ {"totalSpaceCapacity",
         512 * 1024 * 1024,
         R"(set total space capacity)"};
@@ -609,6 +740,22 @@ private:
     PandArg<size_t> defaultSnapshotSpaceCapacity_ {"defaultSnapshotSpaceCapacity",
         256 * 1024,
         R"(set default snapshot space capacity)"};
+    PandArg<uint32_t> regionDecommitAge_ {"regionDecommitAge",
+        3000,
+        R"(set the time in ms free heap memory stays committed before its pages are returned to the os)"};
+    PandArg<std::string> heapGrowingPolicy_ {"heap-growing-policy",
+        R"(throughput)",
+        R"(how the old space limit grows after an old gc, "throughput": grow early to stay well below
+        --gc-cpu-ratio, "memory": the smallest heap which keeps the gc at --gc-cpu-ratio. Default: "throughput")"};
+    PandArg<double> gcCpuRatio_ {"gc-cpu-ratio",
+        0.03,
+        R"(target share of the cpu time spent in the old gc, within (0, 1). Default: 0.03)"};
+    PandArg<double> minHeapGrowingFactor_ {"min-heap-growing-factor",
+        1.3,
+        R"(min factor of the old space limit over the live size after an old gc. Default: 1.3)"};
+    PandArg<double> maxHeapGrowingFactor_ {"max-heap-growing-factor",
+        4.0,
+        R"(max factor of the old space limit over the live size after an old gc. Default: 4.0)"};
     PandArg<std::string> asmInter_ {"asmInter",
         "",
         R"(set asm interpreter control properties)"};
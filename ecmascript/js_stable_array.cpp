@@ -14,7 +14,14 @@
  */
 
 #include "js_stable_array.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "ecmascript/base/array_helper.h"
 #include "ecmascript/base/builtins_base.h"
+#include "ecmascript/base/number_helper.h"
+#include "ecmascript/base/tim_sort.h"
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/js_array.h"
@@ -24,6 +31,96 @@
 #include "interpreter/fast_runtime_stub-inl.h"
 
 namespace panda::ecmascript {
+namespace {
+// Sorts a TaggedArray through ArrayHelper::SortCompare. Values are re-read through handles around every compare,
+// since a user comparator can trigger GC.
+class TaggedSortAccessor {
+public:
+    TaggedSortAccessor(JSThread *thread, const JSHandle<TaggedArray> &items, const JSHandle<TaggedArray> &tmp,
+                       const JSHandle<JSTaggedValue> &fn)
+        : thread_(thread), items_(items), tmp_(tmp), fn_(fn), lhs_(thread, JSTaggedValue::Undefined()),
+          rhs_(thread, JSTaggedValue::Undefined())
+    {
+    }
+    ~TaggedSortAccessor() = default;
+    NO_COPY_SEMANTIC(TaggedSortAccessor);
+    NO_MOVE_SEMANTIC(TaggedSortAccessor);
+
+    bool Less(base::SortSlot lhsSlot, uint32_t lhs, base::SortSlot rhsSlot, uint32_t rhs)
+    {
+        if (IsAbrupt()) {
+            return false;
+        }
+        lhs_.Update(Get(lhsSlot, lhs));
+        rhs_.Update(Get(rhsSlot, rhs));
+        // SortCompare only distinguishes "greater" for the default comparison, so ask whether rhs > lhs.
+        int32_t compareResult = base::ArrayHelper::SortCompare(thread_, fn_, rhs_, lhs_);
+        return !IsAbrupt() && compareResult > 0;
+    }
+
+    void Move(base::SortSlot dstSlot, uint32_t dst, base::SortSlot srcSlot, uint32_t src)
+    {
+        JSTaggedValue value = Get(srcSlot, src);
+        if (dstSlot == base::SortSlot::MAIN) {
+            items_->Set(thread_, dst, value);
+        } else {
+            tmp_->Set(thread_, dst, value);
+        }
+    }
+
+    bool IsAbrupt() const
+    {
+        return thread_->HasPendingException();
+    }
+
+private:
+    JSTaggedValue Get(base::SortSlot slot, uint32_t index) const
+    {
+        return slot == base::SortSlot::MAIN ? items_->Get(index) : tmp_->Get(index);
+    }
+
+    JSThread *thread_;
+    JSHandle<TaggedArray> items_;
+    JSHandle<TaggedArray> tmp_;
+    JSHandle<JSTaggedValue> fn_;
+    JSMutableHandle<JSTaggedValue> lhs_;
+    JSMutableHandle<JSTaggedValue> rhs_;
+};
+
+uint32_t CountDecimalDigits(uint64_t value)
+{
+    constexpr uint64_t DECIMAL = 10;
+    uint32_t digits = 1;
+    while (value >= DECIMAL) {
+        value /= DECIMAL;
+        digits++;
+    }
+    return digits;
+}
+
+// the least general elements kind which holds the call args from the index from on
+ElementsKind GetCallArgsElementsKind(EcmaRuntimeCallInfo *argv, uint32_t from)
+{
+    ElementsKind kind = ElementsKind::PACKED_INT;
+    uint32_t argc = argv->GetArgsNumber();
+    for (uint32_t i = from; i < argc; i++) {
+        kind = MergeElementsKind(kind, TaggedToElementsKind(argv->GetCallArg(i).GetTaggedValue()));
+    }
+    return kind;
+}
+
+// whether the elements in [from, to) have a hole, which a move of the elements reads as undefined
+bool HasHole(const TaggedArray *elements, uint32_t from, uint32_t to)
+{
+    for (uint32_t k = from; k < to; k++) {
+        if (elements->Get(k).IsHole()) {
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
 JSTaggedValue JSStableArray::Push(JSHandle<JSArray> receiver, EcmaRuntimeCallInfo *argv)
 {
     JSThread *thread = argv->GetThread();
@@ -31,6 +128,7 @@ JSTaggedValue JSStableArray::Push(JSHandle<JSArray> receiver, EcmaRuntimeCallInf
     uint32_t oldLength = receiver->GetArrayLength();
     uint32_t newLength = argc + oldLength;
 
+    JSHClass::UpdateElementsKind(thread, JSHandle<JSObject>::Cast(receiver), GetCallArgsElementsKind(argv, 0));
     TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
     if (newLength > elements->GetLength()) {
         elements = *JSObject::GrowElementsCapacity(thread, JSHandle<JSObject>::Cast(receiver), newLength);
@@ -92,6 +190,7 @@ JSTaggedValue JSStableArray::Splice(JSHandle<JSArray> receiver, EcmaRuntimeCallI
         for (uint32_t idx = 0; idx < actualDeleteCount; idx++) {
             destElements->Set(thread, idx, srcElementsHandle->Get(start + idx));
         }
+        JSHClass::UpdateElementsKind(thread, newArrayHandle, thisObjHandle->GetJSHClass()->GetElementsKind());
         JSHandle<JSArray>::Cast(newArrayHandle)->SetArrayLength(thread, actualDeleteCount);
     } else {
         JSMutableHandle<JSTaggedValue> fromKey(thread, JSTaggedValue::Undefined());
@@ -123,7 +222,12 @@ JSTaggedValue JSStableArray::Splice(JSHandle<JSArray> receiver, EcmaRuntimeCallI
 
     uint32_t oldCapacity = srcElementsHandle->GetLength();
     uint32_t newCapacity = len - actualDeleteCount + insertCount;
+    // the moved holes are stored as undefined
+    ElementsKind kind = GetCallArgsElementsKind(argv, 2);  // 2: the inserted items follow start and deleteCount
     if (insertCount < actualDeleteCount) {
+        if (HasHole(*srcElementsHandle, start + actualDeleteCount, len)) {
+            kind = MergeElementsKind(kind, ElementsKind::PACKED_ELEMENTS);
+        }
         for (uint32_t idx = start; idx < len - actualDeleteCount; idx++) {
             auto element = srcElementsHandle->Get(idx + actualDeleteCount);
             element = element.IsHole() ? JSTaggedValue::Undefined() : element;
@@ -138,6 +242,9 @@ JSTaggedValue JSStableArray::Splice(JSHandle<JSArray> receiver, EcmaRuntimeCallI
             }
         }
     } else {
+        if (HasHole(*srcElementsHandle, start + actualDeleteCount, len)) {
+            kind = MergeElementsKind(kind, ElementsKind::PACKED_ELEMENTS);
+        }
         if (newCapacity > oldCapacity) {
             srcElementsHandle = JSObject::GrowElementsCapacity(thread, thisObjHandle, newCapacity);
         }
@@ -151,6 +258,7 @@ JSTaggedValue JSStableArray::Splice(JSHandle<JSArray> receiver, EcmaRuntimeCallI
     for (uint32_t i = 2, idx = start; i < argc; i++, idx++) {
         srcElementsHandle->Set(thread, idx, argv->GetCallArg(i));
     }
+    JSHClass::UpdateElementsKind(thread, thisObjHandle, kind);
 
     JSHandle<JSTaggedValue> newLenHandle(thread, JSTaggedValue(newCapacity));
     JSTaggedValue::SetProperty(thread, thisObjVal, lengthKey, newLenHandle, true);
@@ -160,13 +268,18 @@ JSTaggedValue JSStableArray::Splice(JSHandle<JSArray> receiver, EcmaRuntimeCallI
 
 JSTaggedValue JSStableArray::Shift(JSHandle<JSArray> receiver, EcmaRuntimeCallInfo *argv)
 {
-    DISALLOW_GARBAGE_COLLECTION;
     JSThread *thread = argv->GetThread();
     uint32_t length = receiver->GetArrayLength();
     if (length == 0) {
         return JSTaggedValue::Undefined();
     }
+    // the shifted holes are stored as undefined
+    if (IsHoleyElementsKind(receiver->GetJSHClass()->GetElementsKind()) &&
+        HasHole(TaggedArray::Cast(receiver->GetElements().GetTaggedObject()), 1, length)) {
+        JSHClass::UpdateElementsKind(thread, JSHandle<JSObject>::Cast(receiver), ElementsKind::PACKED_ELEMENTS);
+    }
 
+    DISALLOW_GARBAGE_COLLECTION;
     TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
     auto result = elements->Get(0);
     for (uint32_t k = 1; k < length; k++) {
@@ -265,4 +378,315 @@ JSTaggedValue JSStableArray::Join(JSHandle<JSArray> receiver, EcmaRuntimeCallInf
     ASSERT_PRINT(isOneByte == EcmaString::CanBeCompressed(newString), "isOneByte does not match the real value!");
     return JSTaggedValue(newString);
 }
+
+// Orders two int32 values the way the default comparator orders their ToString results, without allocating.
+bool JSStableArray::IntStringLess(int32_t x, int32_t y)
+{
+    if (x == y) {
+        return false;
+    }
+    // '-' sorts before every digit.
+    if ((x < 0) != (y < 0)) {
+        return x < 0;
+    }
+    auto xMagnitude = static_cast<uint64_t>(std::abs(static_cast<int64_t>(x)));
+    auto yMagnitude = static_cast<uint64_t>(std::abs(static_cast<int64_t>(y)));
+    uint32_t xDigits = CountDecimalDigits(xMagnitude);
+    uint32_t yDigits = CountDecimalDigits(yMagnitude);
+    // Pad the shorter one with zeros, then a tie means it is a prefix of the longer one and sorts first.
+    constexpr uint64_t DECIMAL = 10;
+    for (uint32_t i = xDigits; i < yDigits; i++) {
+        xMagnitude *= DECIMAL;
+    }
+    for (uint32_t i = yDigits; i < xDigits; i++) {
+        yMagnitude *= DECIMAL;
+    }
+    if (xMagnitude == yMagnitude) {
+        return xDigits < yDigits;
+    }
+    return xMagnitude < yMagnitude;
+}
+
+void JSStableArray::SortIntElements(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t count)
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    CVector<int32_t> values(count);
+    for (uint32_t i = 0; i < count; i++) {
+        values[i] = items->Get(i).GetInt();
+    }
+    base::TimSortContainer(values, IntStringLess);
+    for (uint32_t i = 0; i < count; i++) {
+        items->Set(thread, i, JSTaggedValue(values[i]));
+    }
+}
+
+void JSStableArray::SortStringElements(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t count)
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    CVector<JSTaggedValue> values(count);
+    for (uint32_t i = 0; i < count; i++) {
+        values[i] = items->Get(i);
+    }
+    base::TimSortContainer(values, [](JSTaggedValue x, JSTaggedValue y) {
+        return EcmaString::Cast(x.GetTaggedObject())->Compare(EcmaString::Cast(y.GetTaggedObject())) < 0;
+    });
+    for (uint32_t i = 0; i < count; i++) {
+        items->Set(thread, i, values[i]);
+    }
+}
+
+// Mixed int/double arrays are converted to strings once up front, instead of twice per comparison.
+void JSStableArray::SortNumberElements(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t count)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> keys = factory->NewTaggedArray(count);
+    for (uint32_t i = 0; i < count; i++) {
+        JSHandle<EcmaString> key = base::NumberHelper::NumberToString(thread, items->Get(i));
+        keys->Set(thread, i, key.GetTaggedValue());
+    }
+    JSHandle<TaggedArray> values = factory->CopyArray(items, count, count);
+
+    DISALLOW_GARBAGE_COLLECTION;
+    CVector<uint32_t> order(count);
+    for (uint32_t i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    TaggedArray *rawKeys = *keys;
+    base::TimSortContainer(order, [rawKeys](uint32_t x, uint32_t y) {
+        auto xKey = EcmaString::Cast(rawKeys->Get(x).GetTaggedObject());
+        auto yKey = EcmaString::Cast(rawKeys->Get(y).GetTaggedObject());
+        return xKey->Compare(yKey) < 0;
+    });
+    for (uint32_t i = 0; i < count; i++) {
+        items->Set(thread, i, values->Get(order[i]));
+    }
+}
+
+void JSStableArray::SortGenericElements(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t count,
+                                        const JSHandle<JSTaggedValue> &fn)
+{
+    using Sorter = base::TimSort<TaggedSortAccessor>;
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> tmp = factory->NewTaggedArray(Sorter::GetTmpLength(count));
+    TaggedSortAccessor accessor(thread, items, tmp, fn);
+    Sorter(accessor).Sort(count);
+}
+
+// Stores the sorted values back, followed by the undefineds, and drops the holes at the end as the spec requires.
+// The comparator may have reshaped the receiver, in which case the generic property path is taken.
+JSTaggedValue JSStableArray::WriteBackSortedElements(JSThread *thread, const JSHandle<JSArray> &receiver,
+                                                     const JSHandle<TaggedArray> &items, uint32_t count,
+                                                     uint32_t undefinedCount, uint32_t length)
+{
+    JSHandle<JSTaggedValue> receiverValue(receiver);
+    TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
+    if (receiverValue->IsStableJSArray(thread) && receiver->GetArrayLength() == length &&
+        elements->GetLength() >= length) {
+        uint32_t undefinedEnd = count + undefinedCount;
+        for (uint32_t k = 0; k < length; k++) {
+            if (k < count) {
+                elements->Set(thread, k, items->Get(k));
+            } else if (k < undefinedEnd) {
+                elements->Set(thread, k, JSTaggedValue::Undefined());
+            } else {
+                elements->Set(thread, k, JSTaggedValue::Hole());
+            }
+        }
+        return receiverValue.GetTaggedValue();
+    }
+
+    for (uint32_t k = 0; k < count; k++) {
+        FastRuntimeStub::FastSetPropertyByIndex(thread, receiverValue.GetTaggedValue(), k, items->Get(k));
+        RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    }
+    uint32_t k = count;
+    for (; k < count + undefinedCount; k++) {
+        FastRuntimeStub::FastSetPropertyByIndex(thread, receiverValue.GetTaggedValue(), k,
+                                                JSTaggedValue::Undefined());
+        RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    }
+    JSMutableHandle<JSTaggedValue> key(thread, JSTaggedValue::Undefined());
+    for (; k < length; k++) {
+        key.Update(JSTaggedValue(k));
+        JSTaggedValue::DeletePropertyOrThrow(thread, receiverValue, key);
+        RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    }
+    return receiverValue.GetTaggedValue();
+}
+
+JSTaggedValue JSStableArray::Sort(JSThread *thread, const JSHandle<JSArray> &receiver,
+                                  const JSHandle<JSTaggedValue> &fn)
+{
+    uint32_t length = receiver->GetArrayLength();
+    if (length < 2) {  // 2: nothing to sort
+        return receiver.GetTaggedValue();
+    }
+
+    // Collect the present values into a private list, so the comparator cannot observe a half-sorted receiver.
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> items = factory->NewTaggedArray(length);
+    uint32_t count = 0;
+    uint32_t undefinedCount = 0;
+    bool allInt = true;
+    bool allNumber = true;
+    bool allString = true;
+    {
+        DISALLOW_GARBAGE_COLLECTION;
+        TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
+        uint32_t capacity = std::min(length, elements->GetLength());
+        for (uint32_t k = 0; k < capacity; k++) {
+            JSTaggedValue value = elements->Get(k);
+            if (value.IsHole()) {
+                continue;
+            }
+            if (value.IsUndefined()) {
+                undefinedCount++;
+                continue;
+            }
+            allInt = allInt && value.IsInt();
+            allNumber = allNumber && value.IsNumber();
+            allString = allString && value.IsString();
+            items->Set(thread, count++, value);
+        }
+    }
+
+    if (!fn->IsUndefined()) {
+        SortGenericElements(thread, items, count, fn);
+    } else if (allInt) {
+        SortIntElements(thread, items, count);
+    } else if (allString) {
+        SortStringElements(thread, items, count);
+    } else if (allNumber) {
+        SortNumberElements(thread, items, count);
+    } else {
+        SortGenericElements(thread, items, count, fn);
+    }
+    RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    return WriteBackSortedElements(thread, receiver, items, count, undefinedCount, length);
+}
+
+JSTaggedValue JSStableArray::IndexOf(const JSHandle<JSArray> &receiver, const JSHandle<JSTaggedValue> &searchElement,
+                                     uint32_t from, uint32_t len)
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    ElementsKind kind = receiver->GetJSHClass()->GetElementsKind();
+    JSTaggedValue target = searchElement.GetTaggedValue();
+    TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
+    // the elements from end on are absent
+    uint32_t end = std::min({len, receiver->GetArrayLength(), elements->GetLength()});
+    if (IsNumberElementsKind(kind)) {
+        if (!target.IsNumber()) {
+            return base::BuiltinsBase::GetTaggedInt(-1);
+        }
+        if (IsIntElementsKind(kind) && target.IsInt()) {
+            for (uint32_t k = from; k < end; k++) {
+                if (elements->Get(k) == target) {
+                    return base::BuiltinsBase::GetTaggedDouble(k);
+                }
+            }
+            return base::BuiltinsBase::GetTaggedInt(-1);
+        }
+        // NaN is equal to no element
+        double number = target.GetNumber();
+        for (uint32_t k = from; k < end; k++) {
+            JSTaggedValue element = elements->Get(k);
+            if (!element.IsHole() && element.GetNumber() == number) {
+                return base::BuiltinsBase::GetTaggedDouble(k);
+            }
+        }
+        return base::BuiltinsBase::GetTaggedInt(-1);
+    }
+    // a hole is strictly equal to no value
+    for (uint32_t k = from; k < end; k++) {
+        if (FastRuntimeStub::FastStrictEqual(elements->Get(k), target)) {
+            return base::BuiltinsBase::GetTaggedDouble(k);
+        }
+    }
+    return base::BuiltinsBase::GetTaggedInt(-1);
+}
+
+JSTaggedValue JSStableArray::Includes(const JSHandle<JSArray> &receiver, const JSHandle<JSTaggedValue> &searchElement,
+                                      uint32_t from, uint32_t len)
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    ElementsKind kind = receiver->GetJSHClass()->GetElementsKind();
+    JSTaggedValue target = searchElement.GetTaggedValue();
+    TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
+    // the elements from end on are absent, an absent element or a hole is read as undefined
+    uint32_t end = std::min({len, receiver->GetArrayLength(), elements->GetLength()});
+    if (target.IsUndefined()) {
+        if (end < len) {
+            return base::BuiltinsBase::GetTaggedBoolean(true);
+        }
+        if (IsNumberElementsKind(kind)) {
+            return base::BuiltinsBase::GetTaggedBoolean(IsHoleyElementsKind(kind) && HasHole(elements, from, end));
+        }
+    } else if (IsNumberElementsKind(kind)) {
+        if (!target.IsNumber()) {
+            return base::BuiltinsBase::GetTaggedBoolean(false);
+        }
+        double number = target.GetNumber();
+        if (std::isnan(number)) {
+            if (IsIntElementsKind(kind)) {
+                return base::BuiltinsBase::GetTaggedBoolean(false);
+            }
+            for (uint32_t k = from; k < end; k++) {
+                JSTaggedValue element = elements->Get(k);
+                if (element.IsDouble() && std::isnan(element.GetDouble())) {
+                    return base::BuiltinsBase::GetTaggedBoolean(true);
+                }
+            }
+            return base::BuiltinsBase::GetTaggedBoolean(false);
+        }
+        for (uint32_t k = from; k < end; k++) {
+            JSTaggedValue element = elements->Get(k);
+            if (!element.IsHole() && element.GetNumber() == number) {
+                return base::BuiltinsBase::GetTaggedBoolean(true);
+            }
+        }
+        return base::BuiltinsBase::GetTaggedBoolean(false);
+    }
+    for (uint32_t k = from; k < end; k++) {
+        JSTaggedValue element = elements->Get(k);
+        if (JSTaggedValue::SameValueZero(target, element.IsHole() ? JSTaggedValue::Undefined() : element)) {
+            return base::BuiltinsBase::GetTaggedBoolean(true);
+        }
+    }
+    return base::BuiltinsBase::GetTaggedBoolean(false);
+}
+
+JSTaggedValue JSStableArray::Fill(JSThread *thread, const JSHandle<JSArray> &receiver,
+                                  const JSHandle<JSTaggedValue> &value, uint32_t start, uint32_t end)
+{
+    // the holes become own elements, which a non extensible array does not allow; filling a prototype is left to the
+    // generic path, which invalidates the stable array guardians
+    if (end > receiver->GetArrayLength() || !receiver->IsExtensible() || receiver->GetJSHClass()->IsPrototype()) {
+        return JSTaggedValue::Hole();
+    }
+    JSHandle<JSObject> receiverHandle = JSHandle<JSObject>::Cast(receiver);
+    uint32_t capacity = TaggedArray::Cast(receiver->GetElements().GetTaggedObject())->GetLength();
+    if (end > capacity) {
+        if (JSObject::ShouldTransToDict(capacity, end)) {
+            return JSTaggedValue::Hole();
+        }
+        JSObject::GrowElementsCapacity(thread, receiverHandle, end);
+    }
+    JSHClass::UpdateElementsKind(thread, receiverHandle, TaggedToElementsKind(value.GetTaggedValue()));
+
+    DISALLOW_GARBAGE_COLLECTION;
+    TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
+    for (uint32_t k = start; k < end; k++) {
+        elements->Set(thread, k, value.GetTaggedValue());
+    }
+    return receiver.GetTaggedValue();
+}
+
+JSTaggedValue JSStableArray::GetElement(const JSHandle<JSArray> &receiver, uint32_t index)
+{
+    TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
+    if (index >= elements->GetLength()) {
+        return JSTaggedValue::Hole();
+    }
+    return elements->Get(index);
+}
 }  // namespace panda::ecmascript
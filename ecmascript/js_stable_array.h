@@ -30,6 +30,28 @@ public:
                                 double start, double insertCount, double actualDeleteCount);
     static JSTaggedValue Shift(JSHandle<JSArray> receiver, EcmaRuntimeCallInfo *argv);
     static JSTaggedValue Join(JSHandle<JSArray> receiver, EcmaRuntimeCallInfo *argv);
+    static JSTaggedValue Sort(JSThread *thread, const JSHandle<JSArray> &receiver, const JSHandle<JSTaggedValue> &fn);
+    // from < len, where len is the length the builtin read before converting its arguments
+    static JSTaggedValue IndexOf(const JSHandle<JSArray> &receiver, const JSHandle<JSTaggedValue> &searchElement,
+                                 uint32_t from, uint32_t len);
+    static JSTaggedValue Includes(const JSHandle<JSArray> &receiver, const JSHandle<JSTaggedValue> &searchElement,
+                                  uint32_t from, uint32_t len);
+    // start < end, returns a hole if the fill is left to the generic path
+    static JSTaggedValue Fill(JSThread *thread, const JSHandle<JSArray> &receiver,
+                              const JSHandle<JSTaggedValue> &value, uint32_t start, uint32_t end);
+    // the element index below the length, a hole if the element is absent
+    static JSTaggedValue GetElement(const JSHandle<JSArray> &receiver, uint32_t index);
+
+private:
+    static bool IntStringLess(int32_t x, int32_t y);
+    static void SortIntElements(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t count);
+    static void SortStringElements(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t count);
+    static void SortNumberElements(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t count);
+    static void SortGenericElements(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t count,
+                                    const JSHandle<JSTaggedValue> &fn);
+    static JSTaggedValue WriteBackSortedElements(JSThread *thread, const JSHandle<JSArray> &receiver,
+                                                 const JSHandle<TaggedArray> &items, uint32_t count,
+                                                 uint32_t undefinedCount, uint32_t length);
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_JS_STABLE_ARRAY_H
\ No newline at end of file
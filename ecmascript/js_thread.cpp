@@ -15,6 +15,7 @@
 #include "ecmascript/js_thread.h"
 #include "ecmascript/compiler/llvm/llvm_stackmap_parser.h"
 #include "ecmascript/global_env_constants-inl.h"
+#include "ecmascript/ic/megamorphic_cache.h"
 #include "ecmascript/ic/properties_cache.h"
 #include "ecmascript/interpreter/interpreter-inl.h"
 #include "ecmascript/mem/machine_code.h"
@@ -42,6 +43,7 @@ JSThread::JSThread(EcmaVM *vm) : id_(os::thread::GetCurrentThreadId()), vm_(vm)
     auto chunk = vm->GetChunk();
     globalStorage_ = chunk->New<EcmaGlobalStorage>(chunk);
     propertiesCache_ = new PropertiesCache();
+    megamorphicCache_ = new MegamorphicCache();
     vmThreadControl_ = new VmThreadControl();
 }
 
@@ -64,6 +66,10 @@ JSThread::~JSThread()
         delete propertiesCache_;
         propertiesCache_ = nullptr;
     }
+    if (megamorphicCache_ != nullptr) {
+        delete megamorphicCache_;
+        megamorphicCache_ = nullptr;
+    }
     if (vmThreadControl_ != nullptr) {
         delete vmThreadControl_;
         vmThreadControl_ = nullptr;
@@ -97,6 +103,9 @@ void JSThread::Iterate(const RootVisitor &v0, const RootRangeVisitor &v1)
     if (propertiesCache_ != nullptr) {
         propertiesCache_->Clear();
     }
+    if (megamorphicCache_ != nullptr) {
+        megamorphicCache_->Clear();
+    }
 
     if (!glueData_.exception_.IsHole()) {
         v0(Root::ROOT_VM, ObjectSlot(ToUintPtr(&glueData_.exception_)));
@@ -32,6 +32,7 @@ namespace panda::ecmascript {
 class EcmaHandleScope;
 class EcmaVM;
 class HeapRegionAllocator;
+class MegamorphicCache;
 class PropertiesCache;
 
 enum class MarkStatus : uint8_t {
@@ -315,6 +316,11 @@ public:
         return propertiesCache_;
     }
 
+    MegamorphicCache *GetMegamorphicCache() const
+    {
+        return megamorphicCache_;
+    }
+
     void SetMarkStatus(MarkStatus status)
     {
         MarkStatusBits::Set(status, &glueData_.threadStateBitField_);
@@ -509,6 +515,7 @@ private:
     JSTaggedValue stubCode_ {JSTaggedValue::Hole()};
 
     PropertiesCache *propertiesCache_ {nullptr};
+    MegamorphicCache *megamorphicCache_ {nullptr};
     EcmaGlobalStorage *globalStorage_ {nullptr};
 
     // Run-time state
@@ -227,6 +227,12 @@ JSTaggedValue PandaFileTranslator::ParseConstPool(EcmaVM *vm, const JSPandaFile
 
             JSHandle<JSArray> arr(JSArray::ArrayCreate(thread, JSTaggedNumber(length)));
             arr->SetElements(thread, literal);
+            // the clones of the literal share its hclass and so its elements kind
+            ElementsKind kind = ElementsKind::PACKED_INT;
+            for (uint32_t i = 0; i < length; i++) {
+                kind = MergeElementsKind(kind, TaggedToElementsKind(literal->Get(i)));
+            }
+            JSHClass::TransitionElementsKind(thread, JSHandle<JSObject>::Cast(arr), kind);
             constpool->Set(thread, value.GetConstpoolIndex(), arr.GetTaggedValue());
         } else if (value.GetConstpoolType() == ConstPoolType::CLASS_LITERAL) {
             size_t index = it.first;
@@ -25,15 +25,21 @@
 #include "utils/bit_field.h"
 
 namespace panda::ecmascript {
+// regTypes and constStringIndexes are collected by the aot compiler before it compiles the methods, so that the
+// circuit builders on the compiler threads read them instead of the VM heap.
 struct MethodPcInfo {
     const JSMethod *method {nullptr};
     std::vector<uint8_t *> pcArray {};
+    // the GlobalTSTypeRef of every vreg and arg of the method, by register id
+    std::vector<uint64_t> regTypes {};
 };
 
 struct BytecodeTranslationInfo {
     const JSPandaFile *jsPandaFile {nullptr};
     JSHandle<JSTaggedValue> constantPool;
     std::vector<MethodPcInfo> methodPcInfos {};
+    // the index of every string of the constant pool in the TSLoader const string table, by constant pool index
+    std::vector<uint32_t> constStringIndexes {};
 };
 
 class JSThread;
@@ -93,6 +93,23 @@ inline void LayoutInfo::SetSortedIndex(const JSThread *thread, int index, int so
     TaggedArray::Set(thread, fixed_idx, attr.GetTaggedValue());
 }
 
+inline JSTaggedValue LayoutInfo::GetHashIndex() const
+{
+    return TaggedArray::Get(HASH_INDEX_INDEX);
+}
+
+inline bool LayoutInfo::HasHashIndex() const
+{
+    return !GetHashIndex().IsHole();
+}
+
+inline void LayoutInfo::SetHashIndex(const JSThread *thread, JSTaggedValue index)
+{
+    ASSERT(index.IsHole() ||
+           TaggedArray::Cast(index.GetTaggedObject())->GetLength() == ComputeHashIndexLength(GetPropertiesCapacity()));
+    TaggedArray::Set(thread, HASH_INDEX_INDEX, index);
+}
+
 inline int LayoutInfo::FindElementWithCache(JSThread *thread, JSHClass *cls, JSTaggedValue key,
                                             int propertiesNumber)
 {
@@ -108,6 +125,10 @@ inline int LayoutInfo::FindElementWithCache(JSThread *thread, JSHClass *cls, JST
         return -1;
     }
 
+    // the hash index finds the key about as fast as the cache, and leaves the cache to the smaller layouts
+    if (HasHashIndex()) {
+        return FindElementInHashIndex(key, propertiesNumber);
+    }
     PropertiesCache *cache = thread->GetPropertiesCache();
     int index = cache->Get(cls, key);
     if (index == PropertiesCache::NOT_FOUND) {
@@ -117,6 +138,25 @@ inline int LayoutInfo::FindElementWithCache(JSThread *thread, JSHClass *cls, JST
     return index;
 }
 
+inline int LayoutInfo::FindElementInHashIndex(JSTaggedValue key, int propertiesNumber)
+{
+    ASSERT(NumberOfElements() >= propertiesNumber);
+    TaggedArray *hashIndex = TaggedArray::Cast(GetHashIndex().GetTaggedObject());
+    uint32_t mask = hashIndex->GetLength() - 1;
+    // the index is at most half full, so the probe ends at a hole
+    for (uint32_t entry = key.GetKeyHashCode() & mask;; entry = (entry + 1) & mask) {
+        JSTaggedValue value = hashIndex->Get(entry);
+        if (value.IsHole()) {
+            return -1;
+        }
+        int index = value.GetInt();
+        // the entries of the properties which other hclasses appended to a shared layout
+        if (index < propertiesNumber && GetKey(index) == key) {
+            return index;
+        }
+    }
+}
+
 inline int LayoutInfo::BinarySearch(JSTaggedValue key, int propertiesNumber)
 {
     ASSERT(NumberOfElements() >= propertiesNumber);
@@ -40,6 +40,30 @@ void LayoutInfo::AddKey(const JSThread *thread, [[maybe_unused]] int index, cons
         SetSortedIndex(thread, insertIndex, GetSortedIndex(insertIndex - 1));
     }
     SetSortedIndex(thread, insertIndex, number);
+    if (HasHashIndex()) {
+        AddToHashIndex(thread, number);
+    }
+}
+
+void LayoutInfo::BuildHashIndex(const JSThread *thread)
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    int number = NumberOfElements();
+    for (int i = 0; i < number; i++) {
+        AddToHashIndex(thread, i);
+    }
+}
+
+void LayoutInfo::AddToHashIndex(const JSThread *thread, int index)
+{
+    ASSERT(index < GetPropertiesCapacity());
+    TaggedArray *hashIndex = TaggedArray::Cast(GetHashIndex().GetTaggedObject());
+    uint32_t mask = hashIndex->GetLength() - 1;
+    uint32_t entry = GetKey(index).GetKeyHashCode() & mask;
+    while (!hashIndex->Get(entry).IsHole()) {
+        entry = (entry + 1) & mask;
+    }
+    hashIndex->Set(thread, entry, JSTaggedValue(index));
 }
 
 void LayoutInfo::GetAllKeys(const JSThread *thread, int end, int offset, TaggedArray *keyArray)
@@ -26,12 +26,20 @@ struct Properties {
     JSTaggedValue attr_;
 };
 
+// A layout with a capacity of at least HASH_INDEX_MIN_CAPACITY properties has a hash index: an open addressed table
+// with linear probing of the property indexes by the hash of their keys, at most half full, so that a key is found
+// in about one probe instead of a binary search over the sorted keys on a miss of the PropertiesCache.
+// The layouts of a transition chain share the layout while the properties are appended, and a layout which is
+// extended or copied gets its own index, so the index may have entries beyond the properties of the hclass which
+// looks it up and every entry is checked against the key and the number of properties.
 class LayoutInfo : private TaggedArray {
 public:
     static constexpr int MIN_PROPERTIES_LENGTH = JSObject::MIN_PROPERTIES_LENGTH;
     static constexpr int MAX_PROPERTIES_LENGTH = PropertyAttributes::MAX_CAPACITY_OF_PROPERTIES;
+    static constexpr int HASH_INDEX_MIN_CAPACITY = 32;
     static constexpr int NUMBER_OF_PROPERTIES_INDEX = 0;
-    static constexpr int ELEMENTS_START_INDEX = 1;
+    static constexpr int HASH_INDEX_INDEX = 1;
+    static constexpr int ELEMENTS_START_INDEX = 2;
 
     inline static LayoutInfo *Cast(ObjectHeader *obj)
     {
@@ -53,6 +61,12 @@ public:
     uint32_t GetSortedIndex(int index) const;
     void SetSortedIndex(const JSThread *thread, int index, int sortedIndex);
     void AddKey(const JSThread *thread, int index, const JSTaggedValue &key, const PropertyAttributes &attr);
+    JSTaggedValue GetHashIndex() const;
+    bool HasHashIndex() const;
+    // index is a TaggedArray of ComputeHashIndexLength(GetPropertiesCapacity()) holes, or hole for no index
+    void SetHashIndex(const JSThread *thread, JSTaggedValue index);
+    // insert the properties of the layout into its empty hash index
+    void BuildHashIndex(const JSThread *thread);
 
     inline uint32_t GetLength() const
     {
@@ -76,7 +90,23 @@ public:
         return new_capacity > MAX_PROPERTIES_LENGTH ? MAX_PROPERTIES_LENGTH : new_capacity;
     }
 
+    static inline bool NeedsHashIndex(uint32_t capacity)
+    {
+        return capacity >= static_cast<uint32_t>(HASH_INDEX_MIN_CAPACITY);
+    }
+
+    // the power of two which is at least twice the capacity
+    static inline uint32_t ComputeHashIndexLength(uint32_t capacity)
+    {
+        uint32_t length = 1;
+        while (length < (capacity << 1U)) {
+            length <<= 1U;
+        }
+        return length;
+    }
+
     int FindElementWithCache(JSThread *thread, JSHClass *cls, JSTaggedValue key, int propertiesNumber);
+    int FindElementInHashIndex(JSTaggedValue key, int propertiesNumber);
     int BinarySearch(JSTaggedValue key, int propertiesNumber);
     void GetAllKeys(const JSThread *thread, int end, int offset, TaggedArray *keyArray);
     void GetAllKeys(const JSThread *thread, int end, std::vector<JSTaggedValue> &keyVector);
@@ -84,6 +114,9 @@ public:
     void GetAllNames(const JSThread *thread, int end, const JSHandle<TaggedArray> &keyArray, uint32_t *length);
 
     DECL_DUMP()
+
+private:
+    void AddToHashIndex(const JSThread *thread, int index);
 };
 }  // namespace panda::ecmascript
 
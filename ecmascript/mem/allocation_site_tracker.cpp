@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/mem/allocation_site_tracker.h"
+
+#include <algorithm>
+
+#include "ecmascript/mem/region-inl.h"
+#include "libpandabase/utils/logger.h"
+
+namespace panda::ecmascript {
+MemSpaceType AllocationSiteTracker::GetAllocationSpace(uintptr_t site)
+{
+    SiteInfo &info = sites_[site];
+    if (info.pretenured && (info.oldAllocatedCount + info.youngAllocatedCount) % SAMPLE_INTERVAL != 0) {
+        info.oldAllocatedCount++;
+        return MemSpaceType::OLD_SPACE;
+    }
+    info.youngAllocatedCount++;
+    return MemSpaceType::SEMI_SPACE;
+}
+
+void AllocationSiteTracker::RecordAllocation(uintptr_t site, TaggedObject *object)
+{
+    if (mementos_.size() >= MAX_MEMENTO_COUNT || !Region::ObjectAddressToRange(object)->InYoungGeneration()) {
+        return;
+    }
+    mementos_.emplace_back(object, site);
+}
+
+void AllocationSiteTracker::ProcessMementos()
+{
+    for (auto [object, site] : mementos_) {
+        Region *region = Region::ObjectAddressToRange(object);
+        ASSERT(region->InYoungGeneration());
+        SiteInfo &info = sites_[site];
+        info.foundCount++;
+        if (region->Test(object)) {
+            info.survivedCount++;
+        }
+    }
+    mementos_.clear();
+    for (auto &iter : sites_) {
+        UpdateDecision(iter.second);
+    }
+}
+
+void AllocationSiteTracker::UpdateDecision(SiteInfo &info)
+{
+    if (info.foundCount < MIN_FEEDBACK_COUNT) {
+        return;
+    }
+    double survivalRate = static_cast<double>(info.survivedCount) / info.foundCount;
+    info.totalFoundCount += info.foundCount;
+    info.totalSurvivedCount += info.survivedCount;
+    info.foundCount = 0;
+    info.survivedCount = 0;
+    if (!info.pretenured && survivalRate >= PRETENURE_SURVIVAL_RATE) {
+        info.pretenured = true;
+        info.switchCount++;
+        pretenuredSiteCount_++;
+    } else if (info.pretenured && survivalRate < DEPRETENURE_SURVIVAL_RATE) {
+        info.pretenured = false;
+        info.switchCount++;
+        pretenuredSiteCount_--;
+    }
+}
+
+void AllocationSiteTracker::PrintStatisticResult() const
+{
+    std::vector<std::pair<uintptr_t, const SiteInfo *>> sites;
+    for (const auto &iter : sites_) {
+        if (iter.second.oldAllocatedCount != 0) {
+            sites.emplace_back(iter.first, &iter.second);
+        }
+    }
+    if (sites.empty()) {
+        return;
+    }
+    size_t printCount = std::min(sites.size(), PRINT_SITE_COUNT);
+    std::partial_sort(sites.begin(), sites.begin() + printCount, sites.end(), [](const auto &a, const auto &b) {
+        return a.second->oldAllocatedCount > b.second->oldAllocatedCount;
+    });
+    LOG(INFO, RUNTIME) << " Pretenuring statistic: pretenured site count " << pretenuredSiteCount_
+                       << " tracked site count " << sites_.size();
+    for (size_t i = 0; i < printCount; i++) {
+        const SiteInfo *info = sites[i].second;
+        double survivalRate = info->totalFoundCount == 0 ? 0 :
+            static_cast<double>(info->totalSurvivedCount) / info->totalFoundCount;
+        LOG(INFO, RUNTIME) << " site " << std::hex << sites[i].first << std::dec
+                           << (info->pretenured ? " pretenured" : " young")
+                           << " old allocated count " << info->oldAllocatedCount
+                           << " young allocated count " << info->youngAllocatedCount
+                           << " survival rate " << survivalRate
+                           << " switch count " << info->switchCount;
+    }
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_MEM_ALLOCATION_SITE_TRACKER_H
+#define ECMASCRIPT_MEM_ALLOCATION_SITE_TRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ecmascript/mem/space.h"
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript {
+class TaggedObject;
+
+// AllocationSiteTracker decides per allocation site, i.e. the bytecode creating an object or array literal, whether
+// its objects are allocated in the young space or directly in the old space.
+// A young allocation of a site leaves a memento, the object and its site, in a side table. The partial gc looks the
+// mementos up in the young mark bitset before evacuating, so a site learns how many of its objects survived. Once
+// at least MIN_FEEDBACK_COUNT of them were seen, a site surviving at PRETENURE_SURVIVAL_RATE is pretenured, and a
+// pretenured one surviving below DEPRETENURE_SURVIVAL_RATE goes back to the young space. A pretenured site still
+// allocates one in SAMPLE_INTERVAL objects young to keep its feedback going.
+class AllocationSiteTracker {
+public:
+    AllocationSiteTracker() = default;
+    ~AllocationSiteTracker() = default;
+    NO_COPY_SEMANTIC(AllocationSiteTracker);
+    NO_MOVE_SEMANTIC(AllocationSiteTracker);
+
+    // the space the next object of the site is allocated in
+    MemSpaceType GetAllocationSpace(uintptr_t site);
+    // the object was just allocated in the young space for the site
+    void RecordAllocation(uintptr_t site, TaggedObject *object);
+    // call after the young generation was marked and before it is evacuated
+    void ProcessMementos();
+    // the objects move without their marks being checked, e.g. by the full gc
+    void ClearMementos()
+    {
+        mementos_.clear();
+    }
+
+    bool IsPretenured(uintptr_t site) const
+    {
+        auto iter = sites_.find(site);
+        return iter != sites_.end() && iter->second.pretenured;
+    }
+
+    size_t GetPretenuredSiteCount() const
+    {
+        return pretenuredSiteCount_;
+    }
+
+    // log the most pretenured sites
+    void PrintStatisticResult() const;
+
+private:
+    static constexpr size_t MIN_FEEDBACK_COUNT = 32;
+    static constexpr double PRETENURE_SURVIVAL_RATE = 0.85;
+    static constexpr double DEPRETENURE_SURVIVAL_RATE = 0.5;
+    static constexpr size_t SAMPLE_INTERVAL = 16;
+    // bounds the side table, the allocations beyond it are not tracked until the next gc
+    static constexpr size_t MAX_MEMENTO_COUNT = 16384;
+    static constexpr size_t PRINT_SITE_COUNT = 10;
+
+    struct SiteInfo {
+        bool pretenured {false};
+        // since the last decision
+        size_t foundCount {0};
+        size_t survivedCount {0};
+        // over the whole run
+        size_t youngAllocatedCount {0};
+        size_t oldAllocatedCount {0};
+        size_t totalSurvivedCount {0};
+        size_t totalFoundCount {0};
+        size_t switchCount {0};
+    };
+
+    void UpdateDecision(SiteInfo &info);
+
+    std::unordered_map<uintptr_t, SiteInfo> sites_ {};
+    std::vector<std::pair<TaggedObject *, uintptr_t>> mementos_ {};
+    size_t pretenuredSiteCount_ {0};
+};
+}  // namespace panda::ecmascript
+
+#endif  // ECMASCRIPT_MEM_ALLOCATION_SITE_TRACKER_H
@@ -105,6 +105,11 @@ uintptr_t FreeListAllocator::Allocate(FreeObject *object, size_t size)
     uintptr_t end = object->GetEnd();
     uintptr_t remainSize = end - begin - size;
     ASSERT(remainSize >= 0);
+    // The pages of a region decommitted while idle are faulted back in by this allocation.
+    Region *region = Region::ObjectAddressToRange(begin);
+    if (UNLIKELY(region->GetDecommittedSize() != 0)) {
+        heap_->GetHeapRegionAllocator()->RecommitRegion(region);
+    }
     // Keep a longest freeObject between bump-pointer and free object that just allocated
     allocationSizeAccumulator_ += size;
     if (remainSize <= bpAllocator_.Available()) {
@@ -17,6 +17,7 @@
 
 #include "ecmascript/mem/allocator-inl.h"
 #include "ecmascript/mem/clock_scope.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/mem/heap-inl.h"
 #include "ecmascript/mem/mark_stack.h"
 #include "ecmascript/mem/mark_word.h"
@@ -42,6 +43,7 @@ void ConcurrentMarker::Mark()
 {
     ECMA_GC_LOG() << "ConcurrentMarker: Concurrent Marking Begin";
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "ConcurrentMarker::Mark");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "ConcurrentMarker::Mark");
     MEM_ALLOCATE_AND_GC_TRACE(vm_, ConcurrentMarking);
     ClockScope scope;
     InitializeMarking();
@@ -62,6 +64,7 @@ void ConcurrentMarker::ReMark()
 {
     ECMA_GC_LOG() << "ConcurrentMarker: Remarking Begin";
     MEM_ALLOCATE_AND_GC_TRACE(vm_, ReMarking);
+    GCTraceScope traceScope(heap_->GetGCTracer(), "ConcurrentMarker::ReMark");
     ClockScope scope;
     Marker *nonMoveMarker = heap_->GetNonMovableMarker();
     nonMoveMarker->MarkRoots(MAIN_THREAD_INDEX);
@@ -136,6 +139,7 @@ void ConcurrentMarker::InitializeMarking()
 
 bool ConcurrentMarker::MarkerTask::Run(uint32_t threadId)
 {
+    GCTraceScope traceScope(heap_->GetGCTracer(), "ConcurrentMarker::MarkerTask");
     ClockScope clockScope;
     heap_->GetNonMovableMarker()->ProcessMarkStack(threadId);
     heap_->WaitRunningTaskFinished();
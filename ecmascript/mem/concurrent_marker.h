@@ -41,6 +41,10 @@ public:
     void WaitMarkingFinished();  // call in main thread
     void Reset(bool isRevertCSet = true);
 
+    // The incremental marker shares the start and the end of the marking, only its marking runs in the js thread.
+    void InitializeMarking();
+    void FinishMarking(float spendTime);
+
     double GetDuration() const
     {
         return duration_;
@@ -73,9 +77,6 @@ private:
         duration_ = duration;
     }
 
-    void InitializeMarking();
-    void FinishMarking(float spendTime);
-
     Heap *heap_ {nullptr};
     EcmaVM *vm_ {nullptr};
     JSThread *thread_ {nullptr};
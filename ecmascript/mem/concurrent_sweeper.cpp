@@ -15,8 +15,12 @@
 
 #include "ecmascript/mem/concurrent_sweeper.h"
 
+#include <algorithm>
+
 #include "ecmascript/ecma_macros.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/mem/heap.h"
+#include "ecmascript/mem/mem_controller.h"
 #include "ecmascript/mem/space-inl.h"
 #include "ecmascript/taskpool/taskpool.h"
 #include "ecmascript/runtime_call_id.h"
@@ -30,17 +34,18 @@ ConcurrentSweeper::ConcurrentSweeper(Heap *heap, bool concurrentSweep)
 void ConcurrentSweeper::PostConcurrentSweepTasks(bool fullGC)
 {
     if (concurrentSweep_) {
-        if (!fullGC) {
-            Taskpool::GetCurrentTaskpool()->PostTask(std::make_unique<SweeperTask>(this, OLD_SPACE));
+        int sweepTypeNum = FREE_LIST_NUM - startSpaceType_;
+        for (uint32_t i = 0; i < sweepTaskNum_; i++) {
+            auto type = static_cast<MemSpaceType>(i % sweepTypeNum + startSpaceType_);
+            Taskpool::GetCurrentTaskpool()->PostTask(std::make_unique<SweeperTask>(this, type));
         }
-        Taskpool::GetCurrentTaskpool()->PostTask(std::make_unique<SweeperTask>(this, NON_MOVABLE));
-        Taskpool::GetCurrentTaskpool()->PostTask(std::make_unique<SweeperTask>(this, MACHINE_CODE_SPACE));
     }
 }
 
 void ConcurrentSweeper::Sweep(bool fullGC)
 {
     MEM_ALLOCATE_AND_GC_TRACE(heap_->GetEcmaVM(), ConcurrentSweepingInitialize);
+    GCTraceScope traceScope(heap_->GetGCTracer(), "ConcurrentSweeper::Sweep");
     if (concurrentSweep_) {
         // Add all region to region list. Ensure all task finish
         if (!fullGC) {
@@ -52,8 +57,11 @@ void ConcurrentSweeper::Sweep(bool fullGC)
         // Prepare
         isSweeping_ = true;
         startSpaceType_ = fullGC ? NON_MOVABLE : OLD_SPACE;
+        // Every task sweeps every space, claiming one region at a time, so all taskpool threads can share a space.
+        sweepTaskNum_ = std::max<uint32_t>(Taskpool::GetCurrentTaskpool()->GetTotalThreadNum(),
+                                           FREE_LIST_NUM - startSpaceType_);
         for (int type = startSpaceType_; type < FREE_LIST_NUM; type++) {
-            remainingTaskNum_[type] = FREE_LIST_NUM - startSpaceType_;
+            remainingTaskNum_[type] = static_cast<int>(sweepTaskNum_);
         }
     } else {
         if (!fullGC) {
@@ -112,6 +120,30 @@ void ConcurrentSweeper::EnsureTaskFinished(MemSpaceType type)
     WaitingTaskFinish(type);
 }
 
+bool ConcurrentSweeper::SweepUntil(double deadlineMs)
+{
+    CHECK_JS_THREAD(heap_->GetEcmaVM());
+    if (!isSweeping_) {
+        return true;
+    }
+    for (int i = startSpaceType_; i < FREE_LIST_NUM; i++) {
+        SparseSpace *space = heap_->GetSpaceWithType(static_cast<MemSpaceType>(i));
+        while (MemController::GetSystemTimeInMs() < deadlineMs) {
+            Region *current = space->GetSweepingRegionSafe();
+            if (current == nullptr) {
+                break;
+            }
+            space->FreeRegion(current);
+        }
+        if (MemController::GetSystemTimeInMs() >= deadlineMs) {
+            return false;
+        }
+    }
+    // No region is left to sweep, the tasks only have to finish the regions they are sweeping.
+    EnsureAllTaskFinished();
+    return true;
+}
+
 void ConcurrentSweeper::WaitingTaskFinish(MemSpaceType type)
 {
     if (remainingTaskNum_[type] > 0) {
@@ -136,6 +168,7 @@ void ConcurrentSweeper::FinishSweeping(MemSpaceType type)
 
 bool ConcurrentSweeper::SweeperTask::Run([[maybe_unused]] uint32_t threadIndex)
 {
+    GCTraceScope traceScope(sweeper_->heap_->GetGCTracer(), "ConcurrentSweeper::SweeperTask");
     int sweepTypeNum = FREE_LIST_NUM - sweeper_->startSpaceType_;
     for (size_t i = sweeper_->startSpaceType_; i < FREE_LIST_NUM; i++) {
         auto type = static_cast<MemSpaceType>(((i + type_) % sweepTypeNum) + sweeper_->startSpaceType_);
@@ -41,6 +41,14 @@ public:
     void EnsureAllTaskFinished();
     // Ensure task finish
     void EnsureTaskFinished(MemSpaceType type);
+    // Help to sweep through js thread one region at a time until deadlineMs (MemController::GetSystemTimeInMs).
+    // Returns true if sweeping is finished.
+    bool SweepUntil(double deadlineMs);
+
+    bool IsSweeping() const
+    {
+        return isSweeping_;
+    }
 
 private:
     class SweeperTask : public Task {
@@ -69,6 +77,7 @@ private:
     Heap *heap_;
     bool concurrentSweep_ {false};
     bool isSweeping_ {false};
+    uint32_t sweepTaskNum_ {0};
     MemSpaceType startSpaceType_ = MemSpaceType::OLD_SPACE;
 };
 }  // namespace panda::ecmascript
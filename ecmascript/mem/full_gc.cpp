@@ -18,6 +18,7 @@
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/mem/clock_scope.h"
 #include "ecmascript/mem/concurrent_marker.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/mem/mark_stack.h"
 #include "ecmascript/mem/mem.h"
 #include "ecmascript/mem/parallel_marker-inl.h"
@@ -31,6 +32,7 @@ FullGC::FullGC(Heap *heap) : heap_(heap), workManager_(heap->GetWorkManager()) {
 void FullGC::RunPhases()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "FullGC::RunPhases");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "FullGC::RunPhases");
     MEM_ALLOCATE_AND_GC_TRACE(heap_->GetEcmaVM(), FullGC_RunPhases);
     ClockScope clockScope;
 
@@ -52,6 +54,7 @@ void FullGC::RunPhases()
 void FullGC::Initialize()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "FullGC::Initialize");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "FullGC::Initialize");
     heap_->Prepare();
     auto callback = [](Region *current) {
         current->ClearOldToNewRSet();
@@ -75,6 +78,7 @@ void FullGC::Initialize()
 void FullGC::Mark()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "FullGC::Mark");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "FullGC::Mark");
     heap_->GetCompressGCMarker()->MarkRoots(MAIN_THREAD_INDEX);
     heap_->GetCompressGCMarker()->ProcessMarkStack(MAIN_THREAD_INDEX);
     heap_->WaitRunningTaskFinished();
@@ -83,6 +87,7 @@ void FullGC::Mark()
 void FullGC::Sweep()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "FullGC::Sweep");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "FullGC::Sweep");
     // process weak reference
     auto totalThreadCount = Taskpool::GetCurrentTaskpool()->GetTotalThreadNum() + 1; // gc thread and main thread
     for (uint32_t i = 0; i < totalThreadCount; i++) {
@@ -142,6 +147,7 @@ void FullGC::Sweep()
 void FullGC::Finish()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "FullGC::Finish");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "FullGC::Finish");
     heap_->GetSweeper()->PostConcurrentSweepTasks(true);
     heap_->Resume(FULL_GC);
     workManager_->Finish(youngAndOldAliveSize_);
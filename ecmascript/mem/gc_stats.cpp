@@ -15,8 +15,10 @@
 
 #include "ecmascript/mem/gc_stats.h"
 
+#include "ecmascript/mem/allocation_site_tracker.h"
 #include "ecmascript/mem/heap.h"
 #include "ecmascript/mem/mem.h"
+#include "ecmascript/taskpool/taskpool.h"
 
 namespace panda::ecmascript {
 void GCStats::PrintStatisticResult(bool force)
@@ -25,7 +27,23 @@ void GCStats::PrintStatisticResult(bool force)
     PrintSemiStatisticResult(force);
     PrintPartialStatisticResult(force);
     PrintCompressStatisticResult(force);
+    PrintIdleStatisticResult(force);
+    PrintIncrementalStatisticResult(force);
+    PrintSweepStatisticResult(force);
+    PrintPretenureStatisticResult(force);
     PrintHeapStatisticResult(force);
+    PrintTaskpoolStatisticResult();
+}
+
+void GCStats::PrintTaskpoolStatisticResult()
+{
+    TaskpoolStatistics statistics = Taskpool::GetCurrentTaskpool()->GetStatistics();
+    LOG(INFO, RUNTIME) << " Taskpool statistic: local post count: " << statistics.localPostCount
+                        << " shared post count: " << statistics.sharedPostCount
+                        << " shared pop count: " << statistics.sharedPopCount
+                        << " steal count: " << statistics.stealCount
+                        << " steal conflict count: " << statistics.stealConflictCount
+                        << " idle wait count: " << statistics.idleWaitCount;
 }
 
 void GCStats::PrintSemiStatisticResult(bool force)
@@ -117,6 +135,65 @@ void GCStats::PrintCompressStatisticResult(bool force)
     }
 }
 
+void GCStats::PrintIdleStatisticResult(bool force)
+{
+    if ((force && idleNotificationCount_ != 0) ||
+            (!force && idleNotificationCount_ != lastIdleNotificationCount_)) {
+        lastIdleNotificationCount_ = idleNotificationCount_;
+        LOG(INFO, RUNTIME) << " IdleGC statistic: total idle notification count " << idleNotificationCount_;
+        LOG(INFO, RUNTIME) << " total idle time: " << PrintTimeMilliseconds(idleTotalTime_) << "ms"
+                            << " total used idle time: " << PrintTimeMilliseconds(idleTotalUsedTime_) << "ms"
+                            << " MAX used idle time: " << PrintTimeMilliseconds(idleMaxUsedTime_) << "ms"
+                            << " sweep count: " << idleSweepCount_
+                            << " sweep finished count: " << idleSweepFinishedCount_
+                            << " young gc count: " << idleYoungGCCount_
+                            << " concurrent mark start count: " << idleConcurrentMarkStartCount_
+                            << " concurrent mark finish count: " << idleConcurrentMarkFinishCount_;
+    }
+}
+
+void GCStats::PrintIncrementalStatisticResult(bool force)
+{
+    if ((force && incrementalMarkStepCount_ != 0) ||
+            (!force && incrementalMarkStepCount_ != lastIncrementalMarkStepCount_)) {
+        lastIncrementalMarkStepCount_ = incrementalMarkStepCount_;
+        LOG(INFO, RUNTIME) << " IncrementalMark statistic: total step count " << incrementalMarkStepCount_;
+        LOG(INFO, RUNTIME) << " MAX pause time: " << PrintTimeMilliseconds(incrementalMarkMaxPause_) << "ms"
+                            << " total pause time: " << PrintTimeMilliseconds(incrementalMarkTotalPause_) << "ms"
+                            << " average pause time: "
+                            << PrintTimeMilliseconds(incrementalMarkTotalPause_ / incrementalMarkStepCount_) << "ms";
+    }
+}
+
+void GCStats::PrintSweepStatisticResult(bool force)
+{
+    size_t sweptRegionCount = sweptRegionCount_;
+    if ((force && sweptRegionCount != 0) || (!force && sweptRegionCount != lastSweptRegionCount_)) {
+        lastSweptRegionCount_ = sweptRegionCount;
+        size_t sweepTotalTime = sweepTotalTime_;
+        LOG(INFO, RUNTIME) << " Sweep statistic: total swept region count " << sweptRegionCount
+                            << " lazily swept by allocation: " << lazySweptRegionCount_;
+        LOG(INFO, RUNTIME) << " swept size: " << sizeToMB(sweptSize_) << "MB"
+                            << " total sweep time: " << PrintTimeMilliseconds(sweepTotalTime) << "ms"
+                            << " throughput: "
+                            << (sweepTotalTime == 0 ? 0 : sizeToMB(sweptSize_) * THOUSAND * THOUSAND / sweepTotalTime)
+                            << "MB/s";
+    }
+}
+
+void GCStats::PrintPretenureStatisticResult(bool force)
+{
+    if (heap_ == nullptr) {
+        return;
+    }
+    AllocationSiteTracker *tracker = heap_->GetAllocationSiteTracker();
+    size_t pretenuredSiteCount = tracker->GetPretenuredSiteCount();
+    if ((force && pretenuredSiteCount != 0) || (!force && pretenuredSiteCount != lastPretenuredSiteCount_)) {
+        lastPretenuredSiteCount_ = pretenuredSiteCount;
+        tracker->PrintStatisticResult();
+    }
+}
+
 void GCStats::PrintHeapStatisticResult(bool force)
 {
     if (force && heap_ != nullptr) {
@@ -130,7 +207,11 @@ void GCStats::PrintHeapStatisticResult(bool force)
                             << " native memory usage size:" << sizeToMB(nativeAreaAllocator->GetNativeMemoryUsage())
                             << "MB"
                             << " native memory max usage size:"
-                            << sizeToMB(nativeAreaAllocator->GetMaxNativeMemoryUsage()) << "MB";
+                            << sizeToMB(nativeAreaAllocator->GetMaxNativeMemoryUsage()) << "MB"
+                            << " anno memory resident size:" << sizeToMB(heapRegionAllocator->GetResidentMemoryUsage())
+                            << "MB"
+                            << " anno memory decommitted size:"
+                            << sizeToMB(heapRegionAllocator->GetDecommittedMemorySize()) << "MB";
         LOG(INFO, RUNTIME) << " Semi space commit size" << sizeToMB(heap_->GetNewSpace()->GetCommittedSize()) << "MB"
                             << " semi space heap object size: " << sizeToMB(heap_->GetNewSpace()->GetHeapObjectSize())
                             << "MB"
@@ -233,4 +314,55 @@ void GCStats::StatisticConcurrentRemark(Duration time)
 {
     partialConcurrentMarkRemarkPause_ = TimeToMicroseconds(time);
 }
+
+void GCStats::StatisticIdleNotification(Duration idleTime, Duration time)
+{
+    auto timeInMS = TimeToMicroseconds(time);
+    idleTotalTime_ += TimeToMicroseconds(idleTime);
+    idleTotalUsedTime_ += timeInMS;
+    idleMaxUsedTime_ = std::max(idleMaxUsedTime_, timeInMS);
+    idleNotificationCount_++;
+}
+
+void GCStats::StatisticIdleSweep(bool finished)
+{
+    idleSweepCount_++;
+    if (finished) {
+        idleSweepFinishedCount_++;
+    }
+}
+
+void GCStats::StatisticIdleYoungGC()
+{
+    idleYoungGCCount_++;
+}
+
+void GCStats::StatisticIdleConcurrentMark(bool started)
+{
+    if (started) {
+        idleConcurrentMarkStartCount_++;
+    } else {
+        idleConcurrentMarkFinishCount_++;
+    }
+}
+
+void GCStats::StatisticIncrementalMarkStep(Duration time)
+{
+    auto timeInMS = TimeToMicroseconds(time);
+    incrementalMarkTotalPause_ += timeInMS;
+    incrementalMarkMaxPause_ = std::max(incrementalMarkMaxPause_, timeInMS);
+    incrementalMarkStepCount_++;
+}
+
+void GCStats::StatisticSweptRegion(size_t size, Duration time)
+{
+    sweptSize_ += size;
+    sweepTotalTime_ += TimeToMicroseconds(time);
+    sweptRegionCount_++;
+}
+
+void GCStats::StatisticLazySweep()
+{
+    lazySweptRegionCount_++;
+}
 }  // namespace panda::ecmascript
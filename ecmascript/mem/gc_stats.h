@@ -17,6 +17,7 @@
 #define ECMASCRIPT_MEM_GC_STATS_H
 
 #include "time.h"
+#include "atomic"
 #include "chrono"
 #include "libpandabase/utils/logger.h"
 
@@ -31,6 +32,7 @@ public:
 
     void PrintStatisticResult(bool force = false);
     void PrintHeapStatisticResult(bool force = true);
+    void PrintTaskpoolStatisticResult();
 
     void StatisticSTWYoungGC(Duration time, size_t aliveSize, size_t promotedSize, size_t commitSize);
     void StatisticPartialGC(bool concurrentMark, Duration time, size_t freeSize);
@@ -40,11 +42,24 @@ public:
     void StatisticConcurrentMarkWait(Duration time);
     void StatisticConcurrentRemark(Duration time);
     void StatisticConcurrentEvacuate(Duration time);
+    // idleTime is the budget given by the embedder, time is the part of it spent on gc work
+    void StatisticIdleNotification(Duration idleTime, Duration time);
+    void StatisticIdleSweep(bool finished);
+    void StatisticIdleYoungGC();
+    void StatisticIdleConcurrentMark(bool started);
+    void StatisticIncrementalMarkStep(Duration time);
+    // called by the sweeper tasks too
+    void StatisticSweptRegion(size_t size, Duration time);
+    void StatisticLazySweep();
 
 private:
     void PrintSemiStatisticResult(bool force);
     void PrintPartialStatisticResult(bool force);
     void PrintCompressStatisticResult(bool force);
+    void PrintIdleStatisticResult(bool force);
+    void PrintIncrementalStatisticResult(bool force);
+    void PrintSweepStatisticResult(bool force);
+    void PrintPretenureStatisticResult(bool force);
 
     size_t TimeToMicroseconds(Duration time)
     {
@@ -100,6 +115,31 @@ private:
     size_t compressNonMoveTotalFreeSize_ = 0;
     size_t compressNonMoveTotalCommitSize_ = 0;
 
+    size_t lastIdleNotificationCount_ = 0;
+    size_t idleNotificationCount_ = 0;
+    size_t idleTotalTime_ = 0;
+    size_t idleTotalUsedTime_ = 0;
+    size_t idleMaxUsedTime_ = 0;
+    size_t idleSweepCount_ = 0;
+    size_t idleSweepFinishedCount_ = 0;
+    size_t idleYoungGCCount_ = 0;
+    size_t idleConcurrentMarkStartCount_ = 0;
+    size_t idleConcurrentMarkFinishCount_ = 0;
+
+    size_t lastIncrementalMarkStepCount_ = 0;
+    size_t incrementalMarkStepCount_ = 0;
+    size_t incrementalMarkMaxPause_ = 0;
+    size_t incrementalMarkTotalPause_ = 0;
+
+    size_t lastSweptRegionCount_ = 0;
+    std::atomic<size_t> sweptRegionCount_ {0};
+    std::atomic<size_t> sweptSize_ {0};
+    // the time spent in sweeping by all threads
+    std::atomic<size_t> sweepTotalTime_ {0};
+    size_t lazySweptRegionCount_ = 0;
+
+    size_t lastPretenuredSiteCount_ = 0;
+
     const Heap *heap_;
 
     static constexpr uint32_t THOUSAND = 1000;
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/mem/gc_tracer.h"
+
+#include <chrono>
+
+#ifdef PANDA_TARGET_UNIX
+#include <unistd.h>
+#endif
+
+#include "os/thread.h"
+
+namespace panda::ecmascript {
+void GCTracer::Start(size_t capacity)
+{
+    os::memory::LockHolder lock(mutex_);
+    events_.assign(capacity == 0 ? DEFAULT_CAPACITY : capacity, Event());
+    next_ = 0;
+    wrapped_ = false;
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void GCTracer::Stop()
+{
+    enabled_.store(false, std::memory_order_relaxed);
+}
+
+void GCTracer::Record(const char *name, uint64_t beginUs, uint64_t endUs, size_t bytes, size_t regions)
+{
+    auto threadId = static_cast<uint32_t>(os::thread::GetCurrentThreadId());
+    os::memory::LockHolder lock(mutex_);
+    // stopped and started again by another thread since the scope was entered
+    if (events_.empty()) {
+        return;
+    }
+    events_[next_] = {name, beginUs, endUs - beginUs, threadId, bytes, regions};
+    next_++;
+    if (next_ == events_.size()) {
+        next_ = 0;
+        wrapped_ = true;
+    }
+}
+
+void GCTracer::Dump(std::ostream &out)
+{
+#ifdef PANDA_TARGET_UNIX
+    int pid = getpid();
+#else
+    int pid = 0;
+#endif
+    os::memory::LockHolder lock(mutex_);
+    out << "{\"traceEvents\":[";
+    size_t count = wrapped_ ? events_.size() : next_;
+    size_t first = wrapped_ ? next_ : 0;
+    for (size_t i = 0; i < count; i++) {
+        const Event &event = events_[(first + i) % events_.size()];
+        if (i != 0) {
+            out << ",";
+        }
+        out << "\n{\"name\":\"" << event.name << "\",\"cat\":\"gc\",\"ph\":\"X\""
+            << ",\"ts\":" << event.beginUs << ",\"dur\":" << event.durationUs
+            << ",\"pid\":" << pid << ",\"tid\":" << event.threadId
+            << ",\"args\":{\"bytes\":" << event.bytes << ",\"regions\":" << event.regions << "}}";
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+uint64_t GCTracer::GetTimeInUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_MEM_GC_TRACER_H
+#define ECMASCRIPT_MEM_GC_TRACER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "libpandabase/macros.h"
+#include "os/mutex.h"
+
+namespace panda::ecmascript {
+// GCTracer records the gc phases and gc tasks of a heap, on whichever thread they run, into a ring buffer which
+// keeps the latest events, and dumps them in the chrome trace event format, e.g. for chrome://tracing or perfetto.
+// Each event is a complete one, its begin and end, together with the bytes and regions it processed.
+// While not started, a traced scope costs the check of the enabled flag only.
+class GCTracer {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+    GCTracer() = default;
+    ~GCTracer() = default;
+    NO_COPY_SEMANTIC(GCTracer);
+    NO_MOVE_SEMANTIC(GCTracer);
+
+    // drop the recorded events and record the latest capacity ones from now on
+    void Start(size_t capacity = DEFAULT_CAPACITY);
+    // stop recording, the recorded events are kept for the dump
+    void Stop();
+
+    bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    // name must be a string literal
+    void Record(const char *name, uint64_t beginUs, uint64_t endUs, size_t bytes, size_t regions);
+
+    // write the events as a chrome trace json object, the oldest first
+    void Dump(std::ostream &out);
+
+    static uint64_t GetTimeInUs();
+
+private:
+    struct Event {
+        const char *name {nullptr};
+        uint64_t beginUs {0};
+        uint64_t durationUs {0};
+        uint32_t threadId {0};
+        size_t bytes {0};
+        size_t regions {0};
+    };
+
+    std::atomic_bool enabled_ {false};
+    // guards the ring buffer, the events of the parallel gc tasks are recorded concurrently
+    os::memory::Mutex mutex_;
+    std::vector<Event> events_ {};
+    // the next slot to write, events_ is full once it wrapped around
+    size_t next_ {0};
+    bool wrapped_ {false};
+};
+
+// Trace the scope as one event of the tracer, if the tracer is started when the scope is entered.
+class GCTraceScope {
+public:
+    GCTraceScope(GCTracer *tracer, const char *name)
+        : tracer_(tracer->IsEnabled() ? tracer : nullptr), name_(name)
+    {
+        if (tracer_ != nullptr) {
+            beginUs_ = GCTracer::GetTimeInUs();
+        }
+    }
+
+    ~GCTraceScope()
+    {
+        if (tracer_ != nullptr) {
+            tracer_->Record(name_, beginUs_, GCTracer::GetTimeInUs(), bytes_, regions_);
+        }
+    }
+
+    NO_COPY_SEMANTIC(GCTraceScope);
+    NO_MOVE_SEMANTIC(GCTraceScope);
+
+    void SetBytes(size_t bytes)
+    {
+        bytes_ = bytes;
+    }
+
+    void AddBytes(size_t bytes)
+    {
+        bytes_ += bytes;
+    }
+
+    void SetRegions(size_t regions)
+    {
+        regions_ = regions;
+    }
+
+    void AddRegions(size_t regions)
+    {
+        regions_ += regions;
+    }
+
+private:
+    GCTracer *tracer_ {nullptr};
+    const char *name_ {nullptr};
+    uint64_t beginUs_ {0};
+    size_t bytes_ {0};
+    size_t regions_ {0};
+};
+}  // namespace panda::ecmascript
+
+#endif  // ECMASCRIPT_MEM_GC_TRACER_H
@@ -24,12 +24,17 @@
 #include "ecmascript/dfx/cpu_profiler/cpu_profiler.h"
 #endif
 #include "ecmascript/ecma_vm.h"
+#include "ecmascript/mem/allocation_site_tracker.h"
 #include "ecmascript/mem/assert_scope.h"
 #include "ecmascript/mem/concurrent_marker.h"
 #include "ecmascript/mem/concurrent_sweeper.h"
 #include "ecmascript/mem/full_gc.h"
+#include "ecmascript/mem/gc_tracer.h"
+#include "ecmascript/mem/idle_gc_scheduler.h"
+#include "ecmascript/mem/incremental_marker.h"
 #include "ecmascript/mem/mark_stack.h"
 #include "ecmascript/mem/mem_controller.h"
+#include "ecmascript/mem/mem_map_allocator.h"
 #include "ecmascript/mem/partial_gc.h"
 #include "ecmascript/mem/native_area_allocator.h"
 #include "ecmascript/mem/parallel_evacuator.h"
@@ -78,6 +83,15 @@ void Heap::Initialize()
 #if defined(IS_STANDARD_SYSTEM)
     concurrentMarkingEnabled_ = false;
 #endif
+    // A concurrent marker without a spare core only competes with the js thread, the marking is done in steps instead.
+    incrementalMarkingEnabled_ = ecmaVm_->GetJSOptions().IsEnableIncrementalMark();
+    if (incrementalMarkingEnabled_ && concurrentMarkingEnabled_ &&
+        Taskpool::GetCurrentTaskpool()->GetTotalThreadNum() <= 1) {
+        LOG_ECMA(INFO) << "Heap::Initialize: the taskpool has no spare thread, incremental marking replaces "
+                       << "concurrent marking";
+        concurrentMarkingEnabled_ = false;
+    }
+    incrementalMarkingEnabled_ = incrementalMarkingEnabled_ && !concurrentMarkingEnabled_;
     workManager_ = new WorkManager(this, Taskpool::GetCurrentTaskpool()->GetTotalThreadNum() + 1);
     stwYoungGC_ = new STWYoungGC(this, parallelGC_);
     fullGC_ = new FullGC(this);
@@ -86,10 +100,14 @@ void Heap::Initialize()
     partialGC_ = new PartialGC(this);
     sweeper_ = new ConcurrentSweeper(this, ecmaVm_->GetJSOptions().IsEnableConcurrentSweep());
     concurrentMarker_ = new ConcurrentMarker(this);
+    incrementalMarker_ = new IncrementalMarker(this);
     nonMovableMarker_ = new NonMovableMarker(this);
     semiGCMarker_ = new SemiGCMarker(this);
     compressGCMarker_ = new CompressGCMarker(this);
     evacuator_ = new ParallelEvacuator(this);
+    idleGCScheduler_ = new IdleGCScheduler(this);
+    allocationSiteTracker_ = new AllocationSiteTracker();
+    gcTracer_ = new GCTracer();
 }
 
 void Heap::Destroy()
@@ -163,6 +181,22 @@ void Heap::Destroy()
         delete sweeper_;
         sweeper_ = nullptr;
     }
+    if (idleGCScheduler_ != nullptr) {
+        delete idleGCScheduler_;
+        idleGCScheduler_ = nullptr;
+    }
+    if (incrementalMarker_ != nullptr) {
+        delete incrementalMarker_;
+        incrementalMarker_ = nullptr;
+    }
+    if (allocationSiteTracker_ != nullptr) {
+        delete allocationSiteTracker_;
+        allocationSiteTracker_ = nullptr;
+    }
+    if (gcTracer_ != nullptr) {
+        delete gcTracer_;
+        gcTracer_ = nullptr;
+    }
     if (derivedPointers_ != nullptr) {
         delete derivedPointers_;
         derivedPointers_ = nullptr;
@@ -253,11 +287,13 @@ void Heap::CollectGarbage(TriggerGCType gcType)
     memController_->StartCalculationBeforeGC();
     OPTIONAL_LOG(ecmaVm_, ERROR, ECMASCRIPT) << "Heap::CollectGarbage, gcType = " << gcType
                                              << " global CommittedSize" << GetCommittedSize()
-                                             << " global limit" << globalSpaceAllocLimit_;
+                                             << " global limit" << globalSpaceAllocLimit_
+                                             << " old space fragmentation" << oldSpace_->GetFragmentationRate()
+                                             << " old space wasted size" << oldSpace_->GetWastedSize();
     switch (gcType) {
         case TriggerGCType::YOUNG_GC:
-            // Use partial GC for young generation.
-            if (!concurrentMarkingEnabled_) {
+            // Use partial GC for young generation, which finishes an incremental full mark in progress.
+            if (!concurrentMarkingEnabled_ && thread_->IsReadyToMark()) {
                 SetMarkType(MarkType::MARK_YOUNG);
             }
             partialGC_->RunPhases();
@@ -275,6 +311,7 @@ void Heap::CollectGarbage(TriggerGCType gcType)
             partialGC_->RunPhases();
             break;
         case TriggerGCType::FULL_GC:
+            allocationSiteTracker_->ClearMementos();
             fullGC_->RunPhases();
             if (fullGCRequested_) {
                 fullGCRequested_ = false;
@@ -296,13 +333,20 @@ void Heap::CollectGarbage(TriggerGCType gcType)
 
     memController_->StopCalculationAfterGC(gcType);
 
+    // The regions freed by this gc may be kept resident for the next ones, those of earlier gcs may have aged enough.
+    if (MemMapAllocator::GetInstance()->GetResidentCacheSize() != 0) {
+        Taskpool::GetCurrentTaskpool()->PostTask(
+            std::make_unique<ReleaseIdleMemTask>(ecmaVm_->GetJSOptions().GetRegionDecommitAge()));
+    }
+
     if (gcType == TriggerGCType::FULL_GC || IsFullMark()) {
         // Only when the gc type is not semiGC and after the old space sweeping has been finished,
         // the limits of old space and global space can be recomputed.
         RecomputeLimits();
         OPTIONAL_LOG(ecmaVm_, ERROR, ECMASCRIPT) << " GC after: is full mark" << IsFullMark()
                                                  << " global CommittedSize" << GetCommittedSize()
-                                                 << " global limit" << globalSpaceAllocLimit_;
+                                                 << " global limit" << globalSpaceAllocLimit_
+                                                 << " old space fragmentation" << oldSpace_->GetFragmentationRate();
         markType_ = MarkType::MARK_YOUNG;
     }
 
@@ -403,15 +447,52 @@ void Heap::CheckAndTriggerOldGC()
     }
 }
 
+void Heap::NotifyIdle(double idleMs)
+{
+    // the idle notifications return the freed regions once they aged, so they need not be released on free
+    MemMapAllocator::GetInstance()->KeepFreedMemResident(true);
+    idleGCScheduler_->NotifyIdle(idleMs);
+}
+
+void Heap::NotifyMemoryPressure(bool critical)
+{
+    if (critical) {
+        CollectGarbage(TriggerGCType::FULL_GC);
+    }
+    size_t decommittedSize = DecommitFreeMemory(true);
+    OPTIONAL_LOG(ecmaVm_, ERROR, ECMASCRIPT) << "Heap::NotifyMemoryPressure, critical = " << critical
+                                             << ", decommitted size = " << decommittedSize;
+}
+
+size_t Heap::DecommitFreeMemory(bool force)
+{
+    if (force) {
+        // Finish the sweeping and the reclaiming of the regions the last gc freed.
+        Prepare();
+    }
+    double ageMs = force ? 0 : ecmaVm_->GetJSOptions().GetRegionDecommitAge();
+    size_t decommittedSize = MemMapAllocator::GetInstance()->ReleaseIdleMem(ageMs);
+    // The regions the last sweeping left free have not been used since the end of the last gc at the latest.
+    if (!sweeper_->IsSweeping() && MemController::GetSystemTimeInMs() - memController_->GetGCEndTime() >= ageMs) {
+        decommittedSize += oldSpace_->DecommitFreeRegions();
+        decommittedSize += nonMovableSpace_->DecommitFreeRegions();
+    }
+    return decommittedSize;
+}
+
 bool Heap::CheckConcurrentMark()
 {
-    if (concurrentMarkingEnabled_ && !thread_->IsReadyToMark()) {
+    if ((concurrentMarkingEnabled_ || incrementalMarkingEnabled_) && !thread_->IsReadyToMark()) {
         if (thread_->IsMarking()) {
             [[maybe_unused]] ClockScope clockScope;
             ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "Heap::CheckConcurrentMark");
             MEM_ALLOCATE_AND_GC_TRACE(GetEcmaVM(), WaitConcurrentMarkingFinished);
-            GetNonMovableMarker()->ProcessMarkStack(MAIN_THREAD_INDEX);
-            WaitConcurrentMarkingFinished();
+            if (incrementalMarkingEnabled_) {
+                incrementalMarker_->FinishMarking();
+            } else {
+                GetNonMovableMarker()->ProcessMarkStack(MAIN_THREAD_INDEX);
+                WaitConcurrentMarkingFinished();
+            }
             ecmaVm_->GetEcmaGCStats()->StatisticConcurrentMarkWait(clockScope.GetPauseTime());
             ECMA_GC_LOG() << "wait concurrent marking finish pause time " << clockScope.TotalSpentTime();
         }
@@ -499,6 +580,30 @@ void Heap::TryTriggerConcurrentMarking()
     }
 }
 
+void Heap::TryTriggerIncrementalMarking()
+{
+    // The incremental marking only does full marks, a young mark is not worth the steps on top of the young gc.
+    // It starts short of the limits of old space and global space, which would trigger an old gc marking everything
+    // in one pause, and not while sweeping since its start would wait for the sweeper.
+    if (!incrementalMarkingEnabled_) {
+        return;
+    }
+    if (thread_->IsMarking()) {
+        incrementalMarker_->Step();
+        return;
+    }
+    if (!thread_->IsReadyToMark() || fullGCRequested_ || sweeper_->IsSweeping()) {
+        return;
+    }
+    size_t oldSpaceHeapObjectSize = oldSpace_->GetHeapObjectSize() + hugeObjectSpace_->GetHeapObjectSize();
+    if (oldSpaceHeapObjectSize >= oldSpace_->GetInitialCapacity() * INCREMENTAL_MARK_START_RATE ||
+        GetHeapObjectSize() >= globalSpaceAllocLimit_ * INCREMENTAL_MARK_START_RATE) {
+        markType_ = MarkType::MARK_FULL;
+        incrementalMarker_->Mark();
+        OPTIONAL_LOG(ecmaVm_, ERROR, ECMASCRIPT) << "Trigger incremental full mark";
+    }
+}
+
 void Heap::TriggerConcurrentMarking()
 {
     if (concurrentMarkingEnabled_ && !fullGCRequested_) {
@@ -583,6 +688,7 @@ void Heap::ReduceTaskCount()
 
 bool Heap::ParallelGCTask::Run(uint32_t threadIndex)
 {
+    GCTraceScope traceScope(heap_->GetGCTracer(), "Heap::ParallelGCTask");
     switch (taskPhase_) {
         case ParallelGCTaskPhase::SEMI_HANDLE_THREAD_ROOTS_TASK:
             heap_->GetSemiGCMarker()->MarkRoots(threadIndex);
@@ -613,6 +719,12 @@ bool Heap::ParallelGCTask::Run(uint32_t threadIndex)
     return true;
 }
 
+bool Heap::ReleaseIdleMemTask::Run([[maybe_unused]] uint32_t threadIndex)
+{
+    MemMapAllocator::GetInstance()->ReleaseIdleMem(ageMs_);
+    return true;
+}
+
 bool Heap::AsyncClearTask::Run([[maybe_unused]] uint32_t threadIndex)
 {
     heap_->ReclaimRegions(gcType_, lastRegionOfToSpace_);
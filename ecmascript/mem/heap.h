@@ -26,12 +26,16 @@
 #include "ecmascript/taskpool/taskpool.h"
 
 namespace panda::ecmascript {
+class AllocationSiteTracker;
 class ConcurrentMarker;
 class ConcurrentSweeper;
 class EcmaVM;
 class FullGC;
+class GCTracer;
 class HeapRegionAllocator;
 class HeapTracker;
+class IdleGCScheduler;
+class IncrementalMarker;
 class Marker;
 class MemController;
 class NativeAreaAllocator;
@@ -148,6 +152,21 @@ public:
         return concurrentMarker_;
     }
 
+    IncrementalMarker *GetIncrementalMarker() const
+    {
+        return incrementalMarker_;
+    }
+
+    AllocationSiteTracker *GetAllocationSiteTracker() const
+    {
+        return allocationSiteTracker_;
+    }
+
+    GCTracer *GetGCTracer() const
+    {
+        return gcTracer_;
+    }
+
     Marker *GetNonMovableMarker() const
     {
         return nonMovableMarker_;
@@ -216,6 +235,11 @@ public:
         return heapRegionAllocator_;
     }
 
+    HeapRegionAllocator *GetHeapRegionAllocator()
+    {
+        return heapRegionAllocator_;
+    }
+
     /*
      * GC triggers.
      */
@@ -223,6 +247,18 @@ public:
 
     void CheckAndTriggerOldGC();
 
+    // Spend the next idleMs milliseconds, in which the js thread has nothing else to do, on gc work.
+    void NotifyIdle(double idleMs);
+
+    // Shrink the heap as far as possible right now, a critical pressure also runs a compacting gc first.
+    void NotifyMemoryPressure(bool critical);
+
+    /*
+     * Return the free memory which was not used for the region decommit age to the os, or all of it if force is
+     * set. Returns the decommitted size.
+     */
+    size_t DecommitFreeMemory(bool force = false);
+
     /*
      * Parallel GC related configurations and utilities.
      */
@@ -243,6 +279,9 @@ public:
     void EnableConcurrentMarking(bool flag)
     {
         concurrentMarkingEnabled_ = flag;
+        if (flag) {
+            incrementalMarkingEnabled_ = false;
+        }
     }
 
     bool ConcurrentMarkingEnabled() const
@@ -254,6 +293,25 @@ public:
 
     void TriggerConcurrentMarking();
 
+    /*
+     * Incremental marking, which replaces the concurrent marking without a spare core for it.
+     */
+    void EnableIncrementalMarking(bool flag)
+    {
+        incrementalMarkingEnabled_ = flag;
+        if (flag) {
+            concurrentMarkingEnabled_ = false;
+        }
+    }
+
+    bool IncrementalMarkingEnabled() const
+    {
+        return incrementalMarkingEnabled_;
+    }
+
+    // Start the incremental full mark, or take a step of it, in an allocation slow path of the js thread.
+    void TryTriggerIncrementalMarking();
+
     bool CheckConcurrentMark();
 
     /*
@@ -359,7 +417,8 @@ private:
 
     class ParallelGCTask : public Task {
     public:
-        ParallelGCTask(Heap *heap, ParallelGCTaskPhase taskPhase) : heap_(heap), taskPhase_(taskPhase) {};
+        ParallelGCTask(Heap *heap, ParallelGCTaskPhase taskPhase)
+            : Task(TaskPriority::HIGH), heap_(heap), taskPhase_(taskPhase) {};
         ~ParallelGCTask() override = default;
         bool Run(uint32_t threadIndex) override;
 
@@ -371,9 +430,21 @@ private:
         ParallelGCTaskPhase taskPhase_;
     };
 
+    class ReleaseIdleMemTask : public Task {
+    public:
+        explicit ReleaseIdleMemTask(double ageMs) : Task(TaskPriority::LOW), ageMs_(ageMs) {}
+        ~ReleaseIdleMemTask() override = default;
+        bool Run(uint32_t threadIndex) override;
+
+        NO_COPY_SEMANTIC(ReleaseIdleMemTask);
+        NO_MOVE_SEMANTIC(ReleaseIdleMemTask);
+    private:
+        double ageMs_ {0.0};
+    };
+
     class AsyncClearTask : public Task {
     public:
-        AsyncClearTask(Heap *heap, TriggerGCType type) : heap_(heap), gcType_(type)
+        AsyncClearTask(Heap *heap, TriggerGCType type) : Task(TaskPriority::LOW), heap_(heap), gcType_(type)
         {
             lastRegionOfToSpace_ = heap->GetNewSpace()->GetCurrentRegion();
         }
@@ -434,6 +505,15 @@ private:
     // Concurrent marker which coordinates actions of GC markers and mutators.
     ConcurrentMarker *concurrentMarker_ {nullptr};
 
+    // Incremental marker which interleaves the marking with the allocations of the js thread.
+    IncrementalMarker *incrementalMarker_ {nullptr};
+
+    // Pretenuring decisions of the allocation sites from the survival of their young objects.
+    AllocationSiteTracker *allocationSiteTracker_ {nullptr};
+
+    // Trace events of the gc phases and tasks, recorded only while started.
+    GCTracer *gcTracer_ {nullptr};
+
     // Concurrent sweeper which coordinates actions of sweepers (in spaces excluding young semi spaces) and mutators.
     ConcurrentSweeper *sweeper_ {nullptr};
 
@@ -456,6 +536,7 @@ private:
 
     bool parallelGC_ {true};
     bool concurrentMarkingEnabled_ {true};
+    bool incrementalMarkingEnabled_ {false};
     bool fullGCRequested_ {false};
 
     size_t globalSpaceAllocLimit_ {GLOBAL_SPACE_LIMIT_BEGIN};
@@ -476,6 +557,9 @@ private:
      */
     MemController *memController_ {nullptr};
 
+    // The scheduler of the gc work done in the idle time reported by the embedder.
+    IdleGCScheduler *idleGCScheduler_ {nullptr};
+
     // Region allocators.
     NativeAreaAllocator *nativeAreaAllocator_ {nullptr};
     HeapRegionAllocator *heapRegionAllocator_ {nullptr};
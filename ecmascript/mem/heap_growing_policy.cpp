@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/mem/heap_growing_policy.h"
+
+#include <algorithm>
+
+#include "libpandabase/utils/logger.h"
+
+namespace panda::ecmascript {
+HeapGrowingPolicy::HeapGrowingPolicy(double gcCpuRatio, double minFactor, double maxFactor)
+    : gcCpuRatio_(gcCpuRatio), minFactor_(minFactor), maxFactor_(maxFactor)
+{
+    if (gcCpuRatio_ <= 0 || gcCpuRatio_ >= 1) {
+        LOG(ERROR, RUNTIME) << "gc cpu ratio " << gcCpuRatio_ << " is not within (0, 1), use "
+                            << DEFAULT_GC_CPU_RATIO;
+        gcCpuRatio_ = DEFAULT_GC_CPU_RATIO;
+    }
+    // a factor below 1 would set the limit below the live size and trigger an old gc at once
+    minFactor_ = std::max(minFactor_, 1.0);
+    maxFactor_ = std::max(maxFactor_, minFactor_);
+}
+
+double HeapGrowingPolicy::CalculateGrowingFactor(double gcSpeed, double mutatorSpeed) const
+{
+    if (gcSpeed == 0 || mutatorSpeed == 0) {
+        return maxFactor_;
+    }
+    double factor = CalculateFactor(gcSpeed / mutatorSpeed);
+    return std::clamp(factor, minFactor_, maxFactor_);
+}
+
+double ThroughputGrowingPolicy::CalculateFactor(double speedRatio) const
+{
+    const double targetMutatorUtilization = 1 - GetGCCpuRatio();
+    const double a = speedRatio * (1 - targetMutatorUtilization);
+    const double b = speedRatio * (1 - targetMutatorUtilization) - targetMutatorUtilization;
+    // b <= 0: the gc is too slow to reach the utilization at any factor
+    return (a < b * GetMaxFactor()) ? a / b : GetMaxFactor();
+}
+
+double MemoryGrowingPolicy::CalculateFactor(double speedRatio) const
+{
+    const double ratio = GetGCCpuRatio();
+    return 1 + (1 - ratio) / (ratio * speedRatio);
+}
+
+HeapGrowingPolicy *CreateHeapGrowingPolicy(std::string_view type, double gcCpuRatio, double minFactor,
+                                           double maxFactor)
+{
+    if (type == "memory") {
+        return new MemoryGrowingPolicy(gcCpuRatio, minFactor, maxFactor);
+    }
+    if (type != "throughput") {
+        LOG(ERROR, RUNTIME) << "unknown heap growing policy " << type << ", use throughput";
+    }
+    return new ThroughputGrowingPolicy(gcCpuRatio, minFactor, maxFactor);
+}
+}  // namespace panda::ecmascript
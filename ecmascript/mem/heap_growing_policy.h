@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_MEM_HEAP_GROWING_POLICY_H
+#define ECMASCRIPT_MEM_HEAP_GROWING_POLICY_H
+
+#include <string_view>
+
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript {
+// HeapGrowingPolicy decides how far the old space and global limits grow over the live size after an old gc, from
+// the mark compact speed and the old space allocation speed of the mutator, both averaged over the last gcs by the
+// gc ring buffers of the MemController.
+// Marking a heap of L bytes takes L / gcSpeed ms, and the mutator fills the (factor - 1) * L bytes up to the next
+// limit in (factor - 1) * L / mutatorSpeed ms, so the factor sets the share of the cpu time spent in the gc. Every
+// policy aims at gcCpuRatio this way and keeps the factor within [minFactor, maxFactor]; it grows the heap to the
+// max factor until both speeds were measured.
+class HeapGrowingPolicy {
+public:
+    static constexpr double DEFAULT_GC_CPU_RATIO = 0.03;
+    static constexpr double DEFAULT_MIN_GROWING_FACTOR = 1.3;
+    static constexpr double DEFAULT_MAX_GROWING_FACTOR = 4.0;
+
+    HeapGrowingPolicy(double gcCpuRatio, double minFactor, double maxFactor);
+    virtual ~HeapGrowingPolicy() = default;
+    NO_COPY_SEMANTIC(HeapGrowingPolicy);
+    NO_MOVE_SEMANTIC(HeapGrowingPolicy);
+
+    double CalculateGrowingFactor(double gcSpeed, double mutatorSpeed) const;
+
+    double GetGCCpuRatio() const
+    {
+        return gcCpuRatio_;
+    }
+
+    double GetMinFactor() const
+    {
+        return minFactor_;
+    }
+
+    double GetMaxFactor() const
+    {
+        return maxFactor_;
+    }
+
+protected:
+    // speedRatio is gcSpeed / mutatorSpeed, both measured, the result is clamped by the caller
+    virtual double CalculateFactor(double speedRatio) const = 0;
+
+private:
+    double gcCpuRatio_;
+    double minFactor_;
+    double maxFactor_;
+};
+
+// Prefers throughput: the factor for which the mutator utilization, i.e. the share of the cpu time left to the
+// mutator, is 1 - gcCpuRatio, once the allocations during the concurrent mark are accounted as well. It leaves the
+// gc below the ratio by growing to the max factor as soon as the gc is only a little faster than the mutator.
+class ThroughputGrowingPolicy : public HeapGrowingPolicy {
+public:
+    using HeapGrowingPolicy::HeapGrowingPolicy;
+    ~ThroughputGrowingPolicy() override = default;
+    NO_COPY_SEMANTIC(ThroughputGrowingPolicy);
+    NO_MOVE_SEMANTIC(ThroughputGrowingPolicy);
+
+protected:
+    double CalculateFactor(double speedRatio) const override;
+};
+
+// Prefers memory: the smallest factor for which the gc spends no more than gcCpuRatio of the cpu time, i.e.
+// 1 + (1 - gcCpuRatio) / (gcCpuRatio * speedRatio).
+class MemoryGrowingPolicy : public HeapGrowingPolicy {
+public:
+    using HeapGrowingPolicy::HeapGrowingPolicy;
+    ~MemoryGrowingPolicy() override = default;
+    NO_COPY_SEMANTIC(MemoryGrowingPolicy);
+    NO_MOVE_SEMANTIC(MemoryGrowingPolicy);
+
+protected:
+    double CalculateFactor(double speedRatio) const override;
+};
+
+// type is "throughput" or "memory", an unknown type falls back to "throughput"
+HeapGrowingPolicy *CreateHeapGrowingPolicy(std::string_view type, double gcCpuRatio, double minFactor,
+                                           double maxFactor);
+}  // namespace panda::ecmascript
+
+#endif  // ECMASCRIPT_MEM_HEAP_GROWING_POLICY_H
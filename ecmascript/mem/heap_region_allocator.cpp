@@ -55,6 +55,7 @@ Region *HeapRegionAllocator::AllocateAlignedRegion(Space *space, size_t capacity
 
 void HeapRegionAllocator::FreeRegion(Region *region)
 {
+    RecommitRegion(region);
     auto size = region->GetCapacity();
     DecreaseAnnoMemoryUsage(size);
 #if ECMASCRIPT_ENABLE_ZAP_MEM
@@ -66,4 +67,18 @@ void HeapRegionAllocator::FreeRegion(Region *region)
     bool isRegular = region->InHugeObjectGeneration() ? false : true;
     MemMapAllocator::GetInstance()->Free(ToVoidPtr(region->GetAllocateBase()), size, isRegular);
 }
+
+void HeapRegionAllocator::RecommitRegion(Region *region)
+{
+    size_t size = region->GetDecommittedSize();
+    if (size != 0) {
+        decommittedMemorySize_.fetch_sub(size, std::memory_order_relaxed);
+        region->SetDecommittedSize(0);
+    }
+}
+
+size_t HeapRegionAllocator::GetResidentMemoryUsage() const
+{
+    return GetAnnoMemoryUsage() - GetDecommittedMemorySize() + MemMapAllocator::GetInstance()->GetResidentCacheSize();
+}
 }  // namespace panda::ecmascript
@@ -56,6 +56,24 @@ public:
         return maxAnnoMemoryUsage_.load(std::memory_order_relaxed);
     }
 
+    // Free pages of committed regions returned to the os.
+    void IncreaseDecommittedMemorySize(size_t bytes)
+    {
+        decommittedMemorySize_.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    size_t GetDecommittedMemorySize() const
+    {
+        return decommittedMemorySize_.load(std::memory_order_relaxed);
+    }
+
+    // The pages of the region are in use again, e.g. because the region is being swept.
+    void RecommitRegion(Region *region);
+
+    // The committed size minus the decommitted pages, plus the freed regions the process wide MemMapAllocator keeps
+    // resident for reuse.
+    size_t GetResidentMemoryUsage() const;
+
 private:
     NO_COPY_SEMANTIC(HeapRegionAllocator);
     NO_MOVE_SEMANTIC(HeapRegionAllocator);
@@ -65,6 +83,7 @@ private:
 #endif
     std::atomic<size_t> annoMemoryUsage_ {0};
     std::atomic<size_t> maxAnnoMemoryUsage_ {0};
+    std::atomic<size_t> decommittedMemorySize_ {0};
 };
 }  // namespace panda::ecmascript
 
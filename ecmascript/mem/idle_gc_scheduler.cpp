@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/mem/idle_gc_scheduler.h"
+
+#include "ecmascript/ecma_macros.h"
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/js_thread.h"
+#include "ecmascript/mem/clock_scope.h"
+#include "ecmascript/mem/concurrent_marker.h"
+#include "ecmascript/mem/concurrent_sweeper.h"
+#include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/mem/heap.h"
+#include "ecmascript/mem/incremental_marker.h"
+#include "ecmascript/mem/mem_controller.h"
+
+namespace panda::ecmascript {
+void IdleGCScheduler::NotifyIdle(double idleMs)
+{
+    if (idleMs <= 0) {
+        return;
+    }
+    ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "IdleGCScheduler::NotifyIdle");
+    ClockScope clockScope;
+    double deadlineMs = MemController::GetSystemTimeInMs() + idleMs;
+    GCStats *stats = heap_->GetEcmaVM()->GetEcmaGCStats();
+    ConcurrentSweeper *sweeper = heap_->GetSweeper();
+    // Every gc starts with finishing the sweeping of the last one, so nothing else fits until it is done.
+    if (sweeper->IsSweeping()) {
+        stats->StatisticIdleSweep(sweeper->SweepUntil(deadlineMs));
+    }
+    if (!sweeper->IsSweeping()) {
+        TryIncrementalMark(deadlineMs);
+        if (!TryFinishConcurrentMark(deadlineMs)) {
+            TryYoungGC(deadlineMs);
+        }
+        TryStartConcurrentMark(deadlineMs);
+    }
+    if (!sweeper->IsSweeping() && MemController::GetSystemTimeInMs() < deadlineMs) {
+        heap_->DecommitFreeMemory();
+    }
+    auto idleTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double, std::milli>(idleMs));
+    stats->StatisticIdleNotification(idleTime, clockScope.GetPauseTime());
+}
+
+bool IdleGCScheduler::TryIncrementalMark(double deadlineMs)
+{
+    if (!heap_->IncrementalMarkingEnabled() || !heap_->GetJSThread()->IsMarking()) {
+        return false;
+    }
+    return heap_->GetIncrementalMarker()->MarkUntil(deadlineMs);
+}
+
+bool IdleGCScheduler::TryFinishConcurrentMark(double deadlineMs)
+{
+    if (!heap_->GetJSThread()->IsMarkFinished()) {
+        return false;
+    }
+    MemController *memController = heap_->GetMemController();
+    bool finished = false;
+    if (heap_->IsFullMark()) {
+        finished = CanFinishBefore(heap_->GetHeapObjectSize(), memController->CalculateMarkCompactSpeedPerMS(),
+                                   deadlineMs);
+    } else {
+        finished = CanFinishBefore(heap_->GetNewSpace()->GetHeapObjectSize(), memController->GetSemiGCSpeedPerMS(),
+                                   deadlineMs);
+    }
+    if (finished) {
+        heap_->GetConcurrentMarker()->HandleMarkingFinished();
+        heap_->GetEcmaVM()->GetEcmaGCStats()->StatisticIdleConcurrentMark(false);
+    }
+    return finished;
+}
+
+bool IdleGCScheduler::TryYoungGC(double deadlineMs)
+{
+    // a young gc during concurrent marking would have to wait for the marker
+    if (!heap_->GetJSThread()->IsReadyToMark()) {
+        return false;
+    }
+    SemiSpace *newSpace = heap_->GetNewSpace();
+    size_t newSpaceSize = newSpace->GetHeapObjectSize();
+    if (newSpaceSize <= newSpace->GetMaximumCapacity() / 2) {  // 2: only collect a young space more than half full
+        return false;
+    }
+    if (!CanFinishBefore(newSpaceSize, heap_->GetMemController()->GetSemiGCSpeedPerMS(), deadlineMs)) {
+        return false;
+    }
+    heap_->CollectGarbage(TriggerGCType::YOUNG_GC);
+    heap_->GetEcmaVM()->GetEcmaGCStats()->StatisticIdleYoungGC();
+    return true;
+}
+
+bool IdleGCScheduler::TryStartConcurrentMark(double deadlineMs)
+{
+    JSThread *thread = heap_->GetJSThread();
+    // marking starts with waiting for the sweeper tasks
+    bool incremental = heap_->IncrementalMarkingEnabled();
+    if ((!heap_->ConcurrentMarkingEnabled() && !incremental) || !thread->IsReadyToMark() ||
+        heap_->GetSweeper()->IsSweeping()) {
+        return false;
+    }
+    if (MemController::GetSystemTimeInMs() + START_CONCURRENT_MARK_TIME_MS > deadlineMs) {
+        return false;
+    }
+    if (incremental) {
+        heap_->TryTriggerIncrementalMarking();
+    } else {
+        heap_->TryTriggerConcurrentMarking();
+    }
+    if (thread->IsReadyToMark()) {
+        return false;
+    }
+    heap_->GetEcmaVM()->GetEcmaGCStats()->StatisticIdleConcurrentMark(true);
+    return true;
+}
+
+bool IdleGCScheduler::CanFinishBefore(size_t size, double speedPerMS, double deadlineMs)
+{
+    if (speedPerMS <= 0) {
+        return false;
+    }
+    return MemController::GetSystemTimeInMs() + size / speedPerMS <= deadlineMs;
+}
+}  // namespace panda::ecmascript
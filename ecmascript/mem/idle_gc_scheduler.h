@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_MEM_IDLE_GC_SCHEDULER_H
+#define ECMASCRIPT_MEM_IDLE_GC_SCHEDULER_H
+
+#include <cstddef>
+
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript {
+class Heap;
+
+// IdleGCScheduler spends the idle time reported by the embedder on the gc work which would otherwise pause the
+// js thread in the middle of its next task, most urgent first:
+//     help the sweeper tasks, one region at a time
+//     take the steps of an incremental mark until the deadline
+//     finish a concurrent or incremental mark whose marking is done, i.e. run the remark and evacuation of its
+//     partial gc
+//     young gc once the young space is more than half full
+//     start the concurrent or incremental mark the allocation heuristics would start soon anyway
+//     return the free memory unused for the region decommit age to the os
+// A gc only runs if its pause predicted from the recorded gc speeds ends before the deadline, so nothing but
+// sweeping happens until a gc of the same kind was measured.
+class IdleGCScheduler {
+public:
+    explicit IdleGCScheduler(Heap *heap) : heap_(heap) {}
+    ~IdleGCScheduler() = default;
+    NO_COPY_SEMANTIC(IdleGCScheduler);
+    NO_MOVE_SEMANTIC(IdleGCScheduler);
+
+    // the js thread is idle for the next idleMs milliseconds
+    void NotifyIdle(double idleMs);
+
+private:
+    // root marking of the concurrent mark is not measured, it is expected to fit into this
+    static constexpr double START_CONCURRENT_MARK_TIME_MS = 2.0;
+
+    bool TryIncrementalMark(double deadlineMs);
+    bool TryFinishConcurrentMark(double deadlineMs);
+    bool TryYoungGC(double deadlineMs);
+    bool TryStartConcurrentMark(double deadlineMs);
+    static bool CanFinishBefore(size_t size, double speedPerMS, double deadlineMs);
+
+    Heap *heap_ {nullptr};
+};
+}  // namespace panda::ecmascript
+
+#endif  // ECMASCRIPT_MEM_IDLE_GC_SCHEDULER_H
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/mem/incremental_marker.h"
+
+#include <algorithm>
+
+#include "ecmascript/ecma_macros.h"
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/mem/clock_scope.h"
+#include "ecmascript/mem/concurrent_marker.h"
+#include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/mem/gc_tracer.h"
+#include "ecmascript/mem/heap-inl.h"
+#include "ecmascript/mem/mem.h"
+#include "ecmascript/mem/mem_controller.h"
+#include "ecmascript/mem/parallel_marker-inl.h"
+#include "ecmascript/runtime_call_id.h"
+
+namespace panda::ecmascript {
+void IncrementalMarker::Mark()
+{
+    ECMA_GC_LOG() << "IncrementalMarker: Incremental Marking Begin";
+    ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "IncrementalMarker::Mark");
+    EcmaVM *vm = heap_->GetEcmaVM();
+    MEM_ALLOCATE_AND_GC_TRACE(vm, IncrementalMarking);
+    ClockScope scope;
+    heap_->GetConcurrentMarker()->InitializeMarking();
+    // A young gc during the marking has to finish it in one pause, so the steps aim to be done before it.
+    SemiSpace *newSpace = heap_->GetNewSpace();
+    size_t newSpaceRemainSize = 0;
+    if (newSpace->GetMaximumCapacity() > newSpace->GetCommittedSize()) {
+        newSpaceRemainSize = newSpace->GetMaximumCapacity() - newSpace->GetCommittedSize();
+    }
+    markRate_ = std::max(MIN_MARK_RATE, static_cast<double>(heap_->GetHeapObjectSize()) /
+                                        std::max(newSpaceRemainSize, DEFAULT_REGION_SIZE));
+    lastStepTime_ = MemController::GetSystemTimeInMs();
+    markingDuration_ = scope.TotalSpentTime();
+    stepsDuration_ = 0.0;
+    stepsMarkedSize_ = 0;
+    vm->GetEcmaGCStats()->StatisticConcurrentMark(scope.GetPauseTime());
+}
+
+void IncrementalMarker::Step()
+{
+    double currentTimeMs = MemController::GetSystemTimeInMs();
+    size_t stepSize = CalculateStepSize(currentTimeMs);
+    lastStepTime_ = currentTimeMs;
+    MarkStep(stepSize);
+}
+
+bool IncrementalMarker::MarkUntil(double deadlineMs)
+{
+    bool finished = false;
+    while (!finished && MemController::GetSystemTimeInMs() < deadlineMs) {
+        finished = MarkStep(MIN_STEP_SIZE);
+    }
+    // nothing was allocated while idle
+    lastStepTime_ = MemController::GetSystemTimeInMs();
+    return finished;
+}
+
+void IncrementalMarker::FinishMarking()
+{
+    ClockScope clockScope;
+    heap_->GetNonMovableMarker()->ProcessMarkStack(MAIN_THREAD_INDEX);
+    markingDuration_ += clockScope.TotalSpentTime();
+    heap_->GetConcurrentMarker()->FinishMarking(markingDuration_);
+}
+
+size_t IncrementalMarker::CalculateStepSize(double currentTimeMs) const
+{
+    MemController *memController = heap_->GetMemController();
+    double allocationSpeed = memController->GetNewSpaceAllocationThroughputPerMS() +
+                             memController->GetOldSpaceAllocationThroughputPerMS();
+    // Before the first gc nothing is known but that a step runs each time the young space takes a new region.
+    double allocatedSize = DEFAULT_REGION_SIZE;
+    if (allocationSpeed > 0) {
+        allocatedSize = allocationSpeed * (currentTimeMs - lastStepTime_);
+    }
+    auto stepSize = std::max(static_cast<size_t>(allocatedSize * markRate_), MIN_STEP_SIZE);
+
+    double markSpeed = memController->GetFullSpaceConcurrentMarkSpeedPerMS();
+    if (stepsDuration_ > 0) {
+        markSpeed = stepsMarkedSize_ / stepsDuration_;
+    }
+    // The first step of the first marking measures the marking speed.
+    if (markSpeed <= 0) {
+        return MIN_STEP_SIZE;
+    }
+    auto maxStepSize = std::max(static_cast<size_t>(markSpeed * MAX_STEP_TIME_MS), MIN_STEP_SIZE);
+    return std::min(stepSize, maxStepSize);
+}
+
+bool IncrementalMarker::MarkStep(size_t stepSize)
+{
+    ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "IncrementalMarker::MarkStep");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "IncrementalMarker::MarkStep");
+    EcmaVM *vm = heap_->GetEcmaVM();
+    MEM_ALLOCATE_AND_GC_TRACE(vm, IncrementalMarkingStep);
+    ClockScope clockScope;
+    size_t markedSize = 0;
+    bool finished = heap_->GetNonMovableMarker()->ProcessMarkStackStep(MAIN_THREAD_INDEX, stepSize, markedSize);
+    float spendTime = clockScope.TotalSpentTime();
+    markingDuration_ += spendTime;
+    stepsDuration_ += spendTime;
+    stepsMarkedSize_ += markedSize;
+    traceScope.SetBytes(markedSize);
+    vm->GetEcmaGCStats()->StatisticIncrementalMarkStep(clockScope.GetPauseTime());
+    if (finished) {
+        // The partial gc runs at the next safepoint, as after a concurrent marking.
+        heap_->GetConcurrentMarker()->FinishMarking(markingDuration_);
+    }
+    return finished;
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_MEM_INCREMENTAL_MARKER_H
+#define ECMASCRIPT_MEM_INCREMENTAL_MARKER_H
+
+#include <cstddef>
+
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript {
+class Heap;
+
+// IncrementalMarker runs the full mark in the js thread when there is no spare core for the concurrent marker.
+// The marking is started and finished like a concurrent one, the write barrier keeps recording the objects stored
+// while marking, but its mark stack is drained in bounded steps on the allocation slow paths. Each step marks the
+// bytes allocated since the last one, estimated from the allocation throughput, times the rate which finishes the
+// marking before the young space is full, and never more than the measured marking speed allows in MAX_STEP_TIME_MS.
+// What the steps did not reach is marked by the partial gc finishing the marking.
+class IncrementalMarker {
+public:
+    explicit IncrementalMarker(Heap *heap) : heap_(heap) {}
+    ~IncrementalMarker() = default;
+    NO_COPY_SEMANTIC(IncrementalMarker);
+    NO_MOVE_SEMANTIC(IncrementalMarker);
+
+    void Mark();
+    // call in the allocation slow path of the js thread while marking
+    void Step();
+    // mark until the deadline, return whether the marking is finished
+    bool MarkUntil(double deadlineMs);
+    // mark the objects the steps did not reach, call in the gc
+    void FinishMarking();
+
+private:
+    // the old generation pause a step is allowed to add
+    static constexpr double MAX_STEP_TIME_MS = 2.0;
+    static constexpr size_t MIN_STEP_SIZE = 64 * 1024;
+    static constexpr double MIN_MARK_RATE = 1.0;
+
+    size_t CalculateStepSize(double currentTimeMs) const;
+    bool MarkStep(size_t stepSize);
+
+    Heap *heap_ {nullptr};
+    // bytes to mark for each byte allocated
+    double markRate_ {MIN_MARK_RATE};
+    double lastStepTime_ {0.0};
+    // the time of the marking in the js thread, root marking included
+    double markingDuration_ {0.0};
+    double stepsDuration_ {0.0};
+    size_t stepsMarkedSize_ {0};
+};
+}  // namespace panda::ecmascript
+
+#endif  // ECMASCRIPT_MEM_INCREMENTAL_MARKER_H
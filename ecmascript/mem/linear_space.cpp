@@ -35,6 +35,7 @@ uintptr_t LinearSpace::Allocate(size_t size, bool isPromoted)
     if (Expand(isPromoted)) {
         if (!isPromoted) {
             heap_->TryTriggerConcurrentMarking();
+            heap_->TryTriggerIncrementalMarking();
         }
         object = allocator_->Allocate(size);
     } else if (heap_->GetJSThread()->IsMarking()) {
@@ -38,6 +38,8 @@ enum class MemAlignmentLog2 : uint8_t {
 
 static constexpr size_t SEMI_SPACE_TRIGGER_CONCURRENT_MARK = 1.5 * 1024 * 1024;
 static constexpr size_t SEMI_SPACE_OVERSHOOT_SIZE = 2 * 1024 * 1024;
+// incremental marking starts when old space or global space reaches this rate of its limit
+static constexpr double INCREMENTAL_MARK_START_RATE = 0.8;
 
 static constexpr size_t MIN_OLD_SPACE_LIMIT = 2 * 1024 * 1024;
 static constexpr size_t OLD_SPACE_LIMIT_BEGIN = 256 * 1024 * 1024;
@@ -15,12 +15,26 @@
 
 #include "ecmascript/mem/mem_controller.h"
 
+#include "ecmascript/ecma_vm.h"
 #include "ecmascript/mem/concurrent_marker.h"
 #include "ecmascript/mem/heap-inl.h"
 #include "ecmascript/mem/parallel_evacuator.h"
 
 namespace panda::ecmascript {
-MemController::MemController(Heap *heap) : heap_(heap), allocTimeMs_(GetSystemTimeInMs()) {}
+MemController::MemController(Heap *heap) : heap_(heap), allocTimeMs_(GetSystemTimeInMs())
+{
+    const JSRuntimeOptions &options = heap->GetEcmaVM()->GetJSOptions();
+    growingPolicy_ = CreateHeapGrowingPolicy(options.GetHeapGrowingPolicy(), options.GetGCCpuRatio(),
+                                             options.GetMinHeapGrowingFactor(), options.GetMaxHeapGrowingFactor());
+}
+
+MemController::~MemController()
+{
+    if (growingPolicy_ != nullptr) {
+        delete growingPolicy_;
+        growingPolicy_ = nullptr;
+    }
+}
 
 double MemController::CalculateAllocLimit(size_t currentSize, size_t minSize, size_t maxSize, size_t newSpaceCapacity,
                                           double factor) const
@@ -39,21 +53,7 @@ double MemController::CalculateAllocLimit(size_t currentSize, size_t minSize, si
 
 double MemController::CalculateGrowingFactor(double gcSpeed, double mutatorSpeed)
 {
-    static constexpr double minGrowingFactor = 1.3;
-    static constexpr double maxGrowingFactor = 4.0;
-    static constexpr double targetMutatorUtilization = 0.97;
-    if (gcSpeed == 0 || mutatorSpeed == 0) {
-        return maxGrowingFactor;
-    }
-
-    const double speedRatio = gcSpeed / mutatorSpeed;
-
-    const double a = speedRatio * (1 - targetMutatorUtilization);
-    const double b = speedRatio * (1 - targetMutatorUtilization) -  targetMutatorUtilization;
-
-    double factor = (a < b * maxGrowingFactor) ? a / b : maxGrowingFactor;
-    factor = std::min(maxGrowingFactor, factor);
-    factor = std::max(factor, minGrowingFactor);
+    double factor = growingPolicy_->CalculateGrowingFactor(gcSpeed, mutatorSpeed);
     OPTIONAL_LOG(heap_->GetEcmaVM(), ERROR, ECMASCRIPT) << "CalculateGrowingFactor gcSpeed"
         << gcSpeed << " mutatorSpeed" << mutatorSpeed << " factor" << factor;
     return factor;
@@ -69,6 +69,7 @@ void MemController::StartCalculationBeforeGC()
     // It's unnecessary to calculate newSpaceAllocAccumulatedSize. newSpaceAllocBytesSinceGC can be calculated directly.
     auto newSpace = heap_->GetNewSpace();
     size_t newSpaceAllocBytesSinceGC = newSpace->GetAllocatedSizeSinceGC(newSpace->GetTop());
+    newSpaceHeapObjectSizeBeforeGC_ = newSpace->GetHeapObjectSize();
     size_t hugeObjectAllocSizeSinceGC = heap_->GetHugeObjectSpace()->GetHeapObjectSize() - hugeObjectAllocSizeSinceGC_;
     size_t oldSpaceAllocAccumulatedSize = heap_->GetOldSpace()->GetTotalAllocatedSize();
     size_t nonMovableSpaceAllocAccumulatedSize = heap_->GetNonMovableSpace()->GetTotalAllocatedSize();
@@ -123,10 +124,12 @@ void MemController::StopCalculationAfterGC(TriggerGCType gcType)
         case TriggerGCType::YOUNG_GC:
         case TriggerGCType::OLD_GC: {
             if (heap_->IsFullMark()) {
-                if (heap_->ConcurrentMarkingEnabled()) {
+                if (heap_->ConcurrentMarkingEnabled() || heap_->IncrementalMarkingEnabled()) {
                     duration += heap_->GetConcurrentMarker()->GetDuration();
                 }
                 recordedMarkCompacts_.Push(MakeBytesAndDuration(heap_->GetHeapObjectSize(), duration));
+            } else {
+                recordedSemiGCs_.Push(MakeBytesAndDuration(newSpaceHeapObjectSizeBeforeGC_, duration));
             }
             break;
         }
@@ -149,6 +152,11 @@ void MemController::RecordAfterConcurrentMark(const bool isFull, const Concurren
     }
 }
 
+void MemController::RecordAfterEvacuation(size_t evacuatedSize, double duration)
+{
+    recordedEvacuations_.Push(MakeBytesAndDuration(evacuatedSize, duration));
+}
+
 double MemController::CalculateMarkCompactSpeedPerMS()
 {
     markCompactSpeedCache_ = CalculateAverageSpeed(recordedMarkCompacts_);
@@ -209,6 +217,16 @@ double MemController::GetNewSpaceConcurrentMarkSpeedPerMS() const
     return CalculateAverageSpeed(recordedSemiConcurrentMarks_);
 }
 
+double MemController::GetSemiGCSpeedPerMS() const
+{
+    return CalculateAverageSpeed(recordedSemiGCs_);
+}
+
+double MemController::GetEvacuationSpeedPerMS() const
+{
+    return CalculateAverageSpeed(recordedEvacuations_);
+}
+
 double MemController::GetOldSpaceAllocationThroughputPerMS() const
 {
     return CalculateAverageSpeed(recordedOldSpaceAllocations_);
@@ -20,6 +20,7 @@
 
 #include "ecmascript/base/gc_ring_buffer.h"
 #include "ecmascript/mem/heap.h"
+#include "ecmascript/mem/heap_growing_policy.h"
 #include "ecmascript/mem/mem.h"
 
 namespace panda::ecmascript {
@@ -36,7 +37,7 @@ class MemController {
 public:
     explicit MemController(Heap* heap);
     MemController() = default;
-    ~MemController() = default;
+    ~MemController();
     NO_COPY_SEMANTIC(MemController);
     NO_MOVE_SEMANTIC(MemController);
 
@@ -52,10 +53,16 @@ public:
 
     double CalculateGrowingFactor(double gcSpeed, double mutatorSpeed);
 
+    const HeapGrowingPolicy *GetGrowingPolicy() const
+    {
+        return growingPolicy_;
+    }
+
     void StartCalculationBeforeGC();
     void StopCalculationAfterGC(TriggerGCType gcType);
 
     void RecordAfterConcurrentMark(const bool isFull, const ConcurrentMarker *marker);
+    void RecordAfterEvacuation(size_t evacuatedSize, double duration);
 
     double CalculateMarkCompactSpeedPerMS();
     double GetCurrentOldSpaceAllocationThroughputPerMS(double timeMs = THROUGHPUT_TIME_FRAME_MS) const;
@@ -63,12 +70,21 @@ public:
     double GetOldSpaceAllocationThroughputPerMS() const;
     double GetNewSpaceConcurrentMarkSpeedPerMS() const;
     double GetFullSpaceConcurrentMarkSpeedPerMS() const;
+    // young space bytes collected per ms of young gc pause, 0 until a young gc was measured
+    double GetSemiGCSpeedPerMS() const;
+    // bytes copied per ms of evacuation pause, reference updating included, 0 until an evacuation was measured
+    double GetEvacuationSpeedPerMS() const;
 
     double GetAllocTimeMs() const
     {
         return allocTimeMs_;
     }
 
+    double GetGCEndTime() const
+    {
+        return gcEndTime_;
+    }
+
     size_t GetOldSpaceAllocAccumulatedSize() const
     {
         return oldSpaceAllocAccumulatedSize_;
@@ -135,6 +151,7 @@ private:
                                         const BytesAndDuration &initial, const double timeMs);
 
     Heap* heap_;
+    HeapGrowingPolicy *growingPolicy_ {nullptr};
 
     double gcStartTime_ {0.0};
     double gcEndTime_ {0.0};
@@ -152,11 +169,13 @@ private:
     size_t nonMovableSpaceAllocSizeSinceGC_ {0};
     size_t codeSpaceAllocSizeSinceGC_ {0};
     size_t hugeObjectAllocSizeSinceGC_{0};
+    size_t newSpaceHeapObjectSizeBeforeGC_ {0};
 
     int startCounter_ {0};
     double markCompactSpeedCache_ {0.0};
 
     base::GCRingBuffer<BytesAndDuration, LENGTH> recordedMarkCompacts_;
+    base::GCRingBuffer<BytesAndDuration, LENGTH> recordedSemiGCs_;
     base::GCRingBuffer<BytesAndDuration, LENGTH> recordedNewSpaceAllocations_;
     base::GCRingBuffer<BytesAndDuration, LENGTH> recordedOldSpaceAllocations_;
     base::GCRingBuffer<BytesAndDuration, LENGTH> recordedNonmovableSpaceAllocations_;
@@ -164,6 +183,7 @@ private:
 
     base::GCRingBuffer<BytesAndDuration, LENGTH> recordedConcurrentMarks_;
     base::GCRingBuffer<BytesAndDuration, LENGTH> recordedSemiConcurrentMarks_;
+    base::GCRingBuffer<BytesAndDuration, LENGTH> recordedEvacuations_;
     base::GCRingBuffer<double, LENGTH> recordedSurvivalRates_;
 
     static constexpr double THROUGHPUT_TIME_FRAME_MS = 5000;
@@ -14,6 +14,11 @@
  */
 
 #include "ecmascript/mem/mem_map_allocator.h"
+
+#ifdef PANDA_TARGET_UNIX
+#include <unistd.h>
+#endif
+
 #ifdef PANDA_TARGET_WINDOWS
 #include <windows.h>
 
@@ -42,7 +47,7 @@ void *mmap(size_t size, int fd, off_t offset)
 #endif
 
 namespace panda::ecmascript {
-MemMap MemMapAllocator::Allocate(size_t size, size_t alignment, bool isRegular)
+MemMap MemMapAllocator::Allocate(size_t size, [[maybe_unused]] size_t alignment, bool isRegular)
 {
     if (UNLIKELY(memMapTotalSize_ + size > capacity_)) {
         LOG(ERROR, RUNTIME) << "memory map overflow";
@@ -56,7 +61,15 @@ MemMap MemMapAllocator::Allocate(size_t size, size_t alignment, bool isRegular)
             PageTag(mem.GetMem(), size);
             return mem;
         }
+#ifdef ECMASCRIPT_ENABLE_POINTER_COMPRESSION
+        mem = CageMap();
+        if (mem.GetMem() == nullptr) {
+            LOG(ERROR, RUNTIME) << "heap cage overflow";
+            return mem;
+        }
+#else
         mem = PageMap(REGULAR_REGION_MMAP_SIZE, alignment);
+#endif
         mem = memMapPool_.SplitMemToCache(mem);
     } else {
         mem = memMapFreeList_.GetMemFromList(size);
@@ -71,14 +84,50 @@ MemMap MemMapAllocator::Allocate(size_t size, size_t alignment, bool isRegular)
 void MemMapAllocator::Free(void *mem, size_t size, bool isRegular)
 {
     memMapTotalSize_ -= size;
-    PageRelease(mem, size);
     if (isRegular) {
-        memMapPool_.AddMemToCache(mem, size);
+        if (keepFreedMemResident_) {
+            memMapPool_.AddMemToCache(mem, size, true);
+        } else {
+            PageRelease(mem, size);
+            memMapPool_.AddMemToCache(mem, size);
+        }
     } else {
+        PageRelease(mem, size);
         memMapFreeList_.AddMemToList(MemMap(mem, size));
     }
 }
 
+size_t MemMapAllocator::ReleaseIdleMem(double ageMs)
+{
+    size_t releasedSize = 0;
+    MemMap mem = memMapPool_.GetIdleResidentMem(ageMs);
+    while (mem.GetMem() != nullptr) {
+        PageRelease(mem.GetMem(), mem.GetSize());
+        memMapPool_.AddMemToCache(mem.GetMem(), mem.GetSize());
+        releasedSize += mem.GetSize();
+        mem = memMapPool_.GetIdleResidentMem(ageMs);
+    }
+    return releasedSize;
+}
+
+size_t MemMapAllocator::DecommitRange([[maybe_unused]] uintptr_t begin, [[maybe_unused]] uintptr_t end)
+{
+#ifdef PANDA_TARGET_UNIX
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t pageBegin = AlignUp(begin, pageSize);
+    uintptr_t pageEnd = AlignDown(end, pageSize);
+    if (pageBegin >= pageEnd) {
+        return 0;
+    }
+    if (madvise(reinterpret_cast<void *>(pageBegin), pageEnd - pageBegin, MADV_DONTNEED) != 0) {
+        return 0;
+    }
+    return pageEnd - pageBegin;
+#else
+    return 0;
+#endif
+}
+
 MemMap MemMapAllocator::PageMap(size_t size, size_t alignment)
 {
     size_t allocSize = size + alignment;
@@ -98,4 +147,43 @@ MemMap MemMapAllocator::PageMap(size_t size, size_t alignment)
 #endif
     return MemMap(reinterpret_cast<void *>(alignResult), size);
 }
+
+#ifdef ECMASCRIPT_ENABLE_POINTER_COMPRESSION
+void MemMapAllocator::InitializeCage()
+{
+    if (capacity_ > HEAP_CAGE_SIZE - HEAP_START_ADDRESS - NON_REGULAR_MMAP_SIZE) {
+        capacity_ = HEAP_CAGE_SIZE - HEAP_START_ADDRESS - NON_REGULAR_MMAP_SIZE;
+    }
+    if (cageBase_ == 0) {
+#ifdef PANDA_TARGET_UNIX
+        // only the address space is reserved, the pages are committed by the first touch
+        size_t allocSize = HEAP_CAGE_SIZE * 2;  // 2: room to align the cage to its size
+        void *result = mmap(nullptr, allocSize, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        LOG_IF(result == MAP_FAILED, FATAL, ECMASCRIPT) << "reserve heap cage failed";
+        uintptr_t begin = reinterpret_cast<uintptr_t>(result);
+        uintptr_t alignBegin = AlignUp(begin, HEAP_CAGE_SIZE);
+        if (alignBegin != begin) {
+            munmap(result, alignBegin - begin);
+        }
+        munmap(reinterpret_cast<void *>(alignBegin + HEAP_CAGE_SIZE), begin + allocSize - alignBegin - HEAP_CAGE_SIZE);
+        cageBase_ = alignBegin;
+#else
+        LOG(FATAL, ECMASCRIPT) << "pointer compression is not supported on this platform";
+#endif
+    }
+    // the regions of a finalized vm are all freed, so the cage is reused from its start
+    cageTop_ = cageBase_ + HEAP_START_ADDRESS + NON_REGULAR_MMAP_SIZE;
+}
+
+MemMap MemMapAllocator::CageMap()
+{
+    uintptr_t mem = cageTop_.fetch_add(REGULAR_REGION_MMAP_SIZE, std::memory_order_relaxed);
+    if (mem + REGULAR_REGION_MMAP_SIZE > cageBase_ + HEAP_CAGE_SIZE) {
+        cageTop_.fetch_sub(REGULAR_REGION_MMAP_SIZE, std::memory_order_relaxed);
+        return MemMap();
+    }
+    return MemMap(reinterpret_cast<void *>(mem), REGULAR_REGION_MMAP_SIZE);
+}
+#endif
 }  // namespace panda::ecmascript
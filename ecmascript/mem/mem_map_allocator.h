@@ -16,6 +16,8 @@
 #ifndef ECMASCRIPT_MEM_MEM_MAP_ALLOCATOR_H
 #define ECMASCRIPT_MEM_MEM_MAP_ALLOCATOR_H
 
+#include <atomic>
+#include <chrono>
 #include <deque>
 #include <map>
 
@@ -54,6 +56,8 @@ private:
 };
 
 // Regular region with length of DEFAULT_REGION_SIZE(256kb)
+// Freed regions may stay resident in the cache, so that a region freed and allocated again by the next gc does not
+// take page faults; they are only returned to the os once they sat unused for a while, see ReleaseIdleMem.
 class MemMapPool {
 public:
     explicit MemMapPool() = default;
@@ -62,6 +66,8 @@ public:
     void Finalize()
     {
         memMapCache_.clear();
+        residentCache_.clear();
+        residentCacheSize_ = 0;
     }
 
     NO_COPY_SEMANTIC(MemMapPool);
@@ -71,6 +77,13 @@ public:
     {
         ASSERT(size == REGULAR_MMAP_SIZE);
         os::memory::LockHolder lock(lock_);
+        // the most recently freed region is the most likely to still be in the cpu caches
+        if (!residentCache_.empty()) {
+            MemMap mem = residentCache_.back().first;
+            residentCache_.pop_back();
+            residentCacheSize_ -= mem.GetSize();
+            return mem;
+        }
         if (!memMapCache_.empty()) {
             MemMap mem = memMapCache_.front();
             memMapCache_.pop_front();
@@ -79,11 +92,17 @@ public:
         return MemMap();
     }
 
-    void AddMemToCache(void *mem, size_t size)
+    // memory with resident pages is cached until it is released
+    void AddMemToCache(void *mem, size_t size, bool resident = false)
     {
         ASSERT(size == REGULAR_MMAP_SIZE);
         os::memory::LockHolder lock(lock_);
-        memMapCache_.emplace_back(mem, size);
+        if (resident) {
+            residentCache_.emplace_back(MemMap(mem, size), GetCurrentTimeInMs());
+            residentCacheSize_ += size;
+        } else {
+            memMapCache_.emplace_back(mem, size);
+        }
     }
 
     MemMap SplitMemToCache(MemMap memMap)
@@ -99,10 +118,36 @@ public:
         return MemMap(memMap.GetMem(), REGULAR_MMAP_SIZE);
     }
 
+    // Take the resident memory cached for at least ageMs, the oldest first. Returns an empty MemMap if there is none.
+    MemMap GetIdleResidentMem(double ageMs)
+    {
+        os::memory::LockHolder lock(lock_);
+        if (residentCache_.empty() || GetCurrentTimeInMs() - residentCache_.front().second < ageMs) {
+            return MemMap();
+        }
+        MemMap mem = residentCache_.front().first;
+        residentCache_.pop_front();
+        residentCacheSize_ -= mem.GetSize();
+        return mem;
+    }
+
+    size_t GetResidentCacheSize() const
+    {
+        return residentCacheSize_;
+    }
+
 private:
+    static double GetCurrentTimeInMs()
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
     static constexpr size_t REGULAR_MMAP_SIZE = 256_KB;
     os::memory::Mutex lock_;
     std::deque<MemMap> memMapCache_;
+    // freed memory whose pages were not released yet, with the time it was freed
+    std::deque<std::pair<MemMap, double>> residentCache_;
+    std::atomic_size_t residentCacheSize_ {0};
 };
 
 // Non regular region with length of DEFAULT_REGION_SIZE(256kb) multiple
@@ -160,11 +205,19 @@ public:
     NO_COPY_SEMANTIC(MemMapAllocator);
     NO_MOVE_SEMANTIC(MemMapAllocator);
 
-    void Initialize(size_t capacity, size_t alignment)
+    void Initialize(size_t capacity, [[maybe_unused]] size_t alignment)
     {
         memMapTotalSize_ = 0;
         capacity_ = capacity;
+#ifdef ECMASCRIPT_ENABLE_POINTER_COMPRESSION
+        // the cage is rewound, memory cached from it before would be handed out twice
+        memMapPool_.Finalize();
+        memMapFreeList_.Finalize();
+        InitializeCage();
+        MemMap memMap(reinterpret_cast<void *>(cageBase_ + HEAP_START_ADDRESS), NON_REGULAR_MMAP_SIZE);
+#else
         MemMap memMap = PageMap(NON_REGULAR_MMAP_SIZE, alignment);
+#endif
         PageRelease(memMap.GetMem(), memMap.GetSize());
         memMapFreeList_.Initialize(memMap);
     }
@@ -173,6 +226,7 @@ public:
     {
         memMapTotalSize_ = 0;
         capacity_ = 0;
+        keepFreedMemResident_ = false;
         memMapFreeList_.Finalize();
         memMapPool_.Finalize();
     }
@@ -187,12 +241,64 @@ public:
 
     void Free(void *mem, size_t size, bool isRegular);
 
+    // Return the regular regions freed at least ageMs ago to the os. Returns the released size.
+    size_t ReleaseIdleMem(double ageMs);
+
+    // Freed regular regions are kept resident only once the embedder sends idle notifications, which release them
+    // after they aged. Without those nothing may run for a long time, so the regions are released on free.
+    void KeepFreedMemResident(bool keep)
+    {
+        keepFreedMemResident_ = keep;
+    }
+
+    // the size of the freed regular regions whose pages are still resident
+    size_t GetResidentCacheSize() const
+    {
+        return memMapPool_.GetResidentCacheSize();
+    }
+
+    // Return the whole pages inside [begin, end) to the os, they read as zero afterwards. Returns the released size.
+    static size_t DecommitRange(uintptr_t begin, uintptr_t end);
+
+#ifdef ECMASCRIPT_ENABLE_POINTER_COMPRESSION
+    // All regions are carved out of one HEAP_CAGE_SIZE aligned reservation, so a heap address is the cage base plus
+    // a 32 bit offset. The first HEAP_START_ADDRESS bytes of the cage are never handed out, offset 0 stays invalid.
+    static constexpr size_t HEAP_CAGE_SIZE = 1ULL << 32U;  // 32: the cage is addressed by 32 bit offsets
+
+    static uintptr_t GetCageBase()
+    {
+        return cageBase_;
+    }
+
+    static bool InCage(uintptr_t addr)
+    {
+        return addr - cageBase_ < HEAP_CAGE_SIZE;
+    }
+
+    static uint32_t CompressPointer(uintptr_t addr)
+    {
+        ASSERT(InCage(addr));
+        return static_cast<uint32_t>(addr - cageBase_);
+    }
+
+    static uintptr_t DecompressPointer(uint32_t offset)
+    {
+        return cageBase_ + offset;
+    }
+#endif
+
 private:
     static constexpr uintptr_t HEAP_START_ADDRESS = 256_KB;
     static constexpr size_t REGULAR_REGION_MMAP_SIZE = 4_MB;
     static constexpr size_t NON_REGULAR_MMAP_SIZE = 512_MB;
 
     MemMap PageMap(size_t size, size_t alignment);
+#ifdef ECMASCRIPT_ENABLE_POINTER_COMPRESSION
+    // reserve the cage once per process, the regions of the next vm reuse it
+    void InitializeCage();
+    // the next REGULAR_REGION_MMAP_SIZE of the cage behind the non regular space
+    MemMap CageMap();
+#endif
 
     void PageRelease([[maybe_unused]]void *mem, [[maybe_unused]]size_t size)
     {
@@ -216,6 +322,11 @@ private:
     MemMapFreeList memMapFreeList_;
     std::atomic_size_t memMapTotalSize_ {0};
     size_t capacity_ {0};
+    std::atomic_bool keepFreedMemResident_ {false};
+#ifdef ECMASCRIPT_ENABLE_POINTER_COMPRESSION
+    static inline uintptr_t cageBase_ {0};
+    std::atomic<uintptr_t> cageTop_ {0};
+#endif
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_MEM_MEM_MAP_ALLOCATOR_H
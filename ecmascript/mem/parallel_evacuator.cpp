@@ -21,7 +21,9 @@
 #include "ecmascript/mem/heap.h"
 #include "ecmascript/mem/space-inl.h"
 #include "ecmascript/mem/gc_bitset.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/mem/mem.h"
+#include "ecmascript/mem/mem_controller.h"
 #include "ecmascript/mem/tlab_allocator-inl.h"
 #include "ecmascript/mem/utils.h"
 #include "ecmascript/mem/visitor.h"
@@ -35,6 +37,7 @@ void ParallelEvacuator::Initialize()
     heap_->SwapNewSpace();
     allocator_ = new TlabAllocator(heap_);
     promotedSize_ = 0;
+    evacuatedSize_ = 0;
 }
 
 void ParallelEvacuator::Finalize()
@@ -52,19 +55,25 @@ void ParallelEvacuator::Evacuate()
     EvacuateSpace();
     UpdateReference();
     Finalize();
+    heap_->GetMemController()->RecordAfterEvacuation(evacuatedSize_, clockScope.TotalSpentTime());
     heap_->GetEcmaVM()->GetEcmaGCStats()->StatisticConcurrentEvacuate(clockScope.GetPauseTime());
 }
 
 void ParallelEvacuator::EvacuateSpace()
 {
     MEM_ALLOCATE_AND_GC_TRACE(heap_->GetEcmaVM(), ParallelEvacuator);
-    heap_->GetFromSpaceDuringEvacuation()->EnumerateRegions([this] (Region *current) {
+    GCTraceScope traceScope(heap_->GetGCTracer(), "ParallelEvacuator::EvacuateSpace");
+    size_t regionCount = 0;
+    heap_->GetFromSpaceDuringEvacuation()->EnumerateRegions([this, &regionCount] (Region *current) {
         AddWorkload(std::make_unique<EvacuateWorkload>(this, current));
+        regionCount++;
     });
     heap_->GetOldSpace()->EnumerateCollectRegionSet(
-        [this](Region *current) {
+        [this, &regionCount](Region *current) {
             AddWorkload(std::make_unique<EvacuateWorkload>(this, current));
+            regionCount++;
         });
+    traceScope.SetRegions(regionCount);
     if (heap_->IsParallelGCEnabled()) {
         os::memory::LockHolder holder(mutex_);
         parallel_ = CalculateEvacuationThreadNum();
@@ -75,13 +84,17 @@ void ParallelEvacuator::EvacuateSpace()
 
     EvacuateSpace(allocator_, true);
     WaitFinished();
+    traceScope.SetBytes(evacuatedSize_);
 }
 
 bool ParallelEvacuator::EvacuateSpace(TlabAllocator *allocator, bool isMain)
 {
+    GCTraceScope traceScope(heap_->GetGCTracer(), isMain ? "ParallelEvacuator::EvacuateRegions" :
+        "ParallelEvacuator::EvacuationTask");
     std::unique_ptr<Workload> region = GetWorkloadSafe();
     while (region != nullptr) {
         EvacuateRegion(allocator, region->GetRegion());
+        traceScope.AddRegions(1);
         region = GetWorkloadSafe();
     }
     allocator->Finalize();
@@ -99,17 +112,19 @@ void ParallelEvacuator::EvacuateRegion(TlabAllocator *allocator, Region *region)
     bool isInOldGen = region->InOldGeneration();
     bool isBelowAgeMark = region->BelowAgeMark();
     size_t promotedSize = 0;
+    size_t evacuatedSize = 0;
     if (!isBelowAgeMark && !isInOldGen && IsWholeRegionEvacuate(region)) {
         if (heap_->MoveYoungRegionSync(region)) {
             return;
         }
     }
     region->IterateAllMarkedBits([this, &region, &isInOldGen, &isBelowAgeMark,
-                                  &promotedSize, &allocator](void *mem) {
+                                  &promotedSize, &evacuatedSize, &allocator](void *mem) {
         ASSERT(region->InRange(ToUintPtr(mem)));
         auto header = reinterpret_cast<TaggedObject *>(mem);
         auto klass = header->GetClass();
         auto size = klass->SizeFromJSHClass(header);
+        evacuatedSize += size;
 
         uintptr_t address = 0;
         bool actualPromoted = false;
@@ -142,6 +157,7 @@ void ParallelEvacuator::EvacuateRegion(TlabAllocator *allocator, Region *region)
         }
     });
     promotedSize_.fetch_add(promotedSize);
+    evacuatedSize_.fetch_add(evacuatedSize);
 }
 
 void ParallelEvacuator::VerifyHeapObject(TaggedObject *object)
@@ -172,6 +188,7 @@ void ParallelEvacuator::VerifyHeapObject(TaggedObject *object)
 void ParallelEvacuator::UpdateReference()
 {
     MEM_ALLOCATE_AND_GC_TRACE(heap_->GetEcmaVM(), ParallelUpdateReference);
+    GCTraceScope traceScope(heap_->GetGCTracer(), "ParallelEvacuator::UpdateReference");
     // Update reference pointers
     uint32_t youngeRegionMoveCount = 0;
     uint32_t youngeRegionCopyCount = 0;
@@ -195,6 +212,7 @@ void ParallelEvacuator::UpdateReference()
     heap_->EnumerateSnapShotSpaceRegions([this] (Region *current) {
         AddWorkload(std::make_unique<UpdateRSetWorkload>(this, current));
     });
+    traceScope.SetRegions(youngeRegionMoveCount + youngeRegionCopyCount + oldRegionCount);
     LOG(DEBUG, RUNTIME) << "UpdatePointers statistic: younge space region compact moving count:"
                         << youngeRegionMoveCount
                         << "younge space region compact coping count:" << youngeRegionCopyCount
@@ -396,7 +414,7 @@ bool ParallelEvacuator::ProcessWorkloads(bool isMain)
 }
 
 ParallelEvacuator::EvacuationTask::EvacuationTask(ParallelEvacuator *evacuator)
-    : evacuator_(evacuator)
+    : Task(TaskPriority::HIGH), evacuator_(evacuator)
 {
     allocator_ = new TlabAllocator(evacuator->heap_);
 }
@@ -413,6 +431,7 @@ bool ParallelEvacuator::EvacuationTask::Run([[maybe_unused]] uint32_t threadInde
 
 bool ParallelEvacuator::UpdateReferenceTask::Run([[maybe_unused]] uint32_t threadIndex)
 {
+    GCTraceScope traceScope(evacuator_->heap_->GetGCTracer(), "ParallelEvacuator::UpdateReferenceTask");
     evacuator_->ProcessWorkloads(false);
     return true;
 }
@@ -60,7 +60,8 @@ private:
 
     class UpdateReferenceTask : public Task {
     public:
-        explicit UpdateReferenceTask(ParallelEvacuator *evacuator) : evacuator_(evacuator) {};
+        explicit UpdateReferenceTask(ParallelEvacuator *evacuator)
+            : Task(TaskPriority::HIGH), evacuator_(evacuator) {};
         ~UpdateReferenceTask() override = default;
 
         bool Run(uint32_t threadIndex) override;
@@ -159,6 +160,7 @@ private:
     os::memory::Mutex mutex_;
     os::memory::ConditionVariable condition_;
     std::atomic<size_t> promotedSize_ = 0;
+    std::atomic<size_t> evacuatedSize_ = 0;
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_MEM_PARALLEL_EVACUATOR_H
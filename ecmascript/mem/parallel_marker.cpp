@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <limits>
+
 #include "ecmascript/mem/parallel_marker-inl.h"
 #include "ecmascript/mem/visitor.h"
 
@@ -48,6 +50,12 @@ void Marker::ProcessSnapshotRSet(uint32_t threadId)
 }
 
 void NonMovableMarker::ProcessMarkStack(uint32_t threadId)
+{
+    size_t markedSize = 0;
+    ProcessMarkStackStep(threadId, std::numeric_limits<size_t>::max(), markedSize);
+}
+
+bool NonMovableMarker::ProcessMarkStackStep(uint32_t threadId, size_t stepSize, size_t &markedSize)
 {
     bool isFullMark = heap_->IsFullMark();
     auto visitor = [this, threadId, isFullMark](TaggedObject *root, ObjectSlot start, ObjectSlot end,
@@ -74,18 +82,24 @@ void NonMovableMarker::ProcessMarkStack(uint32_t threadId)
             }
         }
     };
+    // Only a bounded step needs the sizes of the visited objects.
+    bool isBounded = stepSize != std::numeric_limits<size_t>::max();
     WorkManager *workManager = heap_->GetWorkManager();
     TaggedObject *obj = nullptr;
-    while (true) {
+    while (!isBounded || markedSize < stepSize) {
         obj = nullptr;
         if (!workManager->Pop(threadId, &obj)) {
-            break;
+            return true;
         }
 
         JSHClass *jsHclass = obj->GetClass();
         MarkObject(threadId, jsHclass);
         objXRay_.VisitObjectBody<VisitType::OLD_GC_VISIT>(obj, jsHclass, visitor);
+        if (isBounded) {
+            markedSize += jsHclass->SizeFromJSHClass(obj);
+        }
     }
+    return false;
 }
 
 void SemiGCMarker::Initialize()
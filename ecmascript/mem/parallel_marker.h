@@ -49,6 +49,14 @@ public:
         LOG(FATAL, ECMASCRIPT) << "can not call this method";
     }
 
+    // Visit objects of the mark stack until their size exceeds stepSize, return whether the stack is drained.
+    virtual bool ProcessMarkStackStep([[maybe_unused]] uint32_t threadId, [[maybe_unused]] size_t stepSize,
+                                      [[maybe_unused]] size_t &markedSize)
+    {
+        LOG(FATAL, ECMASCRIPT) << "can not call this method";
+        return true;
+    }
+
 protected:
     // non move
     virtual inline void MarkObject([[maybe_unused]] uint32_t threadId, [[maybe_unused]] TaggedObject *object)
@@ -82,6 +90,7 @@ public:
 
 protected:
     void ProcessMarkStack(uint32_t threadId) override;
+    bool ProcessMarkStackStep(uint32_t threadId, size_t stepSize, size_t &markedSize) override;
     inline void MarkObject(uint32_t threadId, TaggedObject *object) override;
     inline void HandleRoots(uint32_t threadId, [[maybe_unused]] Root type, ObjectSlot slot) override;
     inline void HandleRangeRoots(uint32_t threadId, [[maybe_unused]] Root type, ObjectSlot start,
@@ -16,9 +16,11 @@
 #include "ecmascript/mem/partial_gc.h"
 
 #include "ecmascript/ecma_vm.h"
+#include "ecmascript/mem/allocation_site_tracker.h"
 #include "ecmascript/mem/barriers-inl.h"
 #include "ecmascript/mem/clock_scope.h"
 #include "ecmascript/mem/concurrent_marker.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/mem/heap-inl.h"
 #include "ecmascript/mem/mark_stack.h"
 #include "ecmascript/mem/mem.h"
@@ -34,6 +36,7 @@ PartialGC::PartialGC(Heap *heap) : heap_(heap), workManager_(heap->GetWorkManage
 void PartialGC::RunPhases()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "PartialGC::RunPhases");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "PartialGC::RunPhases");
     MEM_ALLOCATE_AND_GC_TRACE(heap_->GetEcmaVM(), PartialGC_RunPhases);
     ClockScope clockScope;
 
@@ -42,9 +45,11 @@ void PartialGC::RunPhases()
     ECMA_GC_LOG() << "concurrentMark_" << concurrentMark_;
     Initialize();
     Mark();
+    heap_->GetAllocationSiteTracker()->ProcessMementos();
     Sweep();
     Evacuate();
     Finish();
+    traceScope.SetBytes(freeSize_);
     heap_->GetEcmaVM()->GetEcmaGCStats()->StatisticPartialGC(concurrentMark_, clockScope.GetPauseTime(), freeSize_);
     ECMA_GC_LOG() << "PartialGC::RunPhases " << clockScope.TotalSpentTime();
 }
@@ -52,6 +57,7 @@ void PartialGC::RunPhases()
 void PartialGC::Initialize()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "PartialGC::Initialize");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "PartialGC::Initialize");
     if (!concurrentMark_) {
         LOG(INFO, RUNTIME) << "Concurrent mark failure";
         heap_->Prepare();
@@ -75,6 +81,7 @@ void PartialGC::Initialize()
 void PartialGC::Finish()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "PartialGC::Finish");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "PartialGC::Finish");
     if (concurrentMark_) {
         auto marker = heap_->GetConcurrentMarker();
         marker->Reset(false);
@@ -87,6 +94,7 @@ void PartialGC::Finish()
 void PartialGC::Mark()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "PartialGC::Mark");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "PartialGC::Mark");
     if (concurrentMark_) {
         heap_->GetConcurrentMarker()->ReMark();
         return;
@@ -104,6 +112,7 @@ void PartialGC::Mark()
 void PartialGC::Sweep()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "PartialGC::Sweep");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "PartialGC::Sweep");
     if (heap_->IsFullMark()) {
         ProcessNativeDelete();
         heap_->GetSweeper()->Sweep();
@@ -128,6 +137,7 @@ void PartialGC::ProcessNativeDelete()
 void PartialGC::Evacuate()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "PartialGC::Evacuate");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "PartialGC::Evacuate");
     heap_->GetEvacuator()->Evacuate();
 }
 }  // namespace panda::ecmascript
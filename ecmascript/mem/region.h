@@ -354,6 +354,17 @@ public:
     {
         wasted_ += size;
     }
+    // the size of the free pages of the region returned to the os since it was swept last
+    void SetDecommittedSize(size_t size)
+    {
+        decommittedSize_ = size;
+    }
+
+    size_t GetDecommittedSize() const
+    {
+        return decommittedSize_;
+    }
+
     size_t GetWastedSize()
     {
         return wasted_;
@@ -433,6 +444,7 @@ private:
     size_t wasted_;
     os::memory::Mutex lock_;
     NativeAreaAllocator* nativeAreaAllocator_ {nullptr};
+    size_t decommittedSize_ {0};
     friend class SnapShot;
 };
 
@@ -79,6 +79,7 @@ uintptr_t HugeObjectSpace::Allocate(size_t objectSize)
         return 0;
     }
 
+    heap_->TryTriggerIncrementalMarking();
     // Check whether it is necessary to trigger Old GC before expanding or OOM risk.
     heap_->CheckAndTriggerOldGC();
 
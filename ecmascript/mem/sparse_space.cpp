@@ -15,11 +15,16 @@
 
 #include "ecmascript/mem/sparse_space.h"
 
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/free_object.h"
 #include "ecmascript/js_hclass-inl.h"
+#include "ecmascript/mem/clock_scope.h"
 #include "ecmascript/mem/concurrent_sweeper.h"
 #include "ecmascript/mem/free_object_set.h"
+#include "ecmascript/mem/gc_stats.h"
 #include "ecmascript/mem/heap.h"
 #include "ecmascript/mem/mem_controller.h"
+#include "ecmascript/mem/mem_map_allocator.h"
 #include "ecmascript/runtime_call_id.h"
 
 namespace panda::ecmascript {
@@ -59,6 +64,7 @@ uintptr_t SparseSpace::Allocate(size_t size, bool isAllowGC)
     }
 
     if (isAllowGC) {
+        heap_->TryTriggerIncrementalMarking();
         // Check whether it is necessary to trigger Old GC before expanding or OOM risk.
         heap_->CheckAndTriggerOldGC();
     }
@@ -99,14 +105,23 @@ uintptr_t SparseSpace::AllocateAfterSweepingCompleted(size_t size)
 {
     ASSERT(sweepState_ == SweepState::SWEEPING);
     MEM_ALLOCATE_AND_GC_TRACE(heap_->GetEcmaVM(), ConcurrentSweepingWait);
-    if (FillSweptRegion()) {
+    if (CollectSweptRegions()) {
         auto object = allocator_->Allocate(size);
         if (object != 0) {
-            liveObjectSize_ += size;
             return object;
         }
     }
-    // Parallel
+    // Sweep the regions no sweeper task has claimed yet one at a time, until one of them has room for the object.
+    Region *current = nullptr;
+    while ((current = GetSweepingRegionSafe()) != nullptr) {
+        FreeRegion(current);
+        heap_->GetEcmaVM()->GetEcmaGCStats()->StatisticLazySweep();
+        auto object = allocator_->Allocate(size);
+        if (object != 0) {
+            return object;
+        }
+    }
+    // Only the regions the sweeper tasks are sweeping are left.
     heap_->GetSweeper()->EnsureTaskFinished(spaceType_);
     return allocator_->Allocate(size);
 }
@@ -151,9 +166,17 @@ void SparseSpace::Sweep()
             FreeRegion(current);
         }
     });
+    sweepState_ = SweepState::SWEPT;
 }
 
 bool SparseSpace::FillSweptRegion()
+{
+    bool collected = CollectSweptRegions();
+    sweepState_ = SweepState::SWEPT;
+    return collected;
+}
+
+bool SparseSpace::CollectSweptRegions()
 {
     if (sweptList_.empty()) {
         return false;
@@ -162,7 +185,6 @@ bool SparseSpace::FillSweptRegion()
     while ((region = GetSweptRegionSafe()) != nullptr) {
         allocator_->CollectFreeObjectSet(region);
     }
-    sweepState_ = SweepState::SWEPT;
     return true;
 }
 
@@ -209,6 +231,8 @@ Region *SparseSpace::GetSweptRegionSafe()
 
 void SparseSpace::FreeRegion(Region *current, bool isMain)
 {
+    ClockScope clockScope;
+    heapRegionAllocator_->RecommitRegion(current);
     uintptr_t freeStart = current->GetBegin();
     current->IterateAllMarkedBits([this, &current, &freeStart, isMain](void *mem) {
         ASSERT(current->InRange(ToUintPtr(mem)));
@@ -226,6 +250,36 @@ void SparseSpace::FreeRegion(Region *current, bool isMain)
     if (freeStart != freeEnd) {
         FreeLiveRange(current, freeStart, freeEnd, isMain);
     }
+    heap_->GetEcmaVM()->GetEcmaGCStats()->StatisticSweptRegion(current->GetSize(), clockScope.GetPauseTime());
+}
+
+size_t SparseSpace::DecommitFreeRegions()
+{
+    size_t decommittedSize = 0;
+    EnumerateRegions([this, &decommittedSize](Region *region) {
+        if (region->InCollectSet() || region->GetDecommittedSize() != 0) {
+            return;
+        }
+        // A region nothing was allocated in since it was swept is one free object that is still in the free list.
+        size_t available = 0;
+        region->EnumerateSets([&available](FreeObjectSet *set) {
+            if (set != nullptr) {
+                available += set->Available();
+            }
+        });
+        if (available != region->GetSize()) {
+            return;
+        }
+        auto freeObject = FreeObject::Cast(region->GetBegin());
+        if (!freeObject->IsFreeObject() || freeObject->Available() != region->GetSize()) {
+            return;
+        }
+        size_t size = MemMapAllocator::DecommitRange(region->GetBegin() + FreeObject::SIZE, region->GetEnd());
+        region->SetDecommittedSize(size);
+        heapRegionAllocator_->IncreaseDecommittedMemorySize(size);
+        decommittedSize += size;
+    });
+    return decommittedSize;
 }
 
 void SparseSpace::FreeLiveRange(Region *current, uintptr_t freeStart, uintptr_t freeEnd, bool isMain)
@@ -270,6 +324,11 @@ size_t SparseSpace::GetTotalAllocatedSize() const
     return allocator_->GetAllocatedSize();
 }
 
+size_t SparseSpace::GetWastedSize() const
+{
+    return allocator_->GetWastedSize();
+}
+
 void SparseSpace::DetachFreeObjectSet(Region *region)
 {
     allocator_->DetachFreeObjectSet(region);
@@ -320,7 +379,7 @@ void OldSpace::SelectCSet()
         return;
     }
     CheckRegionSize();
-    // 1、Select region which alive object larger than 80%
+    // 1、Select region which alive object less than 80%, as accounted by the marking of the last full mark
     EnumerateRegions([this](Region *region) {
         if (!region->MostObjectAlive()) {
             collectRegionSet_.emplace_back(region);
@@ -331,10 +390,11 @@ void OldSpace::SelectCSet()
         collectRegionSet_.clear();
         return;
     }
-    // sort
+    // 2、Sort the most fragmented regions, i.e. the ones with the least alive object, to the front
     std::sort(collectRegionSet_.begin(), collectRegionSet_.end(), [](Region *first, Region *second) {
         return first->AliveObject() < second->AliveObject();
     });
+    // 3、Take as many of them as can be evacuated in the time budget
     unsigned long selectedRegionNumber = GetSelectedRegionNumber();
     if (collectRegionSet_.size() > selectedRegionNumber) {
         collectRegionSet_.resize(selectedRegionNumber);
@@ -350,6 +410,34 @@ void OldSpace::SelectCSet()
     LOG_ECMA_MEM(DEBUG) << "Select CSet success: number is " << collectRegionSet_.size();
 }
 
+unsigned long OldSpace::GetSelectedRegionNumber() const
+{
+    double evacuationSpeed = heap_->GetMemController()->GetEvacuationSpeedPerMS();
+    // Until an evacuation was measured, the number of regions is only bounded by the committed size.
+    if (evacuationSpeed <= 0) {
+        return std::max(committedSize_ / PARTIAL_GC_MAX_COLLECT_REGION_RATE, PARTIAL_GC_INITIAL_COLLECT_REGION_SIZE);
+    }
+    auto evacuationBudget = static_cast<size_t>(evacuationSpeed * PARTIAL_GC_EVACUATION_TIME_BUDGET_MS);
+    size_t aliveObjectSize = 0;
+    unsigned long selectedRegionNumber = 0;
+    for (Region *region : collectRegionSet_) {
+        aliveObjectSize += region->AliveObject();
+        if (aliveObjectSize > evacuationBudget) {
+            break;
+        }
+        selectedRegionNumber++;
+    }
+    return selectedRegionNumber;
+}
+
+double OldSpace::GetFragmentationRate() const
+{
+    if (committedSize_ == 0) {
+        return 0;
+    }
+    return 1 - static_cast<double>(std::min(GetHeapObjectSize(), committedSize_)) / committedSize_;
+}
+
 void OldSpace::CheckRegionSize()
 {
 #ifndef NDEBUG
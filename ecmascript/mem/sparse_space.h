@@ -54,6 +54,7 @@ public:
     void AsyncSweep(bool isMain);
     void Sweep();
 
+    // Collect the regions swept by the sweeper tasks into the free list, and finish the sweeping of this space.
     bool FillSweptRegion();
 
     void AddSweepingRegion(Region *region);
@@ -63,6 +64,9 @@ public:
     Region *GetSweptRegionSafe();
 
     void FreeRegion(Region *current, bool isMain = true);
+    // Return the pages of the regions the last sweeping left completely free to the os, except the page holding the
+    // header of their free object. Must not run while sweeping. Returns the decommitted size.
+    size_t DecommitFreeRegions();
     void FreeLiveRange(Region *current, uintptr_t freeStart, uintptr_t freeEnd, bool isMain);
 
     void DetachFreeObjectSet(Region *region);
@@ -81,6 +85,7 @@ public:
     }
 
     size_t GetTotalAllocatedSize() const;
+    size_t GetWastedSize() const;
 
 protected:
     FreeListAllocator *allocator_;
@@ -89,6 +94,7 @@ protected:
 private:
     // For sweeping
     uintptr_t AllocateAfterSweepingCompleted(size_t size);
+    bool CollectSweptRegions();
 
     os::memory::Mutex lock_;
     std::vector<Region *> sweepingList_;
@@ -118,10 +124,10 @@ public:
     void RevertCSet();
     void ReclaimCSet();
 
-    unsigned long GetSelectedRegionNumber() const
-    {
-        return std::max(committedSize_ / PARTIAL_GC_MAX_COLLECT_REGION_RATE, PARTIAL_GC_INITIAL_COLLECT_REGION_SIZE);
-    }
+    // The number of the sorted candidates of the collect set to evacuate.
+    unsigned long GetSelectedRegionNumber() const;
+    // The part of the committed size not taken by live objects, i.e. free, wasted or not swept yet.
+    double GetFragmentationRate() const;
 
     template<class Callback>
     void EnumerateCollectRegionSet(const Callback &cb) const
@@ -138,6 +144,8 @@ private:
     static constexpr unsigned long long PARTIAL_GC_MAX_COLLECT_REGION_RATE =  1024 * 1024 * 2;
     static constexpr unsigned long long PARTIAL_GC_INITIAL_COLLECT_REGION_SIZE = 16;
     static constexpr size_t PARTIAL_GC_MIN_COLLECT_REGION_SIZE = 5;
+    // the evacuation pause the old regions of the collect set may add to the partial gc
+    static constexpr double PARTIAL_GC_EVACUATION_TIME_BUDGET_MS = 5.0;
 
     CVector<Region *> collectRegionSet_;
     os::memory::Mutex lock_;
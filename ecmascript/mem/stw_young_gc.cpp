@@ -18,6 +18,7 @@
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/mem/clock_scope.h"
 #include "ecmascript/mem/concurrent_marker.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/mem/heap-inl.h"
 #include "ecmascript/mem/mark_stack.h"
 #include "ecmascript/mem/mem.h"
@@ -39,6 +40,7 @@ void STWYoungGC::RunPhases()
     [[maybe_unused]] ClockScope clockScope;
 
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "STWYoungGC::RunPhases");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "STWYoungGC::RunPhases");
     bool concurrentMark = heap_->CheckConcurrentMark();
     if (concurrentMark) {
         ECMA_GC_LOG() << "STWYoungGC after ConcurrentMarking";
@@ -56,6 +58,7 @@ void STWYoungGC::RunPhases()
 void STWYoungGC::Initialize()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "STWYoungGC::Initialize");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "STWYoungGC::Initialize");
     heap_->Prepare();
     commitSize_ = heap_->GetNewSpace()->GetCommittedSize();
     heap_->SwapNewSpace();
@@ -68,6 +71,7 @@ void STWYoungGC::Initialize()
 void STWYoungGC::Mark()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "STWYoungGC::Mark");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "STWYoungGC::Mark");
     auto region = heap_->GetOldSpace()->GetCurrentRegion();
 
     if (parallelGC_) {
@@ -94,6 +98,7 @@ void STWYoungGC::Mark()
 void STWYoungGC::Sweep()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "STWYoungGC::Sweep");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "STWYoungGC::Sweep");
     auto totalThreadCount = static_cast<uint32_t>(
         Taskpool::GetCurrentTaskpool()->GetTotalThreadNum() + 1);  // gc thread and main thread
     for (uint32_t i = 0; i < totalThreadCount; i++) {
@@ -140,6 +145,7 @@ void STWYoungGC::Sweep()
 void STWYoungGC::Finish()
 {
     ECMA_BYTRACE_NAME(BYTRACE_TAG_ARK, "STWYoungGC::Finish");
+    GCTraceScope traceScope(heap_->GetGCTracer(), "STWYoungGC::Finish");
     workManager_->Finish(semiCopiedSize_, promotedSize_);
     heap_->Resume(YOUNG_GC);
 }
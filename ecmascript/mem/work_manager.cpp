@@ -73,14 +73,26 @@ void WorkManager::PushWorkNodeToGlobal(uint32_t threadId, bool postTask)
 {
     WorkNode *&inNode = works_[threadId].inNode_;
     if (!inNode->IsEmpty()) {
-        workStack_.Push(inNode);
-        inNode = AllocateWorkNode();
-        if (postTask && heap_->IsParallelGCEnabled() && heap_->CheckCanDistributeTask()) {
+        bool wasEmpty = workStack_.Push(inNode);
+        inNode = AllocateWorkNode(threadId);
+        if (postTask && heap_->IsParallelGCEnabled() && ShouldPostTask(threadId, wasEmpty) &&
+            heap_->CheckCanDistributeTask()) {
             heap_->PostParallelGCTask(parallelGCTaskPhase_);
         }
     }
 }
 
+bool WorkManager::ShouldPostTask(uint32_t threadId, bool wasEmpty)
+{
+    // Running tasks keep draining a non-empty stack, so only wake more of them once enough work has piled up.
+    uint32_t &pushCount = works_[threadId].pushCountSincePost_;
+    if (wasEmpty || ++pushCount >= POST_TASK_BATCH) {
+        pushCount = 0;
+        return true;
+    }
+    return false;
+}
+
 bool WorkManager::Pop(uint32_t threadId, TaggedObject **object)
 {
     WorkNode *&outNode = works_[threadId].outNode_;
@@ -100,7 +112,18 @@ bool WorkManager::Pop(uint32_t threadId, TaggedObject **object)
 
 bool WorkManager::PopWorkNodeFromGlobal(uint32_t threadId)
 {
-    return workStack_.Pop(&works_[threadId].outNode_);
+    WorkNodeHolder &holder = works_[threadId];
+    WorkNode *node = nullptr;
+    if (!workStack_.Pop(&node)) {
+        return false;
+    }
+    // The drained out node is recycled by this thread instead of being dropped until Finish.
+    if (holder.outNode_ != nullptr && holder.outNode_->IsEmpty()) {
+        holder.outNode_->SetNext(holder.freeNodes_);
+        holder.freeNodes_ = holder.outNode_;
+    }
+    holder.outNode_ = node;
+    return true;
 }
 
 void WorkManager::Finish(size_t &aliveSize)
@@ -142,8 +165,10 @@ void WorkManager::Initialize(TriggerGCType gcType, ParallelGCTaskPhase taskPhase
     markSpaceEnd_ = markSpace_ + SPACE_SIZE;
     for (uint32_t i = 0; i < threadNum_; i++) {
         WorkNodeHolder &holder = works_[i];
-        holder.inNode_ = AllocateWorkNode();
-        holder.outNode_ = AllocateWorkNode();
+        holder.freeNodes_ = nullptr;
+        holder.pushCountSincePost_ = 0;
+        holder.inNode_ = AllocateWorkNodeFromSpace();
+        holder.outNode_ = AllocateWorkNodeFromSpace();
         holder.weakQueue_ = new ProcessQueue();
         holder.weakQueue_->BeginMarking(heap_, continuousQueue_[i]);
         holder.aliveSize_ = 0;
@@ -154,7 +179,18 @@ void WorkManager::Initialize(TriggerGCType gcType, ParallelGCTaskPhase taskPhase
     }
 }
 
-WorkNode *WorkManager::AllocateWorkNode()
+WorkNode *WorkManager::AllocateWorkNode(uint32_t threadId)
+{
+    WorkNode *&freeNodes = works_[threadId].freeNodes_;
+    if (freeNodes != nullptr) {
+        WorkNode *node = freeNodes;
+        freeNodes = node->Next();
+        return node;
+    }
+    return AllocateWorkNodeFromSpace();
+}
+
+WorkNode *WorkManager::AllocateWorkNodeFromSpace()
 {
     size_t totalSize = sizeof(WorkNode) + sizeof(Stack) + STACK_AREA_SIZE;
     // CAS
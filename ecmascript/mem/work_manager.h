@@ -16,6 +16,8 @@
 #ifndef ECMASCRIPT_MEM_WORK_MANAGER_H
 #define ECMASCRIPT_MEM_WORK_MANAGER_H
 
+#include <atomic>
+
 #include "ecmascript/mem/mark_stack.h"
 #include "ecmascript/mem/slots.h"
 #include "ecmascript/taskpool/taskpool.h"
@@ -26,6 +28,8 @@ using SlotNeedUpdate = std::pair<TaggedObject *, ObjectSlot>;
 static constexpr uint32_t MARKSTACK_MAX_SIZE = 100;
 static constexpr uint32_t STACK_AREA_SIZE = sizeof(uintptr_t) * MARKSTACK_MAX_SIZE;
 static constexpr uint32_t SPACE_SIZE = 8 * 1024;
+// A parallel task is posted for every POST_TASK_BATCH nodes published, or as soon as a node lands on an empty stack.
+static constexpr uint32_t POST_TASK_BATCH = 4;
 
 class Heap;
 class Stack;
@@ -82,56 +86,99 @@ public:
 
     WorkNode *Next() const
     {
-        return next_;
+        return next_.load(std::memory_order_relaxed);
     }
 
     void SetNext(WorkNode *node)
     {
-        next_ = node;
+        next_.store(node, std::memory_order_relaxed);
     }
 
 private:
-    WorkNode *next_;
+    // Atomic because a thread losing a race in GlobalWorkStack::Pop may still read it after the node was handed over.
+    std::atomic<WorkNode *> next_;
     Stack *stack_;
 };
 
+// Lock-free (Treiber) stack through which marking threads hand full WorkNodes to each other. The head packs the top
+// node together with a tag bumped by every update, so a node that is popped and pushed again between another thread's
+// load and CAS cannot be mistaken for an unchanged top (ABA). WorkNodes are never freed while marking, which makes it
+// safe to read Next() of a node some other thread has just taken; the following CAS fails in that case.
 class GlobalWorkStack {
 public:
-    GlobalWorkStack() : top_(nullptr) {}
+    GlobalWorkStack() = default;
     ~GlobalWorkStack() = default;
 
     NO_COPY_SEMANTIC(GlobalWorkStack);
     NO_MOVE_SEMANTIC(GlobalWorkStack);
 
-    void Push(WorkNode *node)
+    // Returns true if the stack was empty before the push.
+    bool Push(WorkNode *node)
     {
         if (node == nullptr) {
-            return;
+            return false;
         }
-        os::memory::LockHolder lock(mtx_);
-        node->SetNext(top_);
-        top_ = node;
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        uint64_t newHead = 0;
+        do {
+            node->SetNext(GetNode(head));
+            newHead = MakeHead(node, GetTag(head) + 1);
+        } while (!head_.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+        return GetNode(head) == nullptr;
     }
 
     bool Pop(WorkNode **node)
     {
-        os::memory::LockHolder lock(mtx_);
-        if (top_ == nullptr) {
-            return false;
-        }
-        *node = top_;
-        top_ = top_->Next();
+        uint64_t head = head_.load(std::memory_order_acquire);
+        uint64_t newHead = 0;
+        WorkNode *top = nullptr;
+        do {
+            top = GetNode(head);
+            if (top == nullptr) {
+                return false;
+            }
+            newHead = MakeHead(top->Next(), GetTag(head) + 1);
+        } while (!head_.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire));
+        *node = top;
         return true;
     }
 
+    bool IsEmpty() const
+    {
+        return GetNode(head_.load(std::memory_order_acquire)) == nullptr;
+    }
+
 private:
-    WorkNode *top_ {nullptr};
-    os::memory::Mutex mtx_;
+    // 48: user space addresses of 64-bit targets fit in the low 48 bits, the rest of the word holds the tag.
+    static constexpr uint32_t NODE_BITS = sizeof(uintptr_t) == sizeof(uint64_t) ? 48 : 32;
+    static constexpr uint64_t NODE_MASK = (1ULL << NODE_BITS) - 1;
+
+    static uint64_t MakeHead(WorkNode *node, uint64_t tag)
+    {
+        auto bits = static_cast<uint64_t>(ToUintPtr(node));
+        ASSERT((bits & ~NODE_MASK) == 0);
+        return bits | (tag << NODE_BITS);
+    }
+
+    static WorkNode *GetNode(uint64_t head)
+    {
+        return reinterpret_cast<WorkNode *>(static_cast<uintptr_t>(head & NODE_MASK));
+    }
+
+    static uint64_t GetTag(uint64_t head)
+    {
+        return head >> NODE_BITS;
+    }
+
+    std::atomic<uint64_t> head_ {0};
 };
 
 struct WorkNodeHolder {
     WorkNode *inNode_ {nullptr};
     WorkNode *outNode_ {nullptr};
+    // Empty nodes kept by this thread for reuse, linked through WorkNode::next_.
+    WorkNode *freeNodes_ {nullptr};
+    uint32_t pushCountSincePost_ {0};
     ProcessQueue *weakQueue_ {nullptr};
     std::vector<SlotNeedUpdate> pendingUpdateSlots_;
     TlabAllocator *allocator_ {nullptr};
@@ -201,7 +248,9 @@ private:
     NO_COPY_SEMANTIC(WorkManager);
     NO_MOVE_SEMANTIC(WorkManager);
 
-    WorkNode *AllocateWorkNode();
+    WorkNode *AllocateWorkNode(uint32_t threadId);
+    WorkNode *AllocateWorkNodeFromSpace();
+    bool ShouldPostTask(uint32_t threadId, bool wasEmpty);
 
     Heap *heap_;
     uint32_t threadNum_;
@@ -14,11 +14,15 @@
  */
 
 #include "ecmascript/napi/include/dfx_jsnapi.h"
+
+#include <fstream>
+
 #include "ecmascript/dfx/cpu_profiler/cpu_profiler.h"
 #include "ecmascript/dfx/hprof/heap_profiler.h"
 #include "ecmascript/base/error_helper.h"
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/mem/c_string.h"
+#include "ecmascript/mem/gc_tracer.h"
 #include "ecmascript/mem/heap-inl.h"
 #include "ecmascript/tooling/interface/file_stream.h"
 
@@ -117,6 +121,28 @@ size_t DFXJSNApi::GetHeapUsedSize(EcmaVM *vm)
     return vm->GetHeap()->GetHeapObjectSize();
 }
 
+void DFXJSNApi::StartGCTrace(EcmaVM *vm, size_t capacity)
+{
+    vm->GetHeap()->GetGCTracer()->Start(capacity);
+}
+
+void DFXJSNApi::StopGCTrace(EcmaVM *vm)
+{
+    vm->GetHeap()->GetGCTracer()->Stop();
+}
+
+bool DFXJSNApi::DumpGCTrace(const EcmaVM *vm, const std::string &filePath)
+{
+    std::ofstream file(filePath, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        LOG(ERROR, RUNTIME) << "DumpGCTrace: open file failed " << filePath;
+        return false;
+    }
+    vm->GetHeap()->GetGCTracer()->Dump(file);
+    file.close();
+    return !file.fail();
+}
+
 #if defined(ECMASCRIPT_SUPPORT_CPUPROFILER)
 void DFXJSNApi::StartCpuProfiler(const EcmaVM *vm, const std::string &fileName)
 {
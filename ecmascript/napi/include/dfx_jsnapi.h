@@ -48,6 +48,10 @@ public:
     static size_t GetArrayBufferSize(EcmaVM *vm);
     static size_t GetHeapTotalSize(EcmaVM *vm);
     static size_t GetHeapUsedSize(EcmaVM *vm);
+    // gc events in the chrome trace event format, the latest capacity ones are kept
+    static void StartGCTrace(EcmaVM *vm, size_t capacity);
+    static void StopGCTrace(EcmaVM *vm);
+    static bool DumpGCTrace(const EcmaVM *vm, const std::string &filePath);
 
     // profile generator
 #if defined(ECMASCRIPT_SUPPORT_CPUPROFILER)
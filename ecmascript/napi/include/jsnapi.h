@@ -929,6 +929,12 @@ public:
     // Memory
     // fixme: Rename SEMI_GC to YOUNG_GC
     static void TriggerGC(const EcmaVM *vm, TRIGGER_GC_TYPE gcType = TRIGGER_GC_TYPE::SEMI_GC);
+    // The js thread of vm is idle for the next deadlineMs milliseconds, the heap may use them for gc work.
+    // Must be called on the js thread, returns before the deadline.
+    static void NotifyIdle(const EcmaVM *vm, int deadlineMs);
+    // Return as much free heap memory to the os as possible right now, critical also compacts the heap first.
+    // Must be called on the js thread.
+    static void NotifyMemoryPressure(const EcmaVM *vm, bool critical = false);
     // Exception
     static void ThrowException(const EcmaVM *vm, Local<JSValueRef> error);
     static Local<ObjectRef> GetAndClearUncaughtException(const EcmaVM *vm);
@@ -161,18 +161,17 @@ EcmaVM *JSNApi::CreateEcmaVM(const JSRuntimeOptions &options)
 
 void JSNApi::DestroyJSVM(EcmaVM *ecmaVm)
 {
-    {
-        os::memory::LockHolder lock(mutex);
-        if (!initialize_) {
-            return;
-        }
-        vmCount_--;
-        if (vmCount_ <= 0) {
-            DestroyMemMapAllocator();
-            initialize_ = false;
-        }
+    os::memory::LockHolder lock(mutex);
+    if (!initialize_) {
+        return;
     }
+    // the vm frees its regions to the allocator, so the allocator is finalized after the vm
     EcmaVM::Destroy(ecmaVm);
+    vmCount_--;
+    if (vmCount_ <= 0) {
+        DestroyMemMapAllocator();
+        initialize_ = false;
+    }
 }
 
 void JSNApi::TriggerGC(const EcmaVM *vm,  TRIGGER_GC_TYPE gcType)
@@ -194,6 +193,20 @@ void JSNApi::TriggerGC(const EcmaVM *vm,  TRIGGER_GC_TYPE gcType)
     }
 }
 
+void JSNApi::NotifyIdle(const EcmaVM *vm, int deadlineMs)
+{
+    if (vm->GetJSThread() != nullptr && vm->IsInitialized()) {
+        vm->NotifyIdle(deadlineMs);
+    }
+}
+
+void JSNApi::NotifyMemoryPressure(const EcmaVM *vm, bool critical)
+{
+    if (vm->GetJSThread() != nullptr && vm->IsInitialized()) {
+        vm->NotifyMemoryPressure(critical);
+    }
+}
+
 void JSNApi::ThrowException(const EcmaVM *vm, Local<JSValueRef> error)
 {
     auto thread = vm->GetJSThread();
@@ -20,6 +20,7 @@
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/js_thread.h"
+#include "ecmascript/mem/heap_region_allocator.h"
 #include "ecmascript/napi/include/jsnapi.h"
 #include "ecmascript/napi/jsnapi_helper.h"
 #include "ecmascript/object_factory.h"
@@ -412,6 +413,33 @@ HWTEST_F_L0(JSNApiTests, ArrayBufferWithBuffer)
     ASSERT_TRUE(isFree);
 }
 
+HWTEST_F_L0(JSNApiTests, NotifyIdle)
+{
+    LocalScope scope(vm_);
+    const int32_t length = 15;
+    Local<ArrayBufferRef> arrayBuffer = ArrayBufferRef::New(vm_, length);
+    JSNApi::TriggerGC(vm_);
+    JSNApi::NotifyIdle(vm_, 0);
+    JSNApi::NotifyIdle(vm_, 16);  // 16 : idle time of a frame in ms
+    ASSERT_TRUE(arrayBuffer->IsArrayBuffer());
+    ASSERT_EQ(arrayBuffer->ByteLength(vm_), length);
+}
+
+HWTEST_F_L0(JSNApiTests, NotifyMemoryPressure)
+{
+    LocalScope scope(vm_);
+    const int32_t length = 15;
+    Local<ArrayBufferRef> arrayBuffer = ArrayBufferRef::New(vm_, length);
+    JSNApi::NotifyMemoryPressure(vm_);
+    JSNApi::NotifyMemoryPressure(vm_, true);
+    ASSERT_TRUE(arrayBuffer->IsArrayBuffer());
+    ASSERT_EQ(arrayBuffer->ByteLength(vm_), length);
+    // a forced shrink leaves no freed region resident
+    const HeapRegionAllocator *regionAllocator = vm_->GetHeap()->GetHeapRegionAllocator();
+    ASSERT_EQ(regionAllocator->GetResidentMemoryUsage(),
+              regionAllocator->GetAnnoMemoryUsage() - regionAllocator->GetDecommittedMemorySize());
+}
+
 HWTEST_F_L0(JSNApiTests, DataView)
 {
     LocalScope scope(vm_);
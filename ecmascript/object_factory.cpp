@@ -317,16 +317,17 @@ void ObjectFactory::NewJSRegExpByteCodeData(const JSHandle<JSRegExp> &regexp, vo
     regexp->SetLength(static_cast<uint32_t>(size));
 }
 
-JSHandle<JSHClass> ObjectFactory::NewEcmaDynClass(uint32_t size, JSType type, const JSHandle<JSTaggedValue> &prototype)
+JSHandle<JSHClass> ObjectFactory::NewEcmaDynClass(uint32_t size, JSType type, const JSHandle<JSTaggedValue> &prototype,
+                                                  uint32_t inlinedProps)
 {
-    JSHandle<JSHClass> newClass = NewEcmaDynClass(size, type);
+    JSHandle<JSHClass> newClass = NewEcmaDynClass(size, type, inlinedProps);
     newClass->SetPrototype(thread_, prototype.GetTaggedValue());
     return newClass;
 }
 
-JSHandle<JSObject> ObjectFactory::NewJSObject(const JSHandle<JSHClass> &jshclass)
+JSHandle<JSObject> ObjectFactory::NewJSObject(const JSHandle<JSHClass> &jshclass, MemSpaceType spaceType)
 {
-    JSHandle<JSObject> obj(thread_, JSObject::Cast(NewDynObject(jshclass)));
+    JSHandle<JSObject> obj(thread_, JSObject::Cast(NewDynObject(jshclass, spaceType)));
     JSHandle<TaggedArray> emptyArray = EmptyArray();
     obj->InitializeHash();
     obj->SetElements(thread_, emptyArray, SKIP_BARRIER);
@@ -334,7 +335,7 @@ JSHandle<JSObject> ObjectFactory::NewJSObject(const JSHandle<JSHClass> &jshclass
     return obj;
 }
 
-JSHandle<TaggedArray> ObjectFactory::CloneProperties(const JSHandle<TaggedArray> &old)
+JSHandle<TaggedArray> ObjectFactory::CloneProperties(const JSHandle<TaggedArray> &old, MemSpaceType spaceType)
 {
     uint32_t newLength = old->GetLength();
     if (newLength == 0) {
@@ -343,7 +344,8 @@ JSHandle<TaggedArray> ObjectFactory::CloneProperties(const JSHandle<TaggedArray>
     NewObjectHook();
     auto klass = old->GetClass();
     size_t size = TaggedArray::ComputeSize(JSTaggedValue::TaggedTypeSize(), newLength);
-    auto header = heap_->AllocateYoungOrHugeObject(klass, size);
+    auto header = spaceType == MemSpaceType::OLD_SPACE ? heap_->AllocateOldOrHugeObject(klass, size) :
+        heap_->AllocateYoungOrHugeObject(klass, size);
     JSHandle<TaggedArray> newArray(thread_, header);
     newArray->SetLength(newLength);
 
@@ -354,19 +356,19 @@ JSHandle<TaggedArray> ObjectFactory::CloneProperties(const JSHandle<TaggedArray>
     return newArray;
 }
 
-JSHandle<JSObject> ObjectFactory::CloneObjectLiteral(JSHandle<JSObject> object)
+JSHandle<JSObject> ObjectFactory::CloneObjectLiteral(JSHandle<JSObject> object, MemSpaceType spaceType)
 {
     NewObjectHook();
     auto klass = JSHandle<JSHClass>(thread_, object->GetClass());
 
-    JSHandle<JSObject> cloneObject = NewJSObject(klass);
+    JSHandle<JSObject> cloneObject = NewJSObject(klass, spaceType);
 
     JSHandle<TaggedArray> elements(thread_, object->GetElements());
-    auto newElements = CloneProperties(elements);
+    auto newElements = CloneProperties(elements, spaceType);
     cloneObject->SetElements(thread_, newElements.GetTaggedValue());
 
     JSHandle<TaggedArray> properties(thread_, object->GetProperties());
-    auto newProperties = CloneProperties(properties);
+    auto newProperties = CloneProperties(properties, spaceType);
     cloneObject->SetProperties(thread_, newProperties.GetTaggedValue());
 
     for (uint32_t i = 0; i < klass->GetInlinedProperties(); i++) {
@@ -375,20 +377,22 @@ JSHandle<JSObject> ObjectFactory::CloneObjectLiteral(JSHandle<JSObject> object)
     return cloneObject;
 }
 
-JSHandle<JSArray> ObjectFactory::CloneArrayLiteral(JSHandle<JSArray> object)
+JSHandle<JSArray> ObjectFactory::CloneArrayLiteral(JSHandle<JSArray> object, MemSpaceType spaceType)
 {
     NewObjectHook();
     auto klass = JSHandle<JSHClass>(thread_, object->GetClass());
 
-    JSHandle<JSArray> cloneObject(NewJSObject(klass));
+    JSHandle<JSArray> cloneObject(NewJSObject(klass, spaceType));
     cloneObject->SetArrayLength(thread_, object->GetArrayLength());
 
     JSHandle<TaggedArray> elements(thread_, object->GetElements());
-    auto newElements = CopyArray(elements, elements->GetLength(), elements->GetLength());
+    auto newElements = CopyArray(elements, elements->GetLength(), elements->GetLength(), JSTaggedValue::Hole(),
+                                 spaceType);
     cloneObject->SetElements(thread_, newElements.GetTaggedValue());
 
     JSHandle<TaggedArray> properties(thread_, object->GetProperties());
-    auto newProperties = CopyArray(properties, properties->GetLength(), properties->GetLength());
+    auto newProperties = CopyArray(properties, properties->GetLength(), properties->GetLength(),
+                                   JSTaggedValue::Hole(), spaceType);
     cloneObject->SetProperties(thread_, newProperties.GetTaggedValue());
 
     for (uint32_t i = 0; i < klass->GetInlinedProperties(); i++) {
@@ -966,10 +970,11 @@ FreeObject *ObjectFactory::FillFreeObject(uintptr_t address, size_t size, Remove
     return object;
 }
 
-TaggedObject *ObjectFactory::NewDynObject(const JSHandle<JSHClass> &dynclass)
+TaggedObject *ObjectFactory::NewDynObject(const JSHandle<JSHClass> &dynclass, MemSpaceType spaceType)
 {
     NewObjectHook();
-    TaggedObject *header = heap_->AllocateYoungOrHugeObject(*dynclass);
+    TaggedObject *header = spaceType == MemSpaceType::OLD_SPACE ? heap_->AllocateOldOrHugeObject(*dynclass) :
+        heap_->AllocateYoungOrHugeObject(*dynclass);
     uint32_t inobjPropCount = dynclass->GetInlinedProperties();
     if (inobjPropCount > 0) {
         InitializeExtraProperties(dynclass, header, inobjPropCount);
@@ -1729,7 +1734,7 @@ JSHandle<TaggedArray> ObjectFactory::CopyPartArray(const JSHandle<TaggedArray> &
 
 JSHandle<TaggedArray> ObjectFactory::CopyArray(const JSHandle<TaggedArray> &old,
                                                [[maybe_unused]] uint32_t oldLength, uint32_t newLength,
-                                               JSTaggedValue initVal)
+                                               JSTaggedValue initVal, MemSpaceType spaceType)
 {
     if (newLength == 0) {
         return EmptyArray();
@@ -1740,8 +1745,9 @@ JSHandle<TaggedArray> ObjectFactory::CopyArray(const JSHandle<TaggedArray> &old,
 
     NewObjectHook();
     size_t size = TaggedArray::ComputeSize(JSTaggedValue::TaggedTypeSize(), newLength);
-    auto header = heap_->AllocateYoungOrHugeObject(
-        JSHClass::Cast(thread_->GlobalConstants()->GetArrayClass().GetTaggedObject()), size);
+    JSHClass *arrayClass = JSHClass::Cast(thread_->GlobalConstants()->GetArrayClass().GetTaggedObject());
+    auto header = spaceType == MemSpaceType::OLD_SPACE ? heap_->AllocateOldOrHugeObject(arrayClass, size) :
+        heap_->AllocateYoungOrHugeObject(arrayClass, size);
     JSHandle<TaggedArray> newArray(thread_, header);
     newArray->SetLength(newLength);
 
@@ -1755,9 +1761,15 @@ JSHandle<TaggedArray> ObjectFactory::CopyArray(const JSHandle<TaggedArray> &old,
 
 JSHandle<LayoutInfo> ObjectFactory::CreateLayoutInfo(int properties, JSTaggedValue initVal)
 {
-    uint32_t arrayLength = LayoutInfo::ComputeArrayLength(LayoutInfo::ComputeGrowCapacity(properties));
+    uint32_t capacity = LayoutInfo::ComputeGrowCapacity(properties);
+    uint32_t arrayLength = LayoutInfo::ComputeArrayLength(capacity);
     JSHandle<LayoutInfo> layoutInfoHandle = JSHandle<LayoutInfo>::Cast(NewTaggedArray(arrayLength, initVal));
     layoutInfoHandle->SetNumberOfElements(thread_, 0);
+    layoutInfoHandle->SetHashIndex(thread_, JSTaggedValue::Hole());
+    if (LayoutInfo::NeedsHashIndex(capacity)) {
+        JSHandle<TaggedArray> hashIndex = NewTaggedArray(LayoutInfo::ComputeHashIndexLength(capacity));
+        layoutInfoHandle->SetHashIndex(thread_, hashIndex.GetTaggedValue());
+    }
     return layoutInfoHandle;
 }
 
@@ -1765,14 +1777,29 @@ JSHandle<LayoutInfo> ObjectFactory::ExtendLayoutInfo(const JSHandle<LayoutInfo>
                                                      JSTaggedValue initVal)
 {
     ASSERT(properties > old->NumberOfElements());
-    uint32_t arrayLength = LayoutInfo::ComputeArrayLength(LayoutInfo::ComputeGrowCapacity(properties));
-    return JSHandle<LayoutInfo>(ExtendArray(JSHandle<TaggedArray>(old), arrayLength, initVal));
+    uint32_t capacity = LayoutInfo::ComputeGrowCapacity(properties);
+    uint32_t arrayLength = LayoutInfo::ComputeArrayLength(capacity);
+    JSHandle<LayoutInfo> newLayoutInfo(ExtendArray(JSHandle<TaggedArray>(old), arrayLength, initVal));
+    // the old layout may be extended once more by another transition, so the index is not shared
+    newLayoutInfo->SetHashIndex(thread_, JSTaggedValue::Hole());
+    if (LayoutInfo::NeedsHashIndex(capacity)) {
+        JSHandle<TaggedArray> hashIndex = NewTaggedArray(LayoutInfo::ComputeHashIndexLength(capacity));
+        newLayoutInfo->SetHashIndex(thread_, hashIndex.GetTaggedValue());
+        newLayoutInfo->BuildHashIndex(thread_);
+    }
+    return newLayoutInfo;
 }
 
 JSHandle<LayoutInfo> ObjectFactory::CopyLayoutInfo(const JSHandle<LayoutInfo> &old)
 {
     uint32_t newLength = old->GetLength();
-    return JSHandle<LayoutInfo>(CopyArray(JSHandle<TaggedArray>::Cast(old), newLength, newLength));
+    JSHandle<LayoutInfo> newLayoutInfo(CopyArray(JSHandle<TaggedArray>::Cast(old), newLength, newLength));
+    if (newLayoutInfo->HasHashIndex()) {
+        JSHandle<TaggedArray> hashIndex(thread_, newLayoutInfo->GetHashIndex());
+        uint32_t indexLength = hashIndex->GetLength();
+        newLayoutInfo->SetHashIndex(thread_, CopyArray(hashIndex, indexLength, indexLength).GetTaggedValue());
+    }
+    return newLayoutInfo;
 }
 
 JSHandle<LayoutInfo> ObjectFactory::CopyAndReSort(const JSHandle<LayoutInfo> &old, int end, int capacity)
@@ -266,8 +266,10 @@ public:
                                       JSTaggedValue initVal = JSTaggedValue::Hole());
     JSHandle<TaggedArray> CopyPartArray(const JSHandle<TaggedArray> &old, uint32_t start, uint32_t end);
     JSHandle<TaggedArray> CopyArray(const JSHandle<TaggedArray> &old, uint32_t oldLength, uint32_t newLength,
-                                    JSTaggedValue initVal = JSTaggedValue::Hole());
-    JSHandle<TaggedArray> CloneProperties(const JSHandle<TaggedArray> &old);
+                                    JSTaggedValue initVal = JSTaggedValue::Hole(),
+                                    MemSpaceType spaceType = MemSpaceType::SEMI_SPACE);
+    JSHandle<TaggedArray> CloneProperties(const JSHandle<TaggedArray> &old,
+                                          MemSpaceType spaceType = MemSpaceType::SEMI_SPACE);
     JSHandle<TaggedArray> CloneProperties(const JSHandle<TaggedArray> &old, const JSHandle<JSTaggedValue> &env,
                                           const JSHandle<JSObject> &obj, const JSHandle<JSTaggedValue> &constpool);
 
@@ -286,7 +288,7 @@ public:
 
     FreeObject *FillFreeObject(uintptr_t address, size_t size, RemoveSlots removeSlots = RemoveSlots::NO);
 
-    TaggedObject *NewDynObject(const JSHandle<JSHClass> &dynclass);
+    TaggedObject *NewDynObject(const JSHandle<JSHClass> &dynclass, MemSpaceType spaceType = MemSpaceType::SEMI_SPACE);
 
     TaggedObject *NewNonMovableDynObject(const JSHandle<JSHClass> &dynclass, int inobjPropCount = 0);
 
@@ -314,8 +316,9 @@ public:
 
     JSHandle<JSObject> CloneObjectLiteral(JSHandle<JSObject> object, const JSHandle<JSTaggedValue> &env,
                                           const JSHandle<JSTaggedValue> &constpool, bool canShareHClass = true);
-    JSHandle<JSObject> CloneObjectLiteral(JSHandle<JSObject> object);
-    JSHandle<JSArray> CloneArrayLiteral(JSHandle<JSArray> object);
+    // the pretenured literals of hot allocation sites are cloned into the old space
+    JSHandle<JSObject> CloneObjectLiteral(JSHandle<JSObject> object, MemSpaceType spaceType = MemSpaceType::SEMI_SPACE);
+    JSHandle<JSArray> CloneArrayLiteral(JSHandle<JSArray> object, MemSpaceType spaceType = MemSpaceType::SEMI_SPACE);
     JSHandle<JSFunction> CloneJSFuction(JSHandle<JSFunction> obj, FunctionKind kind);
     JSHandle<JSFunction> CloneClassCtor(JSHandle<JSFunction> ctor, const JSHandle<JSTaggedValue> &lexenv,
                                         bool canShareHClass);
@@ -401,10 +404,12 @@ public:
                                           const JSHandle<EcmaString> &secondString);
 
     // used for creating Function
-    JSHandle<JSObject> NewJSObject(const JSHandle<JSHClass> &jshclass);
+    JSHandle<JSObject> NewJSObject(const JSHandle<JSHClass> &jshclass,
+                                   MemSpaceType spaceType = MemSpaceType::SEMI_SPACE);
 
     // used for creating jshclass in Builtins, Function, Class_Linker
-    JSHandle<JSHClass> NewEcmaDynClass(uint32_t size, JSType type, const JSHandle<JSTaggedValue> &prototype);
+    JSHandle<JSHClass> NewEcmaDynClass(uint32_t size, JSType type, const JSHandle<JSTaggedValue> &prototype,
+                                       uint32_t inlinedProps = JSHClass::DEFAULT_CAPACITY_OF_IN_OBJECTS);
 
     // It is used to provide iterators for non ECMA standard jsapi containers.
     JSHandle<JSAPIPlainArray> NewJSAPIPlainArray(array_size_t capacity);
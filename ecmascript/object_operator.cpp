@@ -402,6 +402,7 @@ bool ObjectOperator::UpdateDataValue(const JSHandle<JSObject> &receiver, const J
         TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
         if (!elements->IsDictionaryMode()) {
             elements->Set(thread_, GetIndex(), value.GetTaggedValue());
+            JSHClass::UpdateElementsKind(thread_, receiver, TaggedToElementsKind(value.GetTaggedValue()));
             return true;
         }
 
@@ -555,7 +556,7 @@ void ObjectOperator::WriteElement(const JSHandle<JSObject> &receiver, JSTaggedVa
     TaggedArray *elements = TaggedArray::Cast(receiver->GetElements().GetTaggedObject());
     if (!elements->IsDictionaryMode()) {
         elements->Set(thread_, index_, value);
-        receiver->GetJSHClass()->UpdateRepresentation(value);
+        JSHClass::UpdateElementsKind(thread_, receiver, TaggedToElementsKind(value));
         return;
     }
 
@@ -669,6 +670,7 @@ void ObjectOperator::AddPropertyInternal(const JSHandle<JSTaggedValue> &value)
         JSHandle<GlobalDictionary> properties =
             GlobalDictionary::PutIfAbsent(thread_, dict, key_, JSHandle<JSTaggedValue>(cellHandle), attr);
         obj->SetProperties(thread_, properties);
+        JSHClass::NotifyGlobalBindingAdded(thread_, obj.GetTaggedValue());
         // index and fastMode is not essential for global obj;
         SetFound(0, cellHandle.GetTaggedValue(), attr.GetValue(), true);
         return;
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "ecmascript/pgo_profiler/pgo_profiler.h"
+#include "libpandabase/utils/pandargs.h"
+
+// Merges the pgo profiles dumped by several processes into one file for the aot compiler:
+//     ark_ap_merge --output merged.ap a.ap:b.ap:c.ap
+namespace panda::ecmascript {
+int Main(const int argc, const char **argv)
+{
+    panda::PandArg<bool> help("help", false, "Print this message and exit");
+    panda::PandArg<std::string> output("output", "", "path of the merged profile");
+    // tail arguments
+    panda::PandArg<arg_list_t> files("files", {""}, "paths of the profiles to merge", ":");
+    panda::PandArgParser paParser;
+
+    paParser.Add(&help);
+    paParser.Add(&output);
+    paParser.PushBackTail(&files);
+    paParser.EnableTail();
+
+    if (!paParser.Parse(argc, argv) || files.GetValue().empty() || output.GetValue().empty() || help.GetValue()) {
+        std::cerr << paParser.GetErrorString() << std::endl;
+        std::cerr << "Usage: ark_ap_merge --output [merged profile] [profile1:profile2:profile3]" << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "optional arguments:" << std::endl;
+        std::cerr << paParser.GetHelpString() << std::endl;
+        return 1;
+    }
+
+    PGOProfile merged;
+    for (const auto &fileName : files.GetValue()) {
+        PGOProfile profile;
+        if (!profile.Load(fileName)) {
+            std::cerr << "Cannot load pgo profile '" << fileName << "'" << std::endl;
+            return -1;
+        }
+        merged.Merge(profile);
+    }
+    paParser.DisableTail();
+    if (!merged.Save(output.GetValue())) {
+        std::cerr << "Cannot save pgo profile '" << output.GetValue() << "'" << std::endl;
+        return -1;
+    }
+    return 0;
+}
+}  // namespace panda::ecmascript
+
+int main(int argc, const char **argv)
+{
+    return panda::ecmascript::Main(argc, argv);
+}
@@ -0,0 +1,525 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/pgo_profiler/pgo_profiler.h"
+
+#include <algorithm>
+#include <csignal>
+#include <fstream>
+#include <limits>
+
+#include "ecmascript/base/string_helper.h"
+#include "ecmascript/ecma_macros.h"
+#include "ecmascript/interpreter/frame_handler.h"
+#include "ecmascript/js_hclass-inl.h"
+#include "ecmascript/js_method.h"
+#include "ecmascript/jspandafile/js_pandafile.h"
+#include "ecmascript/layout_info-inl.h"
+#include "libpandafile/file.h"
+
+namespace panda::ecmascript {
+namespace {
+// on-disk layout, all fields in host byte order:
+//     FileHeader
+//     numLayouts times: LayoutHeader, then numKeys times a uint32_t length and the bytes of the key
+//     numPandaFiles times: PandaFileHeader, then numMethods times:
+//         MethodHeader
+//         numCallSites CallSiteRecords
+//         numICSites times: ICSiteRecord, then numLayouts uint32_t layout indexes
+//         numBranches BranchRecords
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t numLayouts;
+    uint32_t numPandaFiles;
+};
+
+struct LayoutHeader {
+    uint32_t objectType;
+    uint32_t isDictionary;
+    uint32_t numKeys;
+};
+
+struct PandaFileHeader {
+    uint32_t checksum;
+    uint32_t numMethods;
+};
+
+struct MethodHeader {
+    uint32_t methodId;
+    uint32_t numCallSites;
+    uint32_t numICSites;
+    uint32_t numBranches;
+};
+
+struct CallSiteRecord {
+    uint32_t offset;
+    uint32_t calleeMethodId;
+    uint32_t count;
+    uint32_t isMono;
+};
+
+struct ICSiteRecord {
+    uint32_t slotId;
+    uint32_t kind;
+    uint32_t state;
+    uint32_t numLayouts;
+};
+
+struct BranchRecord {
+    uint32_t offset;
+    uint32_t taken;
+    uint32_t notTaken;
+};
+
+// property keys longer than this are taken as a sign of a corrupted file
+constexpr uint32_t MAX_KEY_LENGTH = 1U << 16U;
+
+template<typename T>
+void WriteRecord(std::ofstream &out, const T &record)
+{
+    out.write(reinterpret_cast<const char *>(&record), sizeof(T));
+}
+
+template<typename T>
+bool ReadRecord(std::ifstream &in, T *record)
+{
+    in.read(reinterpret_cast<char *>(record), sizeof(T));
+    return in.good();
+}
+
+void WriteString(std::ofstream &out, const std::string &str)
+{
+    WriteRecord(out, static_cast<uint32_t>(str.size()));
+    out.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+bool ReadString(std::ifstream &in, std::string *str)
+{
+    uint32_t length = 0;
+    if (!ReadRecord(in, &length) || length > MAX_KEY_LENGTH) {
+        return false;
+    }
+    str->resize(length);
+    in.read(str->data(), static_cast<std::streamsize>(length));
+    return in.good();
+}
+
+// counters of merged profiles stick at the maximum instead of wrapping around
+uint32_t SaturatingAdd(uint32_t left, uint32_t right)
+{
+    return left > std::numeric_limits<uint32_t>::max() - right ? std::numeric_limits<uint32_t>::max() : left + right;
+}
+
+void AddLayoutIndex(PGOProfile::ICSiteInfo *info, uint32_t index)
+{
+    if (std::find(info->layouts.begin(), info->layouts.end(), index) == info->layouts.end()) {
+        info->layouts.emplace_back(index);
+    }
+    if (info->layouts.size() > 1 && info->state == ProfileTypeAccessor::ICState::MONO) {
+        info->state = ProfileTypeAccessor::ICState::POLY;
+    }
+}
+}  // namespace
+
+void PGOProfile::RecordCall(uint32_t checksum, uint32_t methodId, uint32_t offset, uint32_t calleeMethodId)
+{
+    auto [iter, inserted] = methods_[checksum][methodId].callSites.try_emplace(offset);
+    CallSiteInfo &info = iter->second;
+    if (inserted) {
+        info.calleeMethodId = calleeMethodId;
+    } else if (info.calleeMethodId != calleeMethodId) {
+        info.isMono = false;
+    }
+    info.count = SaturatingAdd(info.count, 1);
+}
+
+void PGOProfile::RecordIC(uint32_t checksum, uint32_t methodId, uint32_t slotId, ICKind kind,
+                          ProfileTypeAccessor::ICState state, const std::vector<HClassLayout> &layouts)
+{
+    auto [iter, inserted] = methods_[checksum][methodId].icSites.try_emplace(slotId);
+    ICSiteInfo &info = iter->second;
+    if (inserted) {
+        info.kind = kind;
+    }
+    info.state = std::max(info.state, state);
+    for (const auto &layout : layouts) {
+        AddLayoutIndex(&info, AddLayout(layout));
+    }
+}
+
+void PGOProfile::RecordBranch(uint32_t checksum, uint32_t methodId, uint32_t offset, bool taken)
+{
+    BranchInfo &info = methods_[checksum][methodId].branches[offset];
+    if (taken) {
+        info.taken = SaturatingAdd(info.taken, 1);
+    } else {
+        info.notTaken = SaturatingAdd(info.notTaken, 1);
+    }
+}
+
+const PGOProfile::MethodProfile *PGOProfile::FindMethod(uint32_t checksum, uint32_t methodId) const
+{
+    auto fileIter = methods_.find(checksum);
+    if (fileIter == methods_.end()) {
+        return nullptr;
+    }
+    auto methodIter = fileIter->second.find(methodId);
+    if (methodIter == fileIter->second.end()) {
+        return nullptr;
+    }
+    return &methodIter->second;
+}
+
+const PGOProfile::CallSiteInfo *PGOProfile::GetMonoCallTarget(uint32_t checksum, uint32_t methodId,
+                                                              uint32_t offset) const
+{
+    const MethodProfile *method = FindMethod(checksum, methodId);
+    if (method == nullptr) {
+        return nullptr;
+    }
+    auto siteIter = method->callSites.find(offset);
+    if (siteIter == method->callSites.end() || !siteIter->second.isMono) {
+        return nullptr;
+    }
+    return &siteIter->second;
+}
+
+const PGOProfile::ICSiteInfo *PGOProfile::GetICSite(uint32_t checksum, uint32_t methodId, uint32_t slotId) const
+{
+    const MethodProfile *method = FindMethod(checksum, methodId);
+    if (method == nullptr) {
+        return nullptr;
+    }
+    auto siteIter = method->icSites.find(slotId);
+    return siteIter == method->icSites.end() ? nullptr : &siteIter->second;
+}
+
+const PGOProfile::BranchInfo *PGOProfile::GetBranch(uint32_t checksum, uint32_t methodId, uint32_t offset) const
+{
+    const MethodProfile *method = FindMethod(checksum, methodId);
+    if (method == nullptr) {
+        return nullptr;
+    }
+    auto branchIter = method->branches.find(offset);
+    return branchIter == method->branches.end() ? nullptr : &branchIter->second;
+}
+
+uint32_t PGOProfile::AddLayout(const HClassLayout &layout)
+{
+    auto [iter, inserted] = layoutIndexes_.try_emplace(layout, static_cast<uint32_t>(layouts_.size()));
+    if (inserted) {
+        layouts_.emplace_back(layout);
+    }
+    return iter->second;
+}
+
+void PGOProfile::Merge(const PGOProfile &other)
+{
+    for (const auto &[checksum, methods] : other.methods_) {
+        for (const auto &[methodId, otherMethod] : methods) {
+            MethodProfile &method = methods_[checksum][methodId];
+            for (const auto &[offset, otherInfo] : otherMethod.callSites) {
+                auto [iter, inserted] = method.callSites.try_emplace(offset, otherInfo);
+                if (inserted) {
+                    continue;
+                }
+                CallSiteInfo &info = iter->second;
+                info.isMono = info.isMono && otherInfo.isMono && info.calleeMethodId == otherInfo.calleeMethodId;
+                info.count = SaturatingAdd(info.count, otherInfo.count);
+            }
+            for (const auto &[slotId, otherInfo] : otherMethod.icSites) {
+                auto [iter, inserted] = method.icSites.try_emplace(slotId);
+                ICSiteInfo &info = iter->second;
+                if (inserted) {
+                    info.kind = otherInfo.kind;
+                }
+                info.state = std::max(info.state, otherInfo.state);
+                for (uint32_t index : otherInfo.layouts) {
+                    AddLayoutIndex(&info, AddLayout(other.layouts_[index]));
+                }
+            }
+            for (const auto &[offset, otherInfo] : otherMethod.branches) {
+                BranchInfo &info = method.branches[offset];
+                info.taken = SaturatingAdd(info.taken, otherInfo.taken);
+                info.notTaken = SaturatingAdd(info.notTaken, otherInfo.notTaken);
+            }
+        }
+    }
+}
+
+bool PGOProfile::Save(const std::string &path) const
+{
+    std::ofstream out(path, std::ofstream::binary | std::ofstream::trunc);
+    if (!out.good()) {
+        LOG_ECMA(ERROR) << "Cannot open pgo profile '" << path << "' for writing";
+        return false;
+    }
+    WriteRecord(out, FileHeader {MAGIC, VERSION, static_cast<uint32_t>(layouts_.size()),
+                                 static_cast<uint32_t>(methods_.size())});
+    for (const auto &layout : layouts_) {
+        WriteRecord(out, LayoutHeader {layout.objectType, static_cast<uint32_t>(layout.isDictionary),
+                                       static_cast<uint32_t>(layout.keys.size())});
+        for (const auto &key : layout.keys) {
+            WriteString(out, key);
+        }
+    }
+    for (const auto &[checksum, methods] : methods_) {
+        WriteRecord(out, PandaFileHeader {checksum, static_cast<uint32_t>(methods.size())});
+        for (const auto &[methodId, method] : methods) {
+            WriteRecord(out, MethodHeader {methodId, static_cast<uint32_t>(method.callSites.size()),
+                                           static_cast<uint32_t>(method.icSites.size()),
+                                           static_cast<uint32_t>(method.branches.size())});
+            for (const auto &[offset, info] : method.callSites) {
+                WriteRecord(out, CallSiteRecord {offset, info.calleeMethodId, info.count,
+                                                 static_cast<uint32_t>(info.isMono)});
+            }
+            for (const auto &[slotId, info] : method.icSites) {
+                WriteRecord(out, ICSiteRecord {slotId, static_cast<uint32_t>(info.kind),
+                                               static_cast<uint32_t>(info.state),
+                                               static_cast<uint32_t>(info.layouts.size())});
+                for (uint32_t index : info.layouts) {
+                    WriteRecord(out, index);
+                }
+            }
+            for (const auto &[offset, info] : method.branches) {
+                WriteRecord(out, BranchRecord {offset, info.taken, info.notTaken});
+            }
+        }
+    }
+    return out.good();
+}
+
+bool PGOProfile::Load(const std::string &path)
+{
+    Clear();
+    std::ifstream in(path, std::ifstream::binary);
+    FileHeader header {};
+    if (!ReadRecord(in, &header) || header.magic != MAGIC || header.version != VERSION) {
+        LOG_ECMA(ERROR) << "'" << path << "' is not a pgo profile of version " << VERSION;
+        return false;
+    }
+    for (uint32_t i = 0; i < header.numLayouts; i++) {
+        LayoutHeader layoutHeader {};
+        if (!ReadRecord(in, &layoutHeader)) {
+            return OnTruncated(path);
+        }
+        HClassLayout layout {layoutHeader.objectType, layoutHeader.isDictionary != 0, {}};
+        for (uint32_t j = 0; j < layoutHeader.numKeys; j++) {
+            std::string key;
+            if (!ReadString(in, &key)) {
+                return OnTruncated(path);
+            }
+            layout.keys.emplace_back(std::move(key));
+        }
+        // indexes in the file are positions in the layout table, so duplicates must keep their own entry
+        layoutIndexes_.try_emplace(layout, static_cast<uint32_t>(layouts_.size()));
+        layouts_.emplace_back(std::move(layout));
+    }
+    for (uint32_t i = 0; i < header.numPandaFiles; i++) {
+        PandaFileHeader fileHeader {};
+        if (!ReadRecord(in, &fileHeader)) {
+            return OnTruncated(path);
+        }
+        auto &methods = methods_[fileHeader.checksum];
+        for (uint32_t j = 0; j < fileHeader.numMethods; j++) {
+            MethodHeader methodHeader {};
+            if (!ReadRecord(in, &methodHeader)) {
+                return OnTruncated(path);
+            }
+            MethodProfile &method = methods[methodHeader.methodId];
+            for (uint32_t k = 0; k < methodHeader.numCallSites; k++) {
+                CallSiteRecord record {};
+                if (!ReadRecord(in, &record)) {
+                    return OnTruncated(path);
+                }
+                method.callSites[record.offset] = {record.calleeMethodId, record.count, record.isMono != 0};
+            }
+            for (uint32_t k = 0; k < methodHeader.numICSites; k++) {
+                ICSiteRecord record {};
+                if (!ReadRecord(in, &record) ||
+                    record.state > static_cast<uint32_t>(ProfileTypeAccessor::ICState::MEGA) ||
+                    record.kind > static_cast<uint32_t>(ICKind::GlobalStoreIC)) {
+                    return OnTruncated(path);
+                }
+                ICSiteInfo &info = method.icSites[record.slotId];
+                info.kind = static_cast<ICKind>(record.kind);
+                info.state = static_cast<ProfileTypeAccessor::ICState>(record.state);
+                for (uint32_t l = 0; l < record.numLayouts; l++) {
+                    uint32_t index = 0;
+                    if (!ReadRecord(in, &index) || index >= layouts_.size()) {
+                        return OnTruncated(path);
+                    }
+                    info.layouts.emplace_back(index);
+                }
+            }
+            for (uint32_t k = 0; k < methodHeader.numBranches; k++) {
+                BranchRecord record {};
+                if (!ReadRecord(in, &record)) {
+                    return OnTruncated(path);
+                }
+                method.branches[record.offset] = {record.taken, record.notTaken};
+            }
+        }
+    }
+    return true;
+}
+
+void PGOProfile::Clear()
+{
+    methods_.clear();
+    layouts_.clear();
+    layoutIndexes_.clear();
+}
+
+bool PGOProfile::OnTruncated(const std::string &path)
+{
+    Clear();
+    LOG_ECMA(ERROR) << "pgo profile '" << path << "' is truncated or corrupted";
+    return false;
+}
+
+uint32_t PGOProfile::GetChecksum(const JSPandaFile *jsPandaFile)
+{
+    return jsPandaFile->GetPandaFile()->GetHeader()->checksum;
+}
+
+std::atomic<bool> PGOProfiler::dumpRequested_ {false};
+
+PGOProfiler::PGOProfiler(std::string outputFile) : outputFile_(std::move(outputFile))
+{
+#if defined(PANDA_TARGET_UNIX)
+    struct sigaction sa {};
+    sa.sa_handler = &PGOProfiler::DumpSignalHandler;
+    if (sigemptyset(&sa.sa_mask) != 0) {
+        LOG_ECMA(ERROR) << "pgo profiler cannot initialize the signal mask, dump on SIGUSR2 is disabled";
+        return;
+    }
+    sa.sa_flags = SA_RESTART;
+    if (sigaction(SIGUSR2, &sa, nullptr) != 0) {
+        LOG_ECMA(ERROR) << "pgo profiler cannot install the SIGUSR2 handler, dump on SIGUSR2 is disabled";
+    }
+#endif
+}
+
+void PGOProfiler::DumpSignalHandler([[maybe_unused]] int signo)
+{
+    dumpRequested_.store(true, std::memory_order_relaxed);
+}
+
+void PGOProfiler::ProfileCall(const JSMethod *caller, const uint8_t *pc, const JSMethod *callee)
+{
+    DumpIfRequested();
+    const JSPandaFile *jsPandaFile = caller->GetJSPandaFile();
+    if (jsPandaFile == nullptr || callee->GetJSPandaFile() != jsPandaFile) {
+        return;
+    }
+    auto offset = static_cast<uint32_t>(pc - caller->GetBytecodeArray());
+    profile_.RecordCall(PGOProfile::GetChecksum(jsPandaFile), caller->GetMethodId().GetOffset(), offset,
+                        callee->GetMethodId().GetOffset());
+}
+
+void PGOProfiler::ProfileBranch(const JSMethod *method, const uint8_t *pc, bool taken)
+{
+    DumpIfRequested();
+    const JSPandaFile *jsPandaFile = method->GetJSPandaFile();
+    if (jsPandaFile == nullptr) {
+        return;
+    }
+    auto offset = static_cast<uint32_t>(pc - method->GetBytecodeArray());
+    profile_.RecordBranch(PGOProfile::GetChecksum(jsPandaFile), method->GetMethodId().GetOffset(), offset, taken);
+}
+
+void PGOProfiler::ProfileIC(JSThread *thread, JSHandle<ProfileTypeInfo> profileTypeInfo, uint32_t slotId,
+                            ICKind kind)
+{
+    FrameHandler frameHandler(thread);
+    if (!frameHandler.HasFrame() || !frameHandler.IsInterpretedFrame()) {
+        return;
+    }
+    const JSMethod *method = frameHandler.GetMethod();
+    const JSPandaFile *jsPandaFile = method->GetJSPandaFile();
+    if (jsPandaFile == nullptr) {
+        return;
+    }
+    ProfileTypeAccessor accessor(thread, profileTypeInfo, slotId, kind);
+    ProfileTypeAccessor::ICState state = accessor.GetICState();
+
+    // the hclasses sit at the even positions of the (hclass, handler) pairs of a slot; keyed ics keep their key in
+    // the first slot and the pairs in the second
+    std::vector<PGOProfile::HClassLayout> layouts;
+    auto collectLayouts = [&layouts](JSTaggedValue value) {
+        if (value.IsWeak()) {
+            layouts.emplace_back(GetLayout(JSHClass::Cast(value.GetWeakReferentUnChecked())));
+            return;
+        }
+        if (!value.IsTaggedArray()) {
+            return;
+        }
+        TaggedArray *array = TaggedArray::Cast(value.GetTaggedObject());
+        for (uint32_t i = 0; i < array->GetLength(); i += 2) {  // 2: hclass and handler
+            JSTaggedValue hclass = array->Get(i);
+            if (hclass.IsWeak()) {
+                layouts.emplace_back(GetLayout(JSHClass::Cast(hclass.GetWeakReferentUnChecked())));
+            }
+        }
+    };
+    if (state == ProfileTypeAccessor::ICState::MONO || state == ProfileTypeAccessor::ICState::POLY) {
+        JSTaggedValue first = profileTypeInfo->Get(slotId);
+        switch (kind) {
+            case ICKind::NamedLoadIC:
+            case ICKind::NamedStoreIC:
+                collectLayouts(first);
+                break;
+            case ICKind::LoadIC:
+            case ICKind::StoreIC:
+                collectLayouts((first.IsWeak() || first.IsTaggedArray()) ? first : profileTypeInfo->Get(slotId + 1));
+                break;
+            default:
+                // global ics cache property boxes and keys, not hclasses
+                break;
+        }
+    }
+    profile_.RecordIC(PGOProfile::GetChecksum(jsPandaFile), method->GetMethodId().GetOffset(), slotId, kind, state,
+                      layouts);
+}
+
+PGOProfile::HClassLayout PGOProfiler::GetLayout(const JSHClass *hclass)
+{
+    PGOProfile::HClassLayout layout;
+    layout.objectType = static_cast<uint32_t>(hclass->GetObjectType());
+    if (hclass->IsDictionaryMode()) {
+        layout.isDictionary = true;
+        return layout;
+    }
+    LayoutInfo *layoutInfo = LayoutInfo::Cast(hclass->GetLayout().GetTaggedObject());
+    uint32_t numberOfProps = hclass->NumberOfProps();
+    for (uint32_t i = 0; i < numberOfProps; i++) {
+        JSTaggedValue key = layoutInfo->GetKey(static_cast<int>(i));
+        layout.keys.emplace_back(key.IsString() ? base::StringHelper::ToStdString(EcmaString::Cast(
+            key.GetTaggedObject())) : "");
+    }
+    return layout;
+}
+
+void PGOProfiler::Dump() const
+{
+    if (outputFile_.empty()) {
+        LOG_ECMA(ERROR) << "pgo profiler is enabled but --pgo-profile-file is not set";
+        return;
+    }
+    profile_.Save(outputFile_);
+}
+}  // namespace panda::ecmascript
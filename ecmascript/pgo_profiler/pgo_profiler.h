@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_PGO_PROFILER_PGO_PROFILER_H
+#define ECMASCRIPT_PGO_PROFILER_PGO_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "ecmascript/ic/profile_type_info.h"
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript {
+class JSHClass;
+class JSPandaFile;
+class JSThread;
+struct JSMethod;
+
+// Feedback of an instrumented run, keyed by the checksum of the panda file and the id of the method it was seen in:
+//     call sites      callee method id per call bytecode offset; only callees from the caller's panda file are kept
+//     ic sites        final ICKind/ICState per ic slot id, with the layouts of the hclasses the ic was patched for
+//     branches        taken/not taken counts per conditional jump bytecode offset
+// HClass layouts are shared by all ic sites of the profile and referenced by index. Profiles of several runs of the
+// same panda files can be merged into one.
+class PGOProfile {
+public:
+    static constexpr uint32_t MAGIC = 0x504F4750;  // "PGOP"
+    static constexpr uint32_t VERSION = 2;
+
+    struct CallSiteInfo {
+        uint32_t calleeMethodId {0};
+        uint32_t count {0};
+        // false once a second callee was seen
+        bool isMono {true};
+    };
+
+    // the part of a JSHClass the compiler can check against: object type and the keys of its properties in layout
+    // order. Symbol keys are recorded as empty strings and dictionary hclasses without keys.
+    struct HClassLayout {
+        uint32_t objectType {0};
+        bool isDictionary {false};
+        std::vector<std::string> keys {};
+
+        bool operator<(const HClassLayout &other) const
+        {
+            return std::tie(objectType, isDictionary, keys) <
+                std::tie(other.objectType, other.isDictionary, other.keys);
+        }
+    };
+
+    struct ICSiteInfo {
+        ICKind kind {ICKind::NamedLoadIC};
+        ProfileTypeAccessor::ICState state {ProfileTypeAccessor::ICState::UNINIT};
+        // indexes into the layouts of the profile
+        std::vector<uint32_t> layouts {};
+    };
+
+    struct BranchInfo {
+        uint32_t taken {0};
+        uint32_t notTaken {0};
+    };
+
+    PGOProfile() = default;
+    ~PGOProfile() = default;
+    DEFAULT_COPY_SEMANTIC(PGOProfile);
+    DEFAULT_MOVE_SEMANTIC(PGOProfile);
+
+    void RecordCall(uint32_t checksum, uint32_t methodId, uint32_t offset, uint32_t calleeMethodId);
+    // the ic state only moves towards MEGA, so the most advanced state seen wins and the layouts accumulate
+    void RecordIC(uint32_t checksum, uint32_t methodId, uint32_t slotId, ICKind kind,
+                  ProfileTypeAccessor::ICState state, const std::vector<HClassLayout> &layouts);
+    void RecordBranch(uint32_t checksum, uint32_t methodId, uint32_t offset, bool taken);
+
+    // returns nullptr unless every call seen at the site went to the same method
+    const CallSiteInfo *GetMonoCallTarget(uint32_t checksum, uint32_t methodId, uint32_t offset) const;
+    // returns nullptr if the ic slot never missed in the profiled run
+    const ICSiteInfo *GetICSite(uint32_t checksum, uint32_t methodId, uint32_t slotId) const;
+    const BranchInfo *GetBranch(uint32_t checksum, uint32_t methodId, uint32_t offset) const;
+
+    const HClassLayout &GetLayout(uint32_t index) const
+    {
+        return layouts_.at(index);
+    }
+
+    // adds the counts of other and widens the states of the sites both profiles saw
+    void Merge(const PGOProfile &other);
+
+    bool Empty() const
+    {
+        return methods_.empty();
+    }
+
+    bool Save(const std::string &path) const;
+    // a file with another magic or version is rejected and leaves the profile empty
+    bool Load(const std::string &path);
+
+    static uint32_t GetChecksum(const JSPandaFile *jsPandaFile);
+
+private:
+    struct MethodProfile {
+        std::map<uint32_t, CallSiteInfo> callSites {};  // bytecode offset -> call site
+        std::map<uint32_t, ICSiteInfo> icSites {};  // ic slot id -> ic site
+        std::map<uint32_t, BranchInfo> branches {};  // bytecode offset -> branch
+    };
+
+    const MethodProfile *FindMethod(uint32_t checksum, uint32_t methodId) const;
+    uint32_t AddLayout(const HClassLayout &layout);
+    void Clear();
+    bool OnTruncated(const std::string &path);
+
+    // checksum -> method id -> profile of the method
+    std::map<uint32_t, std::map<uint32_t, MethodProfile>> methods_ {};
+    std::vector<HClassLayout> layouts_ {};
+    std::map<HClassLayout, uint32_t> layoutIndexes_ {};
+};
+
+// Collects a PGOProfile while the interpreter runs, created by the vm when --enable-pgo-profiler is set. The
+// profile is written to --pgo-profile-file when the vm is destroyed, and also whenever the process receives
+// SIGUSR2, so that long running processes can be sampled without being stopped: the handler only raises a flag,
+// which the js thread checks the next time it records a call or a branch.
+class PGOProfiler {
+public:
+    explicit PGOProfiler(std::string outputFile);
+    ~PGOProfiler() = default;
+    NO_COPY_SEMANTIC(PGOProfiler);
+    NO_MOVE_SEMANTIC(PGOProfiler);
+
+    // pc points to the call bytecode inside caller
+    void ProfileCall(const JSMethod *caller, const uint8_t *pc, const JSMethod *callee);
+    // pc points to the conditional jump bytecode inside method
+    void ProfileBranch(const JSMethod *method, const uint8_t *pc, bool taken);
+    // called after an ic miss of the topmost interpreted frame patched the slot
+    void ProfileIC(JSThread *thread, JSHandle<ProfileTypeInfo> profileTypeInfo, uint32_t slotId, ICKind kind);
+
+    void Dump() const;
+
+    const PGOProfile &GetProfile() const
+    {
+        return profile_;
+    }
+
+private:
+    static void DumpSignalHandler(int signo);
+    static PGOProfile::HClassLayout GetLayout(const JSHClass *hclass);
+
+    void DumpIfRequested()
+    {
+        if (UNLIKELY(dumpRequested_.load(std::memory_order_relaxed)) &&
+            dumpRequested_.exchange(false, std::memory_order_relaxed)) {
+            Dump();
+        }
+    }
+
+    static std::atomic<bool> dumpRequested_;
+
+    std::string outputFile_;
+    PGOProfile profile_;
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_PGO_PROFILER_PGO_PROFILER_H
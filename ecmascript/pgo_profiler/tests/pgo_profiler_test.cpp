@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "ecmascript/pgo_profiler/pgo_profiler.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class PGOProfilerTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void TearDown() override
+    {
+        std::remove(PROFILE_FILE);
+    }
+
+    static constexpr const char *PROFILE_FILE = "pgo_profiler_test.ap";
+    static constexpr uint32_t CHECKSUM = 0x12345678;
+    static constexpr uint32_t CALLER = 0x100;
+
+    static PGOProfile::HClassLayout MakeLayout(std::vector<std::string> keys)
+    {
+        return {static_cast<uint32_t>(JSType::JS_OBJECT), false, std::move(keys)};
+    }
+};
+
+HWTEST_F_L0(PGOProfilerTest, MonoAndPolyCallSites)
+{
+    PGOProfile profile;
+    EXPECT_TRUE(profile.Empty());
+    profile.RecordCall(CHECKSUM, CALLER, 4, 0x200);  // 4: bytecode offset
+    profile.RecordCall(CHECKSUM, CALLER, 4, 0x200);  // 4: bytecode offset
+    profile.RecordCall(CHECKSUM, CALLER, 12, 0x200);  // 12: bytecode offset
+    profile.RecordCall(CHECKSUM, CALLER, 12, 0x300);  // 12: bytecode offset
+
+    const PGOProfile::CallSiteInfo *mono = profile.GetMonoCallTarget(CHECKSUM, CALLER, 4);
+    ASSERT_NE(mono, nullptr);
+    EXPECT_EQ(mono->calleeMethodId, 0x200U);
+    EXPECT_EQ(mono->count, 2U);
+    // once polymorphic, a site stays polymorphic
+    profile.RecordCall(CHECKSUM, CALLER, 12, 0x200);  // 12: bytecode offset
+    EXPECT_EQ(profile.GetMonoCallTarget(CHECKSUM, CALLER, 12), nullptr);
+    EXPECT_EQ(profile.GetMonoCallTarget(CHECKSUM, CALLER, 8), nullptr);
+    EXPECT_EQ(profile.GetMonoCallTarget(CHECKSUM + 1, CALLER, 4), nullptr);
+}
+
+HWTEST_F_L0(PGOProfilerTest, ICSites)
+{
+    using ICState = ProfileTypeAccessor::ICState;
+    PGOProfile profile;
+    profile.RecordIC(CHECKSUM, CALLER, 0, ICKind::NamedLoadIC, ICState::MONO, {MakeLayout({"x", "y"})});
+    const PGOProfile::ICSiteInfo *site = profile.GetICSite(CHECKSUM, CALLER, 0);
+    ASSERT_NE(site, nullptr);
+    EXPECT_EQ(site->kind, ICKind::NamedLoadIC);
+    EXPECT_EQ(site->state, ICState::MONO);
+    ASSERT_EQ(site->layouts.size(), 1U);
+    EXPECT_EQ(profile.GetLayout(site->layouts[0]).keys, std::vector<std::string>({"x", "y"}));
+
+    // another closure of the method with its own ic slot saw a second hclass
+    profile.RecordIC(CHECKSUM, CALLER, 0, ICKind::NamedLoadIC, ICState::MONO, {MakeLayout({"y", "x"})});
+    EXPECT_EQ(site->state, ICState::POLY);
+    EXPECT_EQ(site->layouts.size(), 2U);
+    // layouts are shared between sites
+    profile.RecordIC(CHECKSUM, CALLER, 2, ICKind::NamedStoreIC, ICState::MONO, {MakeLayout({"x", "y"})});
+    EXPECT_EQ(profile.GetICSite(CHECKSUM, CALLER, 2)->layouts[0], site->layouts[0]);
+
+    profile.RecordIC(CHECKSUM, CALLER, 0, ICKind::NamedLoadIC, ICState::MEGA, {});
+    EXPECT_EQ(site->state, ICState::MEGA);
+    EXPECT_EQ(profile.GetICSite(CHECKSUM, CALLER, 4), nullptr);  // 4: slot id
+}
+
+HWTEST_F_L0(PGOProfilerTest, Branches)
+{
+    PGOProfile profile;
+    profile.RecordBranch(CHECKSUM, CALLER, 8, true);  // 8: bytecode offset
+    profile.RecordBranch(CHECKSUM, CALLER, 8, true);  // 8: bytecode offset
+    profile.RecordBranch(CHECKSUM, CALLER, 8, false);  // 8: bytecode offset
+    const PGOProfile::BranchInfo *branch = profile.GetBranch(CHECKSUM, CALLER, 8);
+    ASSERT_NE(branch, nullptr);
+    EXPECT_EQ(branch->taken, 2U);
+    EXPECT_EQ(branch->notTaken, 1U);
+    EXPECT_EQ(profile.GetBranch(CHECKSUM, CALLER, 10), nullptr);  // 10: bytecode offset
+}
+
+HWTEST_F_L0(PGOProfilerTest, Merge)
+{
+    using ICState = ProfileTypeAccessor::ICState;
+    PGOProfile first;
+    first.RecordCall(CHECKSUM, CALLER, 4, 0x200);  // 4: bytecode offset
+    first.RecordCall(CHECKSUM, CALLER, 12, 0x200);  // 12: bytecode offset
+    first.RecordIC(CHECKSUM, CALLER, 0, ICKind::NamedLoadIC, ICState::MONO, {MakeLayout({"x"})});
+    first.RecordBranch(CHECKSUM, CALLER, 8, true);  // 8: bytecode offset
+    PGOProfile second;
+    second.RecordCall(CHECKSUM, CALLER, 4, 0x200);  // 4: bytecode offset
+    second.RecordCall(CHECKSUM, CALLER, 12, 0x300);  // 12: bytecode offset
+    second.RecordIC(CHECKSUM, CALLER, 0, ICKind::NamedLoadIC, ICState::MONO, {MakeLayout({"y"})});
+    second.RecordBranch(CHECKSUM, CALLER, 8, false);  // 8: bytecode offset
+    second.RecordBranch(CHECKSUM + 1, CALLER, 8, false);  // 8: bytecode offset
+
+    first.Merge(second);
+    const PGOProfile::CallSiteInfo *mono = first.GetMonoCallTarget(CHECKSUM, CALLER, 4);
+    ASSERT_NE(mono, nullptr);
+    EXPECT_EQ(mono->count, 2U);
+    EXPECT_EQ(first.GetMonoCallTarget(CHECKSUM, CALLER, 12), nullptr);
+    const PGOProfile::ICSiteInfo *site = first.GetICSite(CHECKSUM, CALLER, 0);
+    ASSERT_NE(site, nullptr);
+    EXPECT_EQ(site->state, ICState::POLY);
+    EXPECT_EQ(site->layouts.size(), 2U);
+    const PGOProfile::BranchInfo *branch = first.GetBranch(CHECKSUM, CALLER, 8);
+    ASSERT_NE(branch, nullptr);
+    EXPECT_EQ(branch->taken, 1U);
+    EXPECT_EQ(branch->notTaken, 1U);
+    EXPECT_NE(first.GetBranch(CHECKSUM + 1, CALLER, 8), nullptr);  // 8: bytecode offset
+}
+
+HWTEST_F_L0(PGOProfilerTest, SaveAndLoad)
+{
+    using ICState = ProfileTypeAccessor::ICState;
+    PGOProfile profile;
+    profile.RecordCall(CHECKSUM, CALLER, 4, 0x200);  // 4: bytecode offset
+    profile.RecordCall(CHECKSUM, CALLER, 12, 0x200);  // 12: bytecode offset
+    profile.RecordCall(CHECKSUM, CALLER, 12, 0x300);  // 12: bytecode offset
+    profile.RecordCall(CHECKSUM + 1, CALLER, 4, 0x400);  // 4: bytecode offset
+    profile.RecordIC(CHECKSUM, CALLER, 0, ICKind::LoadIC, ICState::MONO, {MakeLayout({"x", ""})});
+    profile.RecordBranch(CHECKSUM, CALLER, 8, true);  // 8: bytecode offset
+    ASSERT_TRUE(profile.Save(PROFILE_FILE));
+
+    PGOProfile loaded;
+    ASSERT_TRUE(loaded.Load(PROFILE_FILE));
+    const PGOProfile::CallSiteInfo *mono = loaded.GetMonoCallTarget(CHECKSUM, CALLER, 4);
+    ASSERT_NE(mono, nullptr);
+    EXPECT_EQ(mono->calleeMethodId, 0x200U);
+    EXPECT_EQ(mono->count, 1U);
+    EXPECT_EQ(loaded.GetMonoCallTarget(CHECKSUM, CALLER, 12), nullptr);
+    mono = loaded.GetMonoCallTarget(CHECKSUM + 1, CALLER, 4);
+    ASSERT_NE(mono, nullptr);
+    EXPECT_EQ(mono->calleeMethodId, 0x400U);
+    const PGOProfile::ICSiteInfo *site = loaded.GetICSite(CHECKSUM, CALLER, 0);
+    ASSERT_NE(site, nullptr);
+    EXPECT_EQ(site->kind, ICKind::LoadIC);
+    EXPECT_EQ(site->state, ICState::MONO);
+    ASSERT_EQ(site->layouts.size(), 1U);
+    EXPECT_EQ(loaded.GetLayout(site->layouts[0]).keys, std::vector<std::string>({"x", ""}));
+    const PGOProfile::BranchInfo *branch = loaded.GetBranch(CHECKSUM, CALLER, 8);
+    ASSERT_NE(branch, nullptr);
+    EXPECT_EQ(branch->taken, 1U);
+}
+
+HWTEST_F_L0(PGOProfilerTest, RejectUnknownVersion)
+{
+    {
+        std::ofstream out(PROFILE_FILE, std::ofstream::binary);
+        uint32_t header[] = {PGOProfile::MAGIC, PGOProfile::VERSION + 1, 0, 0};
+        out.write(reinterpret_cast<const char *>(header), sizeof(header));
+    }
+    PGOProfile profile;
+    profile.RecordCall(CHECKSUM, CALLER, 4, 0x200);  // 4: bytecode offset
+    EXPECT_FALSE(profile.Load(PROFILE_FILE));
+    EXPECT_TRUE(profile.Empty());
+}
+
+HWTEST_F_L0(PGOProfilerTest, RejectTruncatedFile)
+{
+    PGOProfile profile;
+    profile.RecordCall(CHECKSUM, CALLER, 4, 0x200);  // 4: bytecode offset
+    profile.RecordBranch(CHECKSUM, CALLER, 8, true);  // 8: bytecode offset
+    ASSERT_TRUE(profile.Save(PROFILE_FILE));
+    std::string content;
+    {
+        std::ifstream in(PROFILE_FILE, std::ifstream::binary);
+        content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream out(PROFILE_FILE, std::ofstream::binary | std::ofstream::trunc);
+        out.write(content.data(), static_cast<std::streamsize>(content.size() - 1));
+    }
+    PGOProfile loaded;
+    EXPECT_FALSE(loaded.Load(PROFILE_FILE));
+    EXPECT_TRUE(loaded.Empty());
+}
+}  // namespace panda::test
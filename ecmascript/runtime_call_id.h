@@ -134,6 +134,8 @@ namespace panda::ecmascript {
     V(LoadICByValue)                \
     V(TryStoreICByName)             \
     V(StoreICByName)                \
+    V(LoadMegaICByName)             \
+    V(StoreMegaICByName)            \
     V(TryStoreICByValue)            \
     V(StoreICByValue)               \
     V(NotifyInlineCache)            \
@@ -656,6 +658,8 @@ namespace panda::ecmascript {
     V(ConcurrentMarking)             \
     V(ConcurrentMarkingInitialize)   \
     V(WaitConcurrentMarkingFinished) \
+    V(IncrementalMarking)            \
+    V(IncrementalMarkingStep)        \
     V(ReMarking)                     \
     V(ConcurrentSweepingInitialize)  \
     V(ConcurrentSweepingWait)        \
@@ -533,6 +533,8 @@ JSTaggedValue RuntimeStubs::RuntimeStGlobalRecord(JSThread *thread, const JSHand
     dict = *GlobalDictionary::PutIfAbsent(thread, dictHandle, prop, JSHandle<JSTaggedValue>(box), attributes);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
     env->SetGlobalRecord(thread, JSTaggedValue(dict));
+    // the binding shadows a property of the prototype chain of the global object
+    JSHClass::NotifyGlobalBindingAdded(thread, env->GetGlobalObject());
     return JSTaggedValue::True();
 }
 
@@ -1180,11 +1182,12 @@ JSTaggedValue RuntimeStubs::RuntimeCreateEmptyObject([[maybe_unused]] JSThread *
     return obj.GetTaggedValue();
 }
 
-JSTaggedValue RuntimeStubs::RuntimeCreateEmptyArray([[maybe_unused]] JSThread *thread, ObjectFactory *factory,
+JSTaggedValue RuntimeStubs::RuntimeCreateEmptyArray(JSThread *thread, ObjectFactory *factory,
                                                     JSHandle<GlobalEnv> globalEnv)
 {
     JSHandle<JSFunction> builtinObj(globalEnv->GetArrayFunction());
     JSHandle<JSObject> arr = factory->NewJSObjectByConstructor(builtinObj, JSHandle<JSTaggedValue>(builtinObj));
+    JSHClass::TransitionElementsKind(thread, arr, ElementsKind::PACKED_INT);
     return arr.GetTaggedValue();
 }
 
@@ -24,7 +24,6 @@
 #include "ecmascript/global_env.h"
 #include "ecmascript/ic/ic_runtime.h"
 #include "ecmascript/ic/profile_type_info.h"
-#include "ecmascript/ic/properties_cache.h"
 #include "ecmascript/interpreter/interpreter-inl.h"
 #include "ecmascript/interpreter/interpreter_assembly.h"
 #include "ecmascript/js_api_arraylist.h"
@@ -33,7 +32,7 @@
 #include "ecmascript/js_proxy.h"
 #include "ecmascript/js_thread.h"
 #include "ecmascript/jspandafile/program_object.h"
-#include "ecmascript/layout_info.h"
+#include "ecmascript/layout_info-inl.h"
 #include "ecmascript/mem/space-inl.h"
 #include "ecmascript/message_string.h"
 #include "ecmascript/object_factory.h"
@@ -1677,13 +1676,7 @@ int32_t RuntimeStubs::FindElementWithCache(uintptr_t argGlue, JSTaggedType hClas
     auto cls  = reinterpret_cast<JSHClass *>(hClass);
     JSTaggedValue propKey = JSTaggedValue(key);
     auto layoutInfo = LayoutInfo::Cast(cls->GetLayout().GetTaggedObject());
-    PropertiesCache *cache = thread->GetPropertiesCache();
-    int index = cache->Get(cls, propKey);
-    if (index == PropertiesCache::NOT_FOUND) {
-        index = layoutInfo->BinarySearch(propKey, num);
-        cache->Set(cls, propKey, index);
-    }
-    return index;
+    return layoutInfo->FindElementWithCache(thread, cls, propKey, num);
 }
 
 JSTaggedType RuntimeStubs::FloatMod(double x, double y)
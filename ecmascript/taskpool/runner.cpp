@@ -18,18 +18,45 @@
 #include "os/thread.h"
 
 namespace panda::ecmascript {
+namespace {
+// Set on worker threads only, so PostTask can tell whether the caller owns a deque.
+thread_local Runner *currentRunner = nullptr;
+thread_local uint32_t currentThreadId = 0;
+}  // namespace
+
 Runner::Runner(uint32_t threadNum) : totalThreadNum_(threadNum)
 {
+    // The deques must exist before any worker starts stealing.
+    for (uint32_t i = 0; i <= threadNum; i++) {
+        workerDeques_.emplace_back(std::make_unique<WorkerDeques>());
+    }
+    for (uint32_t i = 0; i < runningTask_.size(); i++) {
+        runningTask_[i] = nullptr;
+    }
+
     for (uint32_t i = 0; i < threadNum; i++) {
         // main thread is 0;
         std::unique_ptr<std::thread> thread = std::make_unique<std::thread>(&Runner::Run, this, i + 1);
         os::thread::SetThreadName(thread->native_handle(), "GC_WorkerThread");
         threadPool_.emplace_back(std::move(thread));
     }
+}
 
-    for (uint32_t i = 0; i < runningTask_.size(); i++) {
-        runningTask_[i] = nullptr;
+void Runner::PostTask(std::unique_ptr<Task> task)
+{
+    if (currentRunner == this) {
+        auto priority = static_cast<size_t>(task->GetPriority());
+        if ((*workerDeques_[currentThreadId])[priority].Push(task.get())) {
+            // Ownership now lives in the deque until the task is popped or stolen.
+            [[maybe_unused]] Task *released = task.release();
+            localPostCount_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            taskQueue_.NotifyLocalTask();
+            return;
+        }
     }
+    sharedPostCount_.fetch_add(1, std::memory_order_relaxed);
+    taskQueue_.PostTask(std::move(task));
 }
 
 void Runner::TerminateTask()
@@ -54,18 +81,94 @@ void Runner::TerminateThread()
     threadPool_.clear();
 }
 
+TaskpoolStatistics Runner::GetStatistics() const
+{
+    TaskpoolStatistics statistics;
+    statistics.localPostCount = localPostCount_.load(std::memory_order_relaxed);
+    statistics.sharedPostCount = sharedPostCount_.load(std::memory_order_relaxed);
+    statistics.sharedPopCount = sharedPopCount_.load(std::memory_order_relaxed);
+    statistics.stealCount = stealCount_.load(std::memory_order_relaxed);
+    statistics.stealConflictCount = stealConflictCount_.load(std::memory_order_relaxed);
+    statistics.idleWaitCount = idleWaitCount_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
 void Runner::SetRunTask(uint32_t threadId, Task *task)
 {
     os::memory::LockHolder holder(mtx_);
     runningTask_[threadId] = task;
 }
 
+// Looks for work from the highest priority class down: the worker's own deque first (LIFO, cache warm), then the
+// shared queue, then the other workers' deques.
+Task *Runner::FindTask(uint32_t threadId)
+{
+    WorkerDeques &ownDeques = *workerDeques_[threadId];
+    for (size_t priority = 0; priority < PRIORITY_NUM; priority++) {
+        if (Task *task = ownDeques[priority].Pop()) {
+            return task;
+        }
+        if (std::unique_ptr<Task> task = taskQueue_.TryPopTask(static_cast<TaskPriority>(priority))) {
+            sharedPopCount_.fetch_add(1, std::memory_order_relaxed);
+            return task.release();
+        }
+        if (Task *task = StealTask(threadId, priority)) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+Task *Runner::StealTask(uint32_t threadId, size_t priority)
+{
+    // Start from the next worker so that thieves spread over victims.
+    for (uint32_t i = 1; i <= totalThreadNum_; i++) {
+        uint32_t victim = (threadId + i - 1) % totalThreadNum_ + 1;
+        if (victim == threadId) {
+            continue;
+        }
+        bool lostRace = false;
+        Task *task = (*workerDeques_[victim])[priority].Steal(&lostRace);
+        if (lostRace) {
+            stealConflictCount_.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (task != nullptr) {
+            stealCount_.fetch_add(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+bool Runner::HasStealableTask() const
+{
+    for (uint32_t threadId = 1; threadId <= totalThreadNum_; threadId++) {
+        for (const WorkStealingDeque &deque : *workerDeques_[threadId]) {
+            if (!deque.IsEmpty()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void Runner::Run(uint32_t threadId)
 {
-    while (std::unique_ptr<Task> task = taskQueue_.PopTask()) {
+    currentRunner = this;
+    currentThreadId = threadId;
+    while (true) {
+        std::unique_ptr<Task> task(FindTask(threadId));
+        if (task == nullptr) {
+            idleWaitCount_.fetch_add(1, std::memory_order_relaxed);
+            if (!taskQueue_.WaitForTask([this]() { return HasStealableTask(); })) {
+                break;
+            }
+            continue;
+        }
         SetRunTask(threadId, task.get());
         task->Run(threadId);
         SetRunTask(threadId, nullptr);
     }
+    currentRunner = nullptr;
 }
 }  // namespace panda::ecmascript
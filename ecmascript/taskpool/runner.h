@@ -17,18 +17,30 @@
 #define ECMASCRIPT_TASKPOOL_RUNNER_H
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <thread>
 #include <vector>
 
 #include "ecmascript/common.h"
 #include "ecmascript/taskpool/task_queue.h"
+#include "ecmascript/taskpool/work_stealing_deque.h"
 #include "os/mutex.h"
 
 namespace panda::ecmascript {
 static constexpr uint32_t MAX_TASKPOOL_THREAD_NUM = 7;
 static constexpr uint32_t DEFAULT_TASKPOOL_THREAD_NUM = 0;
 
+// Monotonic counters of the taskpool scheduler, for monitoring contention.
+struct TaskpoolStatistics {
+    uint64_t localPostCount {0};     // tasks pushed to the posting worker's own deque
+    uint64_t sharedPostCount {0};    // tasks pushed to the shared queue
+    uint64_t sharedPopCount {0};     // tasks taken from the shared queue
+    uint64_t stealCount {0};         // tasks stolen from another worker's deque
+    uint64_t stealConflictCount {0}; // steals that lost the race for the last element
+    uint64_t idleWaitCount {0};      // times a worker went to sleep
+};
+
 class Runner {
 public:
     explicit Runner(uint32_t threadNum);
@@ -37,10 +49,7 @@ public:
     NO_COPY_SEMANTIC(Runner);
     NO_MOVE_SEMANTIC(Runner);
 
-    void PostTask(std::unique_ptr<Task> task)
-    {
-        taskQueue_.PostTask(std::move(task));
-    }
+    void PostTask(std::unique_ptr<Task> task);
 
     void PUBLIC_API TerminateThread();
     void TerminateTask();
@@ -60,15 +69,32 @@ public:
         return false;
     }
 
+    TaskpoolStatistics GetStatistics() const;
+
 private:
+    static constexpr size_t PRIORITY_NUM = static_cast<size_t>(TaskPriority::PRIORITY_NUM);
+    using WorkerDeques = std::array<WorkStealingDeque, PRIORITY_NUM>;
+
     void Run(uint32_t threadId);
     void SetRunTask(uint32_t threadId, Task *task);
+    Task *FindTask(uint32_t threadId);
+    Task *StealTask(uint32_t threadId, size_t priority);
+    bool HasStealableTask() const;
 
     std::vector<std::unique_ptr<std::thread>> threadPool_ {};
+    // Indexed by thread id, slot 0 belongs to the main thread and stays empty.
+    std::vector<std::unique_ptr<WorkerDeques>> workerDeques_ {};
     TaskQueue taskQueue_ {};
     std::array<Task*, MAX_TASKPOOL_THREAD_NUM + 1> runningTask_;
     uint32_t totalThreadNum_ {0};
     os::memory::Mutex mtx_;
+
+    std::atomic<uint64_t> localPostCount_ {0};
+    std::atomic<uint64_t> sharedPostCount_ {0};
+    std::atomic<uint64_t> sharedPopCount_ {0};
+    std::atomic<uint64_t> stealCount_ {0};
+    std::atomic<uint64_t> stealConflictCount_ {0};
+    std::atomic<uint64_t> idleWaitCount_ {0};
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_TASKPOOL_RUNNER_H
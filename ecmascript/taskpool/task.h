@@ -19,9 +19,18 @@
 #include "macros.h"
 
 namespace panda::ecmascript {
+// Workers always take a task of the highest non-empty priority class, so GC-critical work never waits behind
+// background work that was posted earlier.
+enum class TaskPriority : uint8_t {
+    HIGH = 0,
+    NORMAL,
+    LOW,
+    PRIORITY_NUM
+};
+
 class Task {
 public:
-    Task() = default;
+    explicit Task(TaskPriority priority = TaskPriority::NORMAL) : priority_(priority) {}
     virtual ~Task() = default;
     virtual bool Run(uint32_t threadIndex) = 0;
 
@@ -38,8 +47,14 @@ public:
         return terminate_;
     }
 
+    TaskPriority GetPriority() const
+    {
+        return priority_;
+    }
+
 private:
     volatile bool terminate_ {false};
+    TaskPriority priority_;
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_TASKPOOL_TASK_H
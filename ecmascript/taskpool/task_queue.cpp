@@ -20,25 +20,37 @@ void TaskQueue::PostTask(std::unique_ptr<Task> task)
 {
     os::memory::LockHolder holder(mtx_);
     ASSERT(!terminate_);
-    tasks_.push(std::move(task));
+    auto priority = static_cast<size_t>(task->GetPriority());
+    tasks_[priority].push_back(std::move(task));
+    taskCounts_[priority]++;
+    taskCount_++;
     cv_.Signal();
 }
 
-std::unique_ptr<Task> TaskQueue::PopTask()
+std::unique_ptr<Task> TaskQueue::TryPopTask(TaskPriority priority)
 {
+    auto index = static_cast<size_t>(priority);
+    if (taskCounts_[index].load(std::memory_order_acquire) == 0) {
+        return nullptr;
+    }
     os::memory::LockHolder holder(mtx_);
-    while (true) {
-        if (!tasks_.empty()) {
-            std::unique_ptr<Task> task = std::move(tasks_.front());
-            tasks_.pop();
-            return task;
-        }
-        if (terminate_) {
-            cv_.SignalAll();
-            return nullptr;
-        }
-        cv_.Wait(&mtx_);
+    if (tasks_[index].empty()) {
+        return nullptr;
     }
+    std::unique_ptr<Task> task = std::move(tasks_[index].front());
+    tasks_[index].pop_front();
+    taskCounts_[index]--;
+    taskCount_--;
+    return task;
+}
+
+void TaskQueue::NotifyLocalTask()
+{
+    if (idleCount_ == 0) {
+        return;
+    }
+    os::memory::LockHolder holder(mtx_);
+    cv_.Signal();
 }
 
 void TaskQueue::Terminate()
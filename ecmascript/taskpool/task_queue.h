@@ -17,14 +17,17 @@
 #define ECMASCRIPT_TASKPOOL_TASK_QUEUE_H
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <deque>
 #include <memory>
-#include <queue>
 
 #include "ecmascript/taskpool/task.h"
 #include "os/mutex.h"
 
 namespace panda::ecmascript {
+// Shared injection queue of the taskpool, one FIFO per priority class. Threads outside the pool post here, and
+// workers fall back to it when their own deque is full. Idle workers also sleep on its condition variable.
 class TaskQueue {
 public:
     TaskQueue() = default;
@@ -34,12 +37,41 @@ public:
     NO_MOVE_SEMANTIC(TaskQueue);
 
     void PostTask(std::unique_ptr<Task> task);
-    std::unique_ptr<Task> PopTask();
+    // Never blocks, and does not take the lock while the queue of that priority is empty.
+    std::unique_ptr<Task> TryPopTask(TaskPriority priority);
+
+    // Blocks until a task is posted, NotifyLocalTask is called or the queue is terminated. hasLocalWork is checked
+    // under the lock so that tasks pushed to worker deques are never missed. Returns false once terminated and
+    // there is nothing left to run.
+    template<class Callback>
+    bool WaitForTask(const Callback &hasLocalWork)
+    {
+        os::memory::LockHolder holder(mtx_);
+        idleCount_++;
+        while (!terminate_ && taskCount_ == 0 && !hasLocalWork()) {
+            cv_.Wait(&mtx_);
+        }
+        idleCount_--;
+        return !terminate_ || taskCount_ != 0 || hasLocalWork();
+    }
+
+    // Wakes one sleeping worker after a task was pushed to a worker deque.
+    void NotifyLocalTask();
 
     void Terminate();
 
+    uint32_t GetIdleCount() const
+    {
+        return idleCount_;
+    }
+
 private:
-    std::queue<std::unique_ptr<Task>> tasks_;
+    static constexpr size_t PRIORITY_NUM = static_cast<size_t>(TaskPriority::PRIORITY_NUM);
+
+    std::array<std::deque<std::unique_ptr<Task>>, PRIORITY_NUM> tasks_ {};
+    std::array<std::atomic<uint32_t>, PRIORITY_NUM> taskCounts_ {};
+    std::atomic<uint32_t> taskCount_ {0};
+    std::atomic<uint32_t> idleCount_ {0};
 
     std::atomic_bool terminate_ = false;
     os::memory::Mutex mtx_;
@@ -61,6 +61,11 @@ public:
         return runner_->IsInThreadPool(id);
     }
 
+    TaskpoolStatistics GetStatistics() const
+    {
+        return runner_->GetStatistics();
+    }
+
 private:
     uint32_t TheMostSuitableThreadNum(uint32_t threadNum) const;
 
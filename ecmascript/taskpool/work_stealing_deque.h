@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TASKPOOL_WORK_STEALING_DEQUE_H
+#define ECMASCRIPT_TASKPOOL_WORK_STEALING_DEQUE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "ecmascript/taskpool/task.h"
+
+namespace panda::ecmascript {
+// Bounded Chase-Lev deque. The owner thread pushes and pops at the bottom without locking, any other thread
+// steals from the top with a single CAS. Push fails when the ring is full, the caller then falls back to the
+// shared queue, so the buffer never has to grow.
+class WorkStealingDeque {
+public:
+    static constexpr int64_t CAPACITY = 256;
+
+    WorkStealingDeque() = default;
+    ~WorkStealingDeque() = default;
+
+    NO_COPY_SEMANTIC(WorkStealingDeque);
+    NO_MOVE_SEMANTIC(WorkStealingDeque);
+
+    // Owner only.
+    bool Push(Task *task)
+    {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        int64_t top = top_.load(std::memory_order_acquire);
+        if (bottom - top >= CAPACITY) {
+            return false;
+        }
+        buffer_[Index(bottom)].store(task, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Owner only.
+    Task *Pop()
+    {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Task *task = buffer_[Index(bottom)].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last element, race against thieves for it.
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                task = nullptr;
+            }
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    // Any thread. Sets lostRace when another thread took the element first.
+    Task *Steal(bool *lostRace)
+    {
+        int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+        Task *task = buffer_[Index(top)].load(std::memory_order_relaxed);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            *lostRace = true;
+            return nullptr;
+        }
+        return task;
+    }
+
+    bool IsEmpty() const
+    {
+        return top_.load(std::memory_order_acquire) >= bottom_.load(std::memory_order_acquire);
+    }
+
+private:
+    static size_t Index(int64_t position)
+    {
+        return static_cast<size_t>(position & (CAPACITY - 1));
+    }
+
+    std::array<std::atomic<Task *>, CAPACITY> buffer_ {};
+    std::atomic<int64_t> top_ {0};
+    std::atomic<int64_t> bottom_ {0};
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_TASKPOOL_WORK_STEALING_DEQUE_H
@@ -19,6 +19,7 @@
 #include "ecmascript/global_env.h"
 #include "ecmascript/js_handle.h"
 #include "ecmascript/mem/clock_scope.h"
+#include "ecmascript/mem/incremental_marker.h"
 #include "ecmascript/mem/verification.h"
 
 using namespace panda::ecmascript;
@@ -102,4 +103,39 @@ HWTEST_F_L0(ConcurrentMarkingTest, PerformanceWithoutConcurrentMarking)
     }
     heap->CollectGarbage(TriggerGCType::OLD_GC);
 }
+
+HWTEST_F_L0(ConcurrentMarkingTest, IncrementalMarking)
+{
+    uint32_t rootLength = 1024;
+    JSHandle<TaggedArray> rootArray =
+        CreateTaggedArray(rootLength, JSTaggedValue::Undefined(), MemSpaceType::OLD_SPACE);
+    for (uint32_t i = 0; i < rootLength; i++) {
+        uint32_t subArrayLength = 1024;
+        auto array = CreateTaggedArray(subArrayLength, JSTaggedValue::Undefined(), MemSpaceType::OLD_SPACE);
+        rootArray->Set(thread, i, array);
+    }
+    auto heap = const_cast<Heap *>(thread->GetEcmaVM()->GetHeap());
+    heap->EnableIncrementalMarking(true);
+    heap->SetMarkType(MarkType::MARK_FULL);
+    heap->GetIncrementalMarker()->Mark();
+    EXPECT_TRUE(thread->IsMarking());
+    // the arrays stored while marking are recorded by the write barrier
+    for (uint32_t i = 0; i < rootLength; i++) {
+        uint32_t subArrayLength = 1024;
+        auto array = CreateTaggedArray(subArrayLength, JSTaggedValue::Undefined(), MemSpaceType::OLD_SPACE);
+        rootArray->Set(thread, i, array);
+        if (thread->IsMarking()) {
+            heap->GetIncrementalMarker()->Step();
+        }
+    }
+    while (thread->IsMarking()) {
+        heap->GetIncrementalMarker()->Step();
+    }
+    EXPECT_TRUE(thread->IsMarkFinished());
+    heap->CollectGarbage(TriggerGCType::OLD_GC);
+    EXPECT_TRUE(thread->IsReadyToMark());
+    for (uint32_t i = 0; i < rootLength; i++) {
+        EXPECT_TRUE(rootArray->Get(i).IsTaggedArray());
+    }
+}
 }  // namespace panda::test
@@ -13,8 +13,14 @@
  * limitations under the License.
  */
 
+#include <sstream>
+#include <thread>
+
 #include "ecmascript/ecma_vm.h"
+#include "ecmascript/mem/allocation_site_tracker.h"
 #include "ecmascript/mem/full_gc.h"
+#include "ecmascript/mem/gc_tracer.h"
+#include "ecmascript/mem/mem_map_allocator.h"
 #include "ecmascript/object_factory.h"
 #include "ecmascript/mem/stw_young_gc.h"
 #include "ecmascript/tests/test_helper.h"
@@ -75,4 +81,113 @@ HWTEST_F_L0(GCTest, FullGCOne)
     auto oldSizeAfter = heap->GetOldSpace()->GetHeapObjectSize();
     EXPECT_TRUE(oldSizeBefore > oldSizeAfter);
 }
+
+HWTEST_F_L0(GCTest, FullGCLargeObjectGraph)
+{
+    // Wide enough to overflow every marking thread's local nodes, so work is handed over through the global stack.
+    constexpr uint32_t width = 256;
+    constexpr uint32_t leafLength = 4;
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    auto heap = thread->GetEcmaVM()->GetHeap();
+    JSHandle<TaggedArray> root = factory->NewTaggedArray(width, JSTaggedValue::Undefined(), MemSpaceType::OLD_SPACE);
+    for (uint32_t i = 0; i < width; i++) {
+        [[maybe_unused]] ecmascript::EcmaHandleScope baseScope(thread);
+        JSHandle<TaggedArray> branch = factory->NewTaggedArray(width, JSTaggedValue::Undefined());
+        for (uint32_t j = 0; j < width; j++) {
+            JSHandle<TaggedArray> leaf = factory->NewTaggedArray(leafLength, JSTaggedValue(i * width + j));
+            branch->Set(thread, j, leaf.GetTaggedValue());
+        }
+        root->Set(thread, i, branch.GetTaggedValue());
+    }
+    heap->CollectGarbage(TriggerGCType::FULL_GC);
+    for (uint32_t i = 0; i < width; i++) {
+        TaggedArray *branch = TaggedArray::Cast(root->Get(i).GetTaggedObject());
+        for (uint32_t j = 0; j < width; j++) {
+            TaggedArray *leaf = TaggedArray::Cast(branch->Get(j).GetTaggedObject());
+            EXPECT_EQ(leaf->Get(leafLength - 1).GetInt(), static_cast<int32_t>(i * width + j));
+        }
+    }
+}
+
+HWTEST_F_L0(GCTest, PretenureSurvivingAllocationSite)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    Heap *heap = const_cast<Heap *>(thread->GetEcmaVM()->GetHeap());
+    AllocationSiteTracker *tracker = heap->GetAllocationSiteTracker();
+    uintptr_t site = 0x1000;
+    constexpr uint32_t count = 64;
+    JSHandle<TaggedArray> holder = factory->NewTaggedArray(count, JSTaggedValue::Undefined(), MemSpaceType::OLD_SPACE);
+    for (uint32_t i = 0; i < count; i++) {
+        EXPECT_EQ(tracker->GetAllocationSpace(site), MemSpaceType::SEMI_SPACE);
+        JSHandle<TaggedArray> array = factory->NewTaggedArray(4, JSTaggedValue::Undefined());  // 4: array length
+        holder->Set(thread, i, array.GetTaggedValue());
+        tracker->RecordAllocation(site, *array);
+    }
+    heap->CollectGarbage(TriggerGCType::YOUNG_GC);
+    EXPECT_TRUE(tracker->IsPretenured(site));
+    EXPECT_EQ(tracker->GetAllocationSpace(site), MemSpaceType::SEMI_SPACE);  // a sampled young allocation
+    EXPECT_EQ(tracker->GetAllocationSpace(site), MemSpaceType::OLD_SPACE);
+
+    // the sampled young objects of the site die, so it goes back to the young space
+    {
+        [[maybe_unused]] ecmascript::EcmaHandleScope baseScope(thread);
+        for (uint32_t i = 0; i < count * 16; i++) {  // 16: one in 16 allocations of a pretenured site is young
+            if (tracker->GetAllocationSpace(site) == MemSpaceType::SEMI_SPACE) {
+                JSHandle<TaggedArray> array = factory->NewTaggedArray(4, JSTaggedValue::Undefined());  // 4: length
+                tracker->RecordAllocation(site, *array);
+            }
+        }
+    }
+    heap->CollectGarbage(TriggerGCType::YOUNG_GC);
+    EXPECT_FALSE(tracker->IsPretenured(site));
+    EXPECT_EQ(tracker->GetAllocationSpace(site), MemSpaceType::SEMI_SPACE);
+}
+
+HWTEST_F_L0(GCTest, GCTrace)
+{
+    auto heap = thread->GetEcmaVM()->GetHeap();
+    GCTracer *tracer = heap->GetGCTracer();
+    EXPECT_FALSE(tracer->IsEnabled());
+    tracer->Start();
+    heap->CollectGarbage(TriggerGCType::FULL_GC);
+    tracer->Stop();
+    heap->CollectGarbage(TriggerGCType::FULL_GC);
+
+    std::ostringstream out;
+    tracer->Dump(out);
+    std::string trace = out.str();
+    EXPECT_EQ(trace.find("{\"traceEvents\":["), 0U);
+    EXPECT_NE(trace.find("\"name\":\"FullGC::RunPhases\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"FullGC::Mark\""), std::string::npos);
+    // only the gc while started is recorded
+    size_t first = trace.find("FullGC::RunPhases");
+    EXPECT_EQ(trace.find("FullGC::RunPhases", first + 1), std::string::npos);
+}
+
+HWTEST_F_L0(GCTest, ReleaseIdleMem)
+{
+    MemMapAllocator *allocator = MemMapAllocator::GetInstance();
+    allocator->ReleaseIdleMem(0);
+    ASSERT_EQ(allocator->GetResidentCacheSize(), 0U);
+
+    // without idle notifications a freed region is released right away
+    MemMap mem = allocator->Allocate(DEFAULT_REGION_SIZE, DEFAULT_REGION_SIZE, true);
+    ASSERT_NE(mem.GetMem(), nullptr);
+    allocator->Free(mem.GetMem(), mem.GetSize(), true);
+    EXPECT_EQ(allocator->GetResidentCacheSize(), 0U);
+
+    // once the embedder sends them, it stays resident until it aged
+    instance->NotifyIdle(0);
+    mem = allocator->Allocate(DEFAULT_REGION_SIZE, DEFAULT_REGION_SIZE, true);
+    ASSERT_NE(mem.GetMem(), nullptr);
+    allocator->Free(mem.GetMem(), mem.GetSize(), true);
+    EXPECT_EQ(allocator->GetResidentCacheSize(), DEFAULT_REGION_SIZE);
+    EXPECT_EQ(allocator->ReleaseIdleMem(60000), 0U);  // 60000: an age no region reaches in this test
+    EXPECT_EQ(allocator->GetResidentCacheSize(), DEFAULT_REGION_SIZE);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));  // 20: let the region age
+    EXPECT_EQ(allocator->ReleaseIdleMem(10), DEFAULT_REGION_SIZE);  // 10: younger than the region
+    EXPECT_EQ(allocator->GetResidentCacheSize(), 0U);
+    allocator->KeepFreedMemResident(false);
+}
 }  // namespace panda::test
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/mem/mem_map_allocator.h"
+#include "ecmascript/object_factory.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda;
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class HeapCageTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        TestHelper::CreateEcmaVMWithScope(instance, thread, scope);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    }
+
+    EcmaVM *instance {nullptr};
+    ecmascript::EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+};
+
+#ifdef ECMASCRIPT_ENABLE_POINTER_COMPRESSION
+HWTEST_F_L0(HeapCageTest, RegionsInCage)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> young = factory->NewTaggedArray(16, JSTaggedValue::Undefined());  // 16: array length
+    JSHandle<TaggedArray> old = factory->NewTaggedArray(16, JSTaggedValue::Undefined(),  // 16: array length
+                                                        MemSpaceType::OLD_SPACE);
+    // 128 * 1024: an array larger than MAX_REGULAR_HEAP_OBJECT_SIZE lives in the huge object space
+    JSHandle<TaggedArray> huge = factory->NewTaggedArray(128 * 1024, JSTaggedValue::Undefined());
+    for (uintptr_t addr : {young.GetTaggedType(), old.GetTaggedType(), huge.GetTaggedType()}) {
+        EXPECT_TRUE(MemMapAllocator::InCage(addr));
+        uint32_t offset = MemMapAllocator::CompressPointer(addr);
+        EXPECT_NE(offset, 0U);
+        EXPECT_EQ(MemMapAllocator::DecompressPointer(offset), addr);
+    }
+}
+
+HWTEST_F_L0(HeapCageTest, ReuseCageAfterLastVmDestroyed)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    // 128 * 1024: an array larger than MAX_REGULAR_HEAP_OBJECT_SIZE lives in the huge object space
+    factory->NewTaggedArray(128 * 1024, JSTaggedValue::Undefined());
+    TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    // the regions of the destroyed vm are freed before the allocator is finalized, none is left to hand out twice
+    EXPECT_EQ(MemMapAllocator::GetInstance()->GetResidentCacheSize(), 0U);
+
+    TestHelper::CreateEcmaVMWithScope(instance, thread, scope);
+    factory = thread->GetEcmaVM()->GetFactory();
+    uintptr_t first = factory->NewTaggedArray(128 * 1024, JSTaggedValue::Undefined()).GetTaggedType();
+    uintptr_t second = factory->NewTaggedArray(128 * 1024, JSTaggedValue::Undefined()).GetTaggedType();
+    EXPECT_TRUE(MemMapAllocator::InCage(first));
+    EXPECT_TRUE(MemMapAllocator::InCage(second));
+    // the rewound cage hands out the range of the destroyed vm again, but only once
+    EXPECT_NE(second, first);
+}
+#endif
+}  // namespace panda::test
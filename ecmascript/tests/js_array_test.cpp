@@ -14,6 +14,7 @@
  */
 
 #include "ecmascript/ecma_string.h"
+#include "ecmascript/elements_kind.h"
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/js_array.h"
@@ -129,6 +130,56 @@ HWTEST_F_L0(JSArrayTest, DefineOwnProperty)
     EXPECT_TRUE(JSArray::GetProperty(thread, obj, indexx).GetValue()->IsUndefined());
 }
 
+HWTEST_F_L0(JSArrayTest, ElementsKind)
+{
+    EXPECT_EQ(MergeElementsKind(ElementsKind::PACKED_INT, ElementsKind::PACKED_DOUBLE), ElementsKind::PACKED_DOUBLE);
+    EXPECT_EQ(MergeElementsKind(ElementsKind::HOLEY_INT, ElementsKind::PACKED_DOUBLE), ElementsKind::HOLEY_DOUBLE);
+    EXPECT_EQ(MergeElementsKind(ElementsKind::HOLEY_DOUBLE, ElementsKind::PACKED_ELEMENTS),
+              ElementsKind::HOLEY_ELEMENTS);
+    EXPECT_TRUE(IsMoreGeneralElementsKind(ElementsKind::HOLEY_DOUBLE, ElementsKind::PACKED_INT));
+    EXPECT_FALSE(IsMoreGeneralElementsKind(ElementsKind::HOLEY_INT, ElementsKind::PACKED_DOUBLE));
+    EXPECT_EQ(TaggedToElementsKind(JSTaggedValue::Hole()), ElementsKind::HOLEY_INT);
+
+    JSHandle<JSObject> arr(JSArray::ArrayCreate(thread, JSTaggedNumber(0)));
+    EXPECT_EQ(arr->GetJSHClass()->GetElementsKind(), ElementsKind::HOLEY_ELEMENTS);
+    JSHClass::TransitionElementsKind(thread, arr, ElementsKind::PACKED_INT);
+    JSHandle<JSTaggedValue> obj(arr);
+
+    JSHandle<JSTaggedValue> intValue(thread, JSTaggedValue(1));
+    JSArray::SetProperty(thread, obj, 0, intValue, true);
+    EXPECT_EQ(arr->GetJSHClass()->GetElementsKind(), ElementsKind::PACKED_INT);
+    JSHandle<JSTaggedValue> doubleValue(thread, JSTaggedValue(1.5));
+    JSArray::SetProperty(thread, obj, 1, doubleValue, true);
+    EXPECT_EQ(arr->GetJSHClass()->GetElementsKind(), ElementsKind::PACKED_DOUBLE);
+    // overwriting an element with an int keeps the kind
+    JSArray::SetProperty(thread, obj, 1, intValue, true);
+    EXPECT_EQ(arr->GetJSHClass()->GetElementsKind(), ElementsKind::PACKED_DOUBLE);
+    // a store past the length leaves holes
+    JSArray::SetProperty(thread, obj, 3, intValue, true);
+    EXPECT_EQ(arr->GetJSHClass()->GetElementsKind(), ElementsKind::HOLEY_DOUBLE);
+    JSHandle<JSTaggedValue> lengthKey(thread->GlobalConstants()->GetHandledLengthString());
+    EXPECT_EQ(JSArray::GetProperty(thread, obj, lengthKey).GetValue()->GetInt(), 4);
+    JSArray::SetProperty(thread, obj, 2, lengthKey, true);
+    EXPECT_EQ(arr->GetJSHClass()->GetElementsKind(), ElementsKind::HOLEY_ELEMENTS);
+
+    // the same transitions lead to the same hclass
+    JSHandle<JSObject> arr2(JSArray::ArrayCreate(thread, JSTaggedNumber(0)));
+    JSHClass::TransitionElementsKind(thread, arr2, ElementsKind::PACKED_INT);
+    JSHandle<JSTaggedValue> obj2(arr2);
+    JSArray::SetProperty(thread, obj2, 0, intValue, true);
+    JSArray::SetProperty(thread, obj2, 1, doubleValue, true);
+    JSHandle<JSObject> arr3(JSArray::ArrayCreate(thread, JSTaggedNumber(0)));
+    JSHClass::TransitionElementsKind(thread, arr3, ElementsKind::PACKED_INT);
+    JSHandle<JSTaggedValue> obj3(arr3);
+    JSArray::SetProperty(thread, obj3, 0, doubleValue, true);
+    EXPECT_EQ(arr2->GetJSHClass(), arr3->GetJSHClass());
+
+    // a longer length makes holes
+    JSHandle<JSTaggedValue> newLength(thread, JSTaggedValue(10));
+    JSArray::SetProperty(thread, obj3, lengthKey, newLength, true);
+    EXPECT_EQ(arr3->GetJSHClass()->GetElementsKind(), ElementsKind::HOLEY_DOUBLE);
+}
+
 HWTEST_F_L0(JSArrayTest, Next)
 {
     ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
@@ -169,4 +169,40 @@ HWTEST_F_L0(JSFunctionTest, SetSymbolFunctionName)
     EXPECT_TRUE(functionName->IsString());
     EXPECT_TRUE(EcmaString::StringsAreEqual(*(JSHandle<EcmaString>(functionName)), *name));
 }
+
+HWTEST_F_L0(JSFunctionTest, SlackTracking)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSFunction> ctor = factory->NewJSFunction(env, static_cast<void *>(nullptr),
+                                                       FunctionKind::BASE_CONSTRUCTOR);
+    JSHandle<JSTaggedValue> ctorHandle(ctor);
+    JSHandle<JSTaggedValue> keyX(factory->NewFromASCII("x"));
+    JSHandle<JSTaggedValue> keyY(factory->NewFromASCII("y"));
+    JSHandle<JSTaggedValue> value(thread, JSTaggedValue(1));
+
+    // the instances get the slack until the tracking finishes
+    for (uint32_t i = 1; i < JSHClass::SLACK_TRACKING_CONSTRUCTIONS; i++) {
+        JSHandle<JSObject> obj = factory->NewJSObjectByConstructor(ctor, ctorHandle);
+        EXPECT_EQ(obj->GetJSHClass()->GetInlinedProperties(),
+                  static_cast<uint32_t>(JSHClass::SLACK_TRACKING_CAPACITY_OF_IN_OBJECTS));
+        JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), keyX, value);
+        if (i % 2 == 0) {
+            JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), keyY, value);
+        }
+    }
+
+    // then they get as much in-object space as any instance used
+    JSHandle<JSObject> obj = factory->NewJSObjectByConstructor(ctor, ctorHandle);
+    JSHandle<JSHClass> initialHClass(thread, obj->GetJSHClass());
+    EXPECT_EQ(initialHClass->GetInlinedProperties(), 2U);
+    EXPECT_FALSE(initialHClass->IsSlackTracking());
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), keyX, value);
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), keyY, value);
+    EXPECT_EQ(obj->GetProperties(), thread->GlobalConstants()->GetEmptyArray());
+    EXPECT_EQ(JSObject::GetProperty(thread, obj, keyY).GetValue()->GetInt(), 1);
+
+    JSHandle<JSObject> nextObj = factory->NewJSObjectByConstructor(ctor, ctorHandle);
+    EXPECT_EQ(nextObj->GetJSHClass(), *initialHClass);
+}
 }  // namespace panda::test
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/global_env.h"
+#include "ecmascript/js_hclass.h"
+#include "ecmascript/js_object-inl.h"
+#include "ecmascript/layout_info-inl.h"
+#include "ecmascript/object_factory.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda;
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class LayoutInfoTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        TestHelper::CreateEcmaVMWithScope(instance, thread, scope);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    }
+
+    EcmaVM *instance {nullptr};
+    ecmascript::EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+};
+
+static JSHandle<JSTaggedValue> GetKey(JSThread *thread, int index)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    return JSHandle<JSTaggedValue>(factory->NewFromASCII(CString("key") + ToCString(index)));
+}
+
+static void AddKeys(JSThread *thread, const JSHandle<LayoutInfo> &layout, int begin, int end)
+{
+    for (int i = begin; i < end; i++) {
+        JSHandle<JSTaggedValue> key = GetKey(thread, i);
+        PropertyAttributes attr = PropertyAttributes::Default();
+        attr.SetOffset(i);
+        layout->AddKey(thread, i, key.GetTaggedValue(), attr);
+    }
+}
+
+static void ExpectKeysFound(JSThread *thread, const JSHandle<LayoutInfo> &layout, int number)
+{
+    for (int i = 0; i < number; i++) {
+        JSHandle<JSTaggedValue> key = GetKey(thread, i);
+        EXPECT_EQ(layout->FindElementInHashIndex(key.GetTaggedValue(), number), i);
+        EXPECT_EQ(layout->BinarySearch(key.GetTaggedValue(), number), i);
+    }
+}
+
+HWTEST_F_L0(LayoutInfoTest, FindElementInHashIndex)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    int number = LayoutInfo::HASH_INDEX_MIN_CAPACITY + 8;  // 8: more properties than the smallest indexed layout
+    JSHandle<LayoutInfo> layout = factory->CreateLayoutInfo(number);
+    EXPECT_TRUE(layout->HasHashIndex());
+    AddKeys(thread, layout, 0, number);
+    ExpectKeysFound(thread, layout, number);
+
+    JSHandle<JSTaggedValue> missing(factory->NewFromASCII("missing"));
+    EXPECT_EQ(layout->FindElementInHashIndex(missing.GetTaggedValue(), number), -1);
+    EXPECT_EQ(layout->BinarySearch(missing.GetTaggedValue(), number), -1);
+}
+
+HWTEST_F_L0(LayoutInfoTest, NoHashIndexForSmallLayout)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<LayoutInfo> layout = factory->CreateLayoutInfo(LayoutInfo::MIN_PROPERTIES_LENGTH);
+    EXPECT_FALSE(layout->HasHashIndex());
+}
+
+HWTEST_F_L0(LayoutInfoTest, FindElementAfterExtend)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    // the layout only gets its hash index once it is extended, its capacity is one below the indexed ones
+    int number = LayoutInfo::HASH_INDEX_MIN_CAPACITY - LayoutInfo::MIN_PROPERTIES_LENGTH - 1;
+    JSHandle<LayoutInfo> layout = factory->CreateLayoutInfo(number);
+    EXPECT_FALSE(layout->HasHashIndex());
+    AddKeys(thread, layout, 0, number);
+
+    int newNumber = number + LayoutInfo::MIN_PROPERTIES_LENGTH * 2;  // 2: grow past the capacity of the old layout
+    JSHandle<LayoutInfo> extended = factory->ExtendLayoutInfo(layout, newNumber);
+    EXPECT_TRUE(extended->HasHashIndex());
+    ExpectKeysFound(thread, extended, number);
+    AddKeys(thread, extended, number, newNumber);
+    ExpectKeysFound(thread, extended, newNumber);
+
+    // an indexed layout extended once more gets an index of its own
+    JSHandle<LayoutInfo> extendedAgain = factory->ExtendLayoutInfo(extended, newNumber + 1);
+    EXPECT_TRUE(extendedAgain->HasHashIndex());
+    EXPECT_NE(extendedAgain->GetHashIndex().GetRawData(), extended->GetHashIndex().GetRawData());
+    AddKeys(thread, extendedAgain, newNumber, newNumber + 1);
+    ExpectKeysFound(thread, extendedAgain, newNumber + 1);
+    JSHandle<JSTaggedValue> lastKey = GetKey(thread, newNumber);
+    EXPECT_EQ(extended->FindElementInHashIndex(lastKey.GetTaggedValue(), newNumber), -1);
+}
+
+HWTEST_F_L0(LayoutInfoTest, FindElementAfterCopy)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    int number = LayoutInfo::HASH_INDEX_MIN_CAPACITY;
+    JSHandle<LayoutInfo> layout = factory->CreateLayoutInfo(number + 1);
+    AddKeys(thread, layout, 0, number);
+
+    JSHandle<LayoutInfo> copy = factory->CopyLayoutInfo(layout);
+    EXPECT_TRUE(copy->HasHashIndex());
+    EXPECT_NE(copy->GetHashIndex().GetRawData(), layout->GetHashIndex().GetRawData());
+    ExpectKeysFound(thread, copy, number);
+
+    // a key added to the copy is not in the index of the original
+    AddKeys(thread, copy, number, number + 1);
+    ExpectKeysFound(thread, copy, number + 1);
+    JSHandle<JSTaggedValue> lastKey = GetKey(thread, number);
+    EXPECT_EQ(layout->FindElementInHashIndex(lastKey.GetTaggedValue(), number), -1);
+}
+
+HWTEST_F_L0(LayoutInfoTest, FindElementInSharedLayout)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<JSTaggedValue> objFun = thread->GetEcmaVM()->GetGlobalEnv()->GetObjectFunction();
+    JSHandle<JSTaggedValue> value(thread, JSTaggedValue(1));
+
+    // add properties until the layout is indexed and has room for one more
+    JSHandle<JSObject> obj1 = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFun), objFun);
+    int number = 0;
+    while (number < LayoutInfo::HASH_INDEX_MIN_CAPACITY ||
+           LayoutInfo::Cast(obj1->GetJSHClass()->GetLayout().GetTaggedObject())->GetPropertiesCapacity() <= number) {
+        JSObject::SetProperty(thread, obj1, GetKey(thread, number), value);
+        number++;
+    }
+
+    // the same transitions plus one more property append it to the layout of obj1
+    JSHandle<JSObject> obj2 = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFun), objFun);
+    for (int i = 0; i <= number; i++) {
+        JSObject::SetProperty(thread, obj2, GetKey(thread, i), value);
+    }
+    JSHandle<JSHClass> hclass1(thread, obj1->GetJSHClass());
+    JSHandle<JSHClass> hclass2(thread, obj2->GetJSHClass());
+    ASSERT_EQ(hclass1->GetLayout().GetRawData(), hclass2->GetLayout().GetRawData());
+    EXPECT_EQ(static_cast<int>(hclass1->NumberOfProps()), number);
+    EXPECT_EQ(static_cast<int>(hclass2->NumberOfProps()), number + 1);
+
+    JSHandle<LayoutInfo> layout(thread, hclass1->GetLayout());
+    EXPECT_TRUE(layout->HasHashIndex());
+    ExpectKeysFound(thread, layout, number + 1);
+    // the entry of the appended property is skipped for the hclass which does not own it
+    JSHandle<JSTaggedValue> lastKey = GetKey(thread, number);
+    EXPECT_EQ(layout->FindElementInHashIndex(lastKey.GetTaggedValue(), number), -1);
+    EXPECT_EQ(layout->FindElementInHashIndex(lastKey.GetTaggedValue(), number + 1), number);
+    EXPECT_TRUE(JSObject::GetProperty(thread, obj1, lastKey).GetValue()->IsUndefined());
+    EXPECT_EQ(JSObject::GetProperty(thread, obj2, lastKey).GetValue()->GetInt(), 1);
+}
+}  // namespace panda::test
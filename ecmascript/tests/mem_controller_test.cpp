@@ -20,6 +20,8 @@
 #include "ecmascript/js_thread.h"
 
 #include "ecmascript/mem/heap.h"
+#include "ecmascript/mem/heap_growing_policy.h"
+#include "ecmascript/mem/mem_controller.h"
 #include "ecmascript/mem/space.h"
 #include "ecmascript/object_factory.h"
 #include "ecmascript/tagged_array-inl.h"
@@ -134,4 +136,87 @@ HWTEST_F_L0(MemControllerTest, VerifyMutatorSpeed)
     ASSERT_TRUE(hugeObjectAllocSizeInLastGC > hugeArray->ComputeSize(JSTaggedValue::TaggedTypeSize(), SIZE));
 #endif
 }
+
+namespace {
+// an old gc of a recorded run, the speeds are the averages of the gc ring buffers at its end
+struct OldGCRecord {
+    size_t liveSize;
+    double gcSpeed;  // bytes per ms
+    double mutatorSpeed;  // bytes per ms
+};
+
+struct ReplayResult {
+    double gcCpuRatio;
+    size_t maxLimit;
+};
+
+// Replay the old gcs with the limits of the policy: each gc marks the live size, then the mutator allocates up to
+// the next limit.
+ReplayResult ReplayOldGCs(const HeapGrowingPolicy &policy, const std::vector<OldGCRecord> &records)
+{
+    double gcTime = 0;
+    double mutatorTime = 0;
+    size_t maxLimit = 0;
+    for (const auto &record : records) {
+        double factor = policy.CalculateGrowingFactor(record.gcSpeed, record.mutatorSpeed);
+        auto limit = static_cast<size_t>(record.liveSize * factor);
+        gcTime += record.liveSize / record.gcSpeed;
+        mutatorTime += (limit - record.liveSize) / record.mutatorSpeed;
+        maxLimit = std::max(maxLimit, limit);
+    }
+    return {gcTime / (gcTime + mutatorTime), maxLimit};
+}
+
+const std::vector<OldGCRecord> OLD_GC_RECORDS = {
+    {8 * 1024 * 1024, 300000, 20000},
+    {12 * 1024 * 1024, 320000, 12000},
+    {20 * 1024 * 1024, 280000, 9000},
+    {24 * 1024 * 1024, 350000, 6000},
+    {22 * 1024 * 1024, 400000, 3000},
+    {30 * 1024 * 1024, 380000, 15000},
+    {28 * 1024 * 1024, 420000, 2500},
+    {26 * 1024 * 1024, 410000, 4000},
+};
+}  // namespace
+
+HWTEST_F_L0(MemControllerTest, HeapGrowingPolicyOptions)
+{
+    const HeapGrowingPolicy *policy = thread->GetEcmaVM()->GetHeap()->GetMemController()->GetGrowingPolicy();
+    EXPECT_EQ(policy->GetGCCpuRatio(), HeapGrowingPolicy::DEFAULT_GC_CPU_RATIO);
+    EXPECT_EQ(policy->GetMinFactor(), HeapGrowingPolicy::DEFAULT_MIN_GROWING_FACTOR);
+    EXPECT_EQ(policy->GetMaxFactor(), HeapGrowingPolicy::DEFAULT_MAX_GROWING_FACTOR);
+    // nothing measured yet
+    EXPECT_EQ(policy->CalculateGrowingFactor(0, 0), HeapGrowingPolicy::DEFAULT_MAX_GROWING_FACTOR);
+
+    // 2.0, 1.0: the factors must stay within [1, max], the ratio within (0, 1)
+    std::unique_ptr<HeapGrowingPolicy> invalid(CreateHeapGrowingPolicy("unknown", 2.0, 0.5, 0.2));
+    EXPECT_NE(dynamic_cast<ThroughputGrowingPolicy *>(invalid.get()), nullptr);
+    EXPECT_EQ(invalid->GetGCCpuRatio(), HeapGrowingPolicy::DEFAULT_GC_CPU_RATIO);
+    EXPECT_EQ(invalid->GetMinFactor(), 1.0);
+    EXPECT_EQ(invalid->GetMaxFactor(), 1.0);
+}
+
+HWTEST_F_L0(MemControllerTest, HeapGrowingPolicyReplay)
+{
+    static constexpr double GC_CPU_RATIO = 0.05;
+    std::unique_ptr<HeapGrowingPolicy> throughput(CreateHeapGrowingPolicy("throughput", GC_CPU_RATIO,
+        HeapGrowingPolicy::DEFAULT_MIN_GROWING_FACTOR, HeapGrowingPolicy::DEFAULT_MAX_GROWING_FACTOR));
+    std::unique_ptr<HeapGrowingPolicy> memory(CreateHeapGrowingPolicy("memory", GC_CPU_RATIO,
+        HeapGrowingPolicy::DEFAULT_MIN_GROWING_FACTOR, HeapGrowingPolicy::DEFAULT_MAX_GROWING_FACTOR));
+    ReplayResult throughputResult = ReplayOldGCs(*throughput, OLD_GC_RECORDS);
+    ReplayResult memoryResult = ReplayOldGCs(*memory, OLD_GC_RECORDS);
+
+    // 0.001: the limits are rounded down to bytes
+    EXPECT_LE(throughputResult.gcCpuRatio, GC_CPU_RATIO + 0.001);
+    EXPECT_LE(memoryResult.gcCpuRatio, GC_CPU_RATIO + 0.001);
+    EXPECT_LT(throughputResult.gcCpuRatio, memoryResult.gcCpuRatio);
+    EXPECT_GT(throughputResult.maxLimit, memoryResult.maxLimit);
+
+    // a lower ratio makes the memory policy grow the heap further
+    std::unique_ptr<HeapGrowingPolicy> lowRatio(CreateHeapGrowingPolicy("memory", GC_CPU_RATIO / 2,
+        HeapGrowingPolicy::DEFAULT_MIN_GROWING_FACTOR, HeapGrowingPolicy::DEFAULT_MAX_GROWING_FACTOR));
+    ReplayResult lowRatioResult = ReplayOldGCs(*lowRatio, OLD_GC_RECORDS);
+    EXPECT_LT(lowRatioResult.gcCpuRatio, memoryResult.gcCpuRatio);
+    EXPECT_GT(lowRatioResult.maxLimit, memoryResult.maxLimit);
+}
 }  // namespace panda::test
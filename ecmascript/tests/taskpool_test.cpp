@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ecmascript/taskpool/runner.h"
+#include "ecmascript/taskpool/work_stealing_deque.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda;
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class TaskpoolTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+};
+
+class CountTask : public Task {
+public:
+    explicit CountTask(std::atomic<uint32_t> *count, TaskPriority priority = TaskPriority::NORMAL)
+        : Task(priority), count_(count) {}
+    ~CountTask() override = default;
+
+    bool Run([[maybe_unused]] uint32_t threadIndex) override
+    {
+        count_->fetch_add(1);
+        return true;
+    }
+
+    NO_COPY_SEMANTIC(CountTask);
+    NO_MOVE_SEMANTIC(CountTask);
+
+private:
+    std::atomic<uint32_t> *count_ {nullptr};
+};
+
+// Only handed between the owner and the thieves of a deque, never run.
+class IndexTask : public Task {
+public:
+    explicit IndexTask(uint32_t index) : index_(index) {}
+    ~IndexTask() override = default;
+
+    bool Run([[maybe_unused]] uint32_t threadIndex) override
+    {
+        return true;
+    }
+
+    uint32_t GetIndex() const
+    {
+        return index_;
+    }
+
+    NO_COPY_SEMANTIC(IndexTask);
+    NO_MOVE_SEMANTIC(IndexTask);
+
+private:
+    uint32_t index_ {0};
+};
+
+// Records its priority in the order the tasks run.
+class RecordTask : public Task {
+public:
+    RecordTask(TaskPriority priority, std::vector<TaskPriority> *order, std::atomic<uint32_t> *count)
+        : Task(priority), order_(order), count_(count) {}
+    ~RecordTask() override = default;
+
+    bool Run([[maybe_unused]] uint32_t threadIndex) override
+    {
+        // the runner of the test has a single worker, so the order needs no lock
+        order_->push_back(GetPriority());
+        count_->fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+    NO_COPY_SEMANTIC(RecordTask);
+    NO_MOVE_SEMANTIC(RecordTask);
+
+private:
+    std::vector<TaskPriority> *order_ {nullptr};
+    std::atomic<uint32_t> *count_ {nullptr};
+};
+
+// Keeps its worker busy until it is released.
+class BlockTask : public Task {
+public:
+    BlockTask(std::atomic<bool> *started, std::atomic<bool> *released) : started_(started), released_(released) {}
+    ~BlockTask() override = default;
+
+    bool Run([[maybe_unused]] uint32_t threadIndex) override
+    {
+        started_->store(true, std::memory_order_release);
+        while (!released_->load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    NO_COPY_SEMANTIC(BlockTask);
+    NO_MOVE_SEMANTIC(BlockTask);
+
+private:
+    std::atomic<bool> *started_ {nullptr};
+    std::atomic<bool> *released_ {nullptr};
+};
+
+// Posts its subtasks from the worker, so they go to the deque of the worker.
+class ForkTask : public Task {
+public:
+    ForkTask(Runner *runner, std::atomic<uint32_t> *count, uint32_t subtasks)
+        : runner_(runner), count_(count), subtasks_(subtasks) {}
+    ~ForkTask() override = default;
+
+    bool Run([[maybe_unused]] uint32_t threadIndex) override
+    {
+        for (uint32_t i = 0; i < subtasks_; i++) {
+            runner_->PostTask(std::make_unique<CountTask>(count_));
+        }
+        return true;
+    }
+
+    NO_COPY_SEMANTIC(ForkTask);
+    NO_MOVE_SEMANTIC(ForkTask);
+
+private:
+    Runner *runner_ {nullptr};
+    std::atomic<uint32_t> *count_ {nullptr};
+    uint32_t subtasks_ {0};
+};
+
+static void WaitForCount(const std::atomic<uint32_t> &count, uint32_t expected)
+{
+    while (count.load(std::memory_order_acquire) < expected) {
+        std::this_thread::yield();
+    }
+}
+
+HWTEST_F_L0(TaskpoolTest, DequePushPopSteal)
+{
+    std::atomic<uint32_t> count {0};
+    CountTask first(&count);
+    CountTask second(&count);
+    CountTask third(&count);
+    WorkStealingDeque deque;
+    EXPECT_TRUE(deque.IsEmpty());
+    EXPECT_TRUE(deque.Push(&first));
+    EXPECT_TRUE(deque.Push(&second));
+    EXPECT_TRUE(deque.Push(&third));
+    EXPECT_FALSE(deque.IsEmpty());
+
+    // the owner pops the newest task, thieves steal the oldest one
+    bool lostRace = false;
+    EXPECT_EQ(deque.Pop(), &third);
+    EXPECT_EQ(deque.Steal(&lostRace), &first);
+    EXPECT_FALSE(lostRace);
+    EXPECT_EQ(deque.Pop(), &second);
+    EXPECT_TRUE(deque.IsEmpty());
+}
+
+HWTEST_F_L0(TaskpoolTest, DequeEmpty)
+{
+    WorkStealingDeque deque;
+    bool lostRace = false;
+    EXPECT_EQ(deque.Steal(&lostRace), nullptr);
+    EXPECT_FALSE(lostRace);
+    EXPECT_EQ(deque.Pop(), nullptr);
+    EXPECT_TRUE(deque.IsEmpty());
+
+    // an emptied deque behaves like a new one
+    std::atomic<uint32_t> count {0};
+    CountTask task(&count);
+    EXPECT_TRUE(deque.Push(&task));
+    EXPECT_EQ(deque.Steal(&lostRace), &task);
+    EXPECT_EQ(deque.Steal(&lostRace), nullptr);
+    EXPECT_EQ(deque.Pop(), nullptr);
+    EXPECT_FALSE(lostRace);
+}
+
+HWTEST_F_L0(TaskpoolTest, DequeFull)
+{
+    std::atomic<uint32_t> count {0};
+    CountTask task(&count);
+    WorkStealingDeque deque;
+    for (int64_t i = 0; i < WorkStealingDeque::CAPACITY; i++) {
+        EXPECT_TRUE(deque.Push(&task));
+    }
+    EXPECT_FALSE(deque.Push(&task));
+    bool lostRace = false;
+    EXPECT_EQ(deque.Steal(&lostRace), &task);
+    EXPECT_TRUE(deque.Push(&task));
+}
+
+HWTEST_F_L0(TaskpoolTest, DequeStealBetweenThreads)
+{
+    constexpr uint32_t TASK_NUM = 10000;
+    constexpr uint32_t THIEF_NUM = 3;
+    std::vector<std::unique_ptr<IndexTask>> tasks;
+    for (uint32_t i = 0; i < TASK_NUM; i++) {
+        tasks.emplace_back(std::make_unique<IndexTask>(i));
+    }
+    std::vector<std::atomic<uint32_t>> taken(TASK_NUM);
+    auto take = [&taken](Task *task) {
+        if (task != nullptr) {
+            taken[static_cast<IndexTask *>(task)->GetIndex()].fetch_add(1);
+        }
+    };
+
+    WorkStealingDeque deque;
+    std::atomic<bool> done {false};
+    std::vector<std::thread> thieves;
+    for (uint32_t i = 0; i < THIEF_NUM; i++) {
+        thieves.emplace_back([&deque, &done, &take]() {
+            while (!done.load(std::memory_order_acquire) || !deque.IsEmpty()) {
+                bool lostRace = false;
+                take(deque.Steal(&lostRace));
+            }
+        });
+    }
+    std::thread owner([&deque, &done, &take, &tasks]() {
+        for (uint32_t i = 0; i < TASK_NUM; i++) {
+            while (!deque.Push(tasks[i].get())) {
+                take(deque.Pop());
+            }
+            if (i % 3 == 0) {  // 3: the owner also pops a part of its tasks
+                take(deque.Pop());
+            }
+        }
+        while (!deque.IsEmpty()) {
+            take(deque.Pop());
+        }
+        done.store(true, std::memory_order_release);
+    });
+    owner.join();
+    for (std::thread &thief : thieves) {
+        thief.join();
+    }
+
+    // every task is taken exactly once, by the owner or by one of the thieves
+    for (uint32_t i = 0; i < TASK_NUM; i++) {
+        EXPECT_EQ(taken[i].load(), 1U);
+    }
+}
+
+HWTEST_F_L0(TaskpoolTest, PriorityOrder)
+{
+    Runner runner(1);
+    std::atomic<bool> started {false};
+    std::atomic<bool> released {false};
+    runner.PostTask(std::make_unique<BlockTask>(&started, &released));
+    while (!started.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+
+    // posted while the only worker is busy, so all of them wait in the shared queue
+    std::vector<TaskPriority> order;
+    std::atomic<uint32_t> count {0};
+    runner.PostTask(std::make_unique<RecordTask>(TaskPriority::LOW, &order, &count));
+    runner.PostTask(std::make_unique<RecordTask>(TaskPriority::NORMAL, &order, &count));
+    runner.PostTask(std::make_unique<RecordTask>(TaskPriority::HIGH, &order, &count));
+    runner.PostTask(std::make_unique<RecordTask>(TaskPriority::NORMAL, &order, &count));
+    released.store(true, std::memory_order_release);
+    WaitForCount(count, 4);  // 4: the number of recorded tasks
+    runner.TerminateThread();
+
+    std::vector<TaskPriority> expected {TaskPriority::HIGH, TaskPriority::NORMAL, TaskPriority::NORMAL,
+                                        TaskPriority::LOW};
+    EXPECT_EQ(order, expected);
+}
+
+HWTEST_F_L0(TaskpoolTest, LocalPostAndSteal)
+{
+    constexpr uint32_t SUBTASK_NUM = 64;
+    Runner runner(2);  // 2: a second worker to steal the subtasks
+    std::atomic<uint32_t> count {0};
+    runner.PostTask(std::make_unique<ForkTask>(&runner, &count, SUBTASK_NUM));
+    WaitForCount(count, SUBTASK_NUM);
+    TaskpoolStatistics statistics = runner.GetStatistics();
+    runner.TerminateThread();
+
+    EXPECT_EQ(count.load(), SUBTASK_NUM);
+    // only the fork task comes from outside the pool, its subtasks go to the deque of its worker
+    EXPECT_EQ(statistics.sharedPostCount, 1U);
+    EXPECT_EQ(statistics.localPostCount, SUBTASK_NUM);
+}
+}  // namespace panda::test
@@ -308,6 +308,53 @@ HWTEST_F_L0(TSTypeTest, ClassInstanceType)
     ASSERT_EQ(classInstanceType->GetClassRefGT().GetGlobalTSTypeRef(), 50ULL);
 }
 
+HWTEST_F_L0(TSTypeTest, ClassInstancePropertyIndex)
+{
+    auto factory = ecmaVm->GetFactory();
+    JSHandle<TSTypeTable> table = factory->NewTSTypeTable(2);
+
+    const int literalLength = 18;
+    const uint32_t propsNum = 2;
+    JSHandle<TaggedArray> literal = factory->NewTaggedArray(literalLength);
+    JSHandle<EcmaString> propsNameA = factory->NewFromASCII("propsA");
+    JSHandle<EcmaString> propsNameB = factory->NewFromASCII("propsB");
+    JSHandle<EcmaString> funcName = factory->NewFromASCII("constructor");
+    literal->Set(thread, 0, JSTaggedValue(static_cast<int>(TSTypeTable::TypeLiteralFlag::CLASS)));
+    literal->Set(thread, 1, JSTaggedValue(0));
+    literal->Set(thread, 2, JSTaggedValue(0));
+    literal->Set(thread, 3, JSTaggedValue(0));
+    literal->Set(thread, 4, JSTaggedValue(propsNum));
+    literal->Set(thread, 5, propsNameA.GetTaggedValue());
+    literal->Set(thread, 6, JSTaggedValue(static_cast<int>(TSTypeKind::TS_STRING)));
+    literal->Set(thread, 7, JSTaggedValue(0));
+    literal->Set(thread, 8, JSTaggedValue(0));
+    literal->Set(thread, 9, propsNameB.GetTaggedValue());
+    literal->Set(thread, 10, JSTaggedValue(static_cast<int>(TSTypeKind::TS_NUMBER)));
+    literal->Set(thread, 11, JSTaggedValue(0));
+    literal->Set(thread, 12, JSTaggedValue(0));
+    literal->Set(thread, 13, JSTaggedValue(1));
+    literal->Set(thread, 14, funcName.GetTaggedValue());
+    literal->Set(thread, 15, JSTaggedValue(static_cast<int>(TSTypeTable::TypeLiteralFlag::FUNCTION)));
+    literal->Set(thread, 16, JSTaggedValue(0));
+    literal->Set(thread, 17, JSTaggedValue(0));
+
+    CVector<JSHandle<EcmaString>> recordImportModules {};
+    JSHandle<JSTaggedValue> type = TSTypeTable::ParseType(thread, table, literal,
+                                                          factory->NewFromASCII(CString("test")),
+                                                          recordImportModules);
+    ASSERT_TRUE(type->IsTSClassType());
+    table->Set(thread, 0, type);
+
+    JSHandle<TSClassInstanceType> classInstanceType = factory->NewTSClassInstanceType();
+    classInstanceType->SetClassRefGT(GlobalTSTypeRef(0, GlobalTSTypeRef::TS_TYPE_RESERVED_COUNT,
+                                                     static_cast<int>(TSTypeKind::TS_CLASS)));
+    table->Set(thread, 1, classInstanceType);
+
+    ASSERT_EQ(TSClassInstanceType::GetPropertyIndex(thread, table, 1, propsNameA), 0);
+    ASSERT_EQ(TSClassInstanceType::GetPropertyIndex(thread, table, 1, propsNameB), 1);
+    ASSERT_EQ(TSClassInstanceType::GetPropertyIndex(thread, table, 1, funcName), -1);
+}
+
 HWTEST_F_L0(TSTypeTest, FuntionType)
 {
     auto factory = ecmaVm->GetFactory();
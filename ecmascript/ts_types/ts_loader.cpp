@@ -15,6 +15,7 @@
 
 #include "ecmascript/ts_types/ts_loader.h"
 
+#include "ecmascript/ecma_handle_scope.h"
 #include "ecmascript/jspandafile/js_pandafile.h"
 #include "ecmascript/ts_types/ts_type_table.h"
 #include "libpandafile/file-inl.h"
@@ -138,6 +139,21 @@ GlobalTSTypeRef TSLoader::GetPropType(GlobalTSTypeRef gt, JSHandle<EcmaString> p
     return propTypeRef;
 }
 
+int TSLoader::GetClassInstancePropertyIndex(GlobalTSTypeRef gt, JSHandle<EcmaString> propertyName) const
+{
+    os::memory::LockHolder lock(compilerQueryMutex_);
+    JSThread *thread = vm_->GetJSThread();
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    JSHandle<TSModuleTable> table = GetTSModuleTable();
+
+    uint32_t moduleId = gt.GetModuleId();
+    uint32_t localId = gt.GetLocalId();
+    ASSERT(GetTypeKind(gt) == TSTypeKind::TS_CLASS_INSTANCE);
+
+    JSHandle<TSTypeTable> typeTable = table->GetTSTypeTable(thread, moduleId);
+    return TSClassInstanceType::GetPropertyIndex(thread, typeTable, localId, propertyName);
+}
+
 uint32_t TSLoader::GetUnionTypeLength(GlobalTSTypeRef gt) const
 {
     JSThread *thread = vm_->GetJSThread();
@@ -19,6 +19,7 @@
 #include "ecmascript/mem/c_string.h"
 #include "ecmascript/js_handle.h"
 #include "ecmascript/js_tagged_value-inl.h"
+#include "os/mutex.h"
 
 namespace panda::ecmascript {
 class GlobalTSTypeRef {
@@ -215,6 +216,9 @@ public:
 
     GlobalTSTypeRef PUBLIC_API GetPropType(GlobalTSTypeRef gt, JSHandle<EcmaString> propertyName) const;
 
+    // may be called from any aot compiler thread
+    int PUBLIC_API GetClassInstancePropertyIndex(GlobalTSTypeRef gt, JSHandle<EcmaString> propertyName) const;
+
     uint32_t PUBLIC_API GetUnionTypeLength(GlobalTSTypeRef gt) const;
 
     GlobalTSTypeRef PUBLIC_API GetUnionTypeByIndex(GlobalTSTypeRef gt, int index) const;
@@ -266,6 +270,8 @@ private:
     EcmaVM *vm_ {nullptr};
     JSTaggedValue globalModuleTable_ {JSTaggedValue::Hole()};
     CVector<JSTaggedType> constantStringTable_ {};
+    // the aot compiler lowers methods on several threads, its queries which create handles on the js thread hold it
+    mutable os::memory::Mutex compilerQueryMutex_;
     friend class EcmaVM;
 };
 }  // namespace panda::ecmascript
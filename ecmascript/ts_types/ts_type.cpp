@@ -128,6 +128,19 @@ GlobalTSTypeRef TSClassInstanceType::GetPropTypeGT(const JSThread *thread, JSHan
     return propTypeGT;
 }
 
+int TSClassInstanceType::GetPropertyIndex(const JSThread *thread, JSHandle<TSTypeTable> &table,
+                                          int localtypeId, JSHandle<EcmaString> propName)
+{
+    JSHandle<TSClassInstanceType> classInstanceType(thread, table->Get(localtypeId));
+    GlobalTSTypeRef createClassTypeRefGT = classInstanceType->GetClassRefGT();
+    uint32_t localId = createClassTypeRefGT.GetLocalId();
+    int localTableIndex = TSTypeTable::GetUserdefinedTypeId(localId);
+
+    JSHandle<TSClassType> createClassType(thread, table->Get(localTableIndex));
+    JSHandle<TSObjectType> instanceType(thread, createClassType->GetInstanceType());
+    return TSObjectType::GetPropertyIndex(instanceType, propName);
+}
+
 GlobalTSTypeRef TSObjectType::GetPropTypeGT(JSHandle<TSTypeTable> &table, JSHandle<TSObjectType> objType,
                                             JSHandle<EcmaString> propName)
 {
@@ -152,6 +165,19 @@ GlobalTSTypeRef TSObjectType::GetPropTypeGT(JSHandle<TSTypeTable> &table, JSHand
     return GlobalTSTypeRef::Default();
 }
 
+int TSObjectType::GetPropertyIndex(JSHandle<TSObjectType> objType, JSHandle<EcmaString> propName)
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    TSObjLayoutInfo *objTypeInfo = TSObjLayoutInfo::Cast(objType->GetObjLayoutInfo().GetTaggedObject());
+    for (uint32_t index = 0; index < objTypeInfo->NumberOfElements(); ++index) {
+        EcmaString* propKey = EcmaString::Cast(objTypeInfo->GetKey(index).GetTaggedObject());
+        if (EcmaString::StringsAreEqual(propKey, *propName)) {
+            return static_cast<int>(index);
+        }
+    }
+    return -1;
+}
+
 int TSFunctionType::GetParametersNum()
 {
     DISALLOW_GARBAGE_COLLECTION;
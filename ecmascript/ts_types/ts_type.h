@@ -59,6 +59,8 @@ public:
     static GlobalTSTypeRef GetPropTypeGT(JSHandle<TSTypeTable> &table, JSHandle<TSObjectType> objType,
                                           JSHandle<EcmaString> propName);
 
+    static int GetPropertyIndex(JSHandle<TSObjectType> objType, JSHandle<EcmaString> propName);
+
     ACCESSORS(ObjLayoutInfo, PROPERTIES_OFFSET, HCLASS_OFFSET);
     ACCESSORS(HClass, HCLASS_OFFSET, SIZE);
 
@@ -96,6 +98,10 @@ public:
     static GlobalTSTypeRef GetPropTypeGT(const JSThread *thread, JSHandle<TSTypeTable> &table,
                                           int localtypeId, JSHandle<EcmaString> propName);
 
+    // index of a non-static field in the instance layout, or -1 if the class declares no such field
+    static int GetPropertyIndex(const JSThread *thread, JSHandle<TSTypeTable> &table,
+                                int localtypeId, JSHandle<EcmaString> propName);
+
     static constexpr size_t CREATE_CLASS_TYPE_OFFSET = TSType::SIZE;
     static constexpr size_t CREATE_CLASS_OFFSET = 1;
     ACCESSORS_PRIMITIVE_FIELD(ClassTypeRef, uint64_t, CREATE_CLASS_TYPE_OFFSET, LAST_OFFSET);
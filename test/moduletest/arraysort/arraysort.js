@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Array.prototype.sort on random, presorted and reversed inputs for each element kernel. The inputs of the default
+// sort are presorted in string order and those of the callback sort in numeric order, as each sort orders them.
+// Set BENCHMARK to true to repeat every sort and print its average time in ms, which the expected output leaves out.
+const BENCHMARK = false;
+const ITERATIONS = BENCHMARK ? 20 : 1;
+const LENGTH = 100000;
+let seed = 1;
+function random() {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed;
+}
+
+function isSorted(arr, cmp) {
+    for (let i = 1; i < arr.length; i++) {
+        if (cmp(arr[i - 1], arr[i]) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+function stringCompare(a, b) {
+    let x = String(a);
+    let y = String(b);
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+function numberCompare(a, b) {
+    return a - b;
+}
+
+function makeInputs(randomInput, cmp) {
+    let presorted = randomInput.slice().sort(cmp);
+    let reversed = presorted.slice().reverse();
+    return { random: randomInput, presorted: presorted, reversed: reversed };
+}
+
+// sorts a fresh copy of input ITERATIONS times and returns the last result
+function timedSort(name, input, cmp) {
+    let sorted;
+    let time = 0;
+    for (let i = 0; i < ITERATIONS; i++) {
+        let copy = input.slice();
+        let start = Date.now();
+        sorted = (cmp === undefined) ? copy.sort() : copy.sort(cmp);
+        time += Date.now() - start;
+    }
+    if (BENCHMARK) {
+        print(name + " time: " + (time / ITERATIONS) + " ms");
+    }
+    return sorted;
+}
+
+const kinds = {
+    int: (r) => (r % 200001) - 100000,
+    double: (r) => r / 1024 - 1000000,
+    string: (r) => "key" + (r % 50000),
+};
+
+function sortAll() {
+    for (let kind in kinds) {
+        let randomInput = [];
+        for (let i = 0; i < LENGTH; i++) {
+            randomInput.push(kinds[kind](random()));
+        }
+        let defaultInputs = makeInputs(randomInput, stringCompare);
+        let callbackInputs = (kind != "string") ? makeInputs(randomInput, numberCompare) : undefined;
+        for (let order in defaultInputs) {
+            let name = kind + " " + order + " default";
+            let defaultSorted = timedSort(name, defaultInputs[order], undefined);
+            print(name + ": " + isSorted(defaultSorted, stringCompare));
+            if (kind != "string") {
+                name = kind + " " + order + " callback";
+                let callbackSorted = timedSort(name, callbackInputs[order], numberCompare);
+                print(name + ": " + isSorted(callbackSorted, numberCompare));
+            }
+        }
+    }
+}
+sortAll();
+
+// stability, undefined and holes
+let records = [];
+for (let i = 0; i < 100; i++) {
+    records.push({ key: i % 3, id: i });
+}
+records.sort((a, b) => a.key - b.key);
+let stable = true;
+for (let i = 1; i < records.length; i++) {
+    if (records[i - 1].key == records[i].key && records[i - 1].id > records[i].id) {
+        stable = false;
+    }
+}
+print("stable: " + stable);
+
+let sparse = [3, undefined, 1, , 10, 2];
+sparse.sort();
+print(sparse.length + " " + sparse.join(",") + " " + (3 in sparse) + " " + (5 in sparse));
+print([1, 10, 9, -1, -10, 0, 100].sort().join(","));
+print([0.5, 1, -0.25, 10, 2e21, 1e-7].sort().join(","));